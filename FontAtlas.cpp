@@ -0,0 +1,524 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  FontAtlas.cpp
+//  spReticle
+//
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#	include <windows.h>
+#	include <GL/gl.h>
+#elif defined(OSMac_MachO_)
+#	include <OpenGL/gl.h>
+#else
+#	include <fcntl.h>
+#	include <unistd.h>
+#	include <sys/mman.h>
+#	include <GL/gl.h>
+#endif
+
+#include "defines.h"
+#include "font.h"
+#include "Lock.h"
+
+// Generated by spFontSDF, see the Makefile
+#include "fontSDF.h"
+
+#include "FontAtlas.h"
+
+FontAtlas::FontAtlas()
+:   base(NULL),
+    size(0),
+    header(NULL),
+    fonts(NULL),
+    glyphs(NULL),
+    kerningPairs(NULL),
+    pixelData(NULL),
+    sdfData(NULL)
+{
+}
+
+FontAtlas::~FontAtlas()
+{
+    unmap();
+}
+
+bool FontAtlas::load(const char *path)
+{
+    unmap();
+
+#if defined(_WIN32)
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    char *data = new char[size];
+    if (fread(data, 1, size, f) != size)
+    {
+        delete [] data;
+        fclose(f);
+        size = 0;
+        return false;
+    }
+    fclose(f);
+    base = data;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    size = st.st_size;
+
+    void *data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        size = 0;
+        return false;
+    }
+    base = (const char *)data;
+#endif
+
+    if (!setTables(base, size, true))
+    {
+        std::cerr << "FontAtlas: invalid font atlas " << path << std::endl;
+        unmap();
+        return false;
+    }
+
+    buildLookup();
+    return true;
+}
+
+// Lay out the font.h tables in the file format. The pixels are not copied,
+// they point to the compiled atlases.
+//
+void FontAtlas::loadBuiltin()
+{
+    unmap();
+
+    FontFileHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, FONT_FILE_MAGIC, 8);
+    h.version   = FONT_FILE_VERSION;
+    h.numFonts  = NUM_FONTS;
+    h.width     = (unsigned int)fontAtlas.width;
+    h.height    = (unsigned int)fontAtlas.height;
+    h.sdfWidth  = FONT_SDF_WIDTH;
+    h.sdfHeight = FONT_SDF_HEIGHT;
+    h.sdfSpread = FONT_SDF_SPREAD;
+
+    std::vector<FontFileFont> f;
+    std::vector<FontFileGlyph> g;
+    std::vector<FontFileKerning> k;
+
+    for (int fontIndex = 0; fontIndex < NUM_FONTS; fontIndex++)
+    {
+        TextureFont *font = ::fonts[fontIndex];
+
+        FontFileFont ff;
+        ff.size       = font->size;
+        ff.bold       = font->bold ? 1 : 0;
+        ff.firstGlyph = (unsigned int)g.size();
+        ff.numGlyphs  = (unsigned int)font->glyphs_count;
+        f.push_back(ff);
+
+        for (unsigned int glyphIndex = 0; glyphIndex < font->glyphs_count; glyphIndex++)
+        {
+            const TextureGlyph &glyph = font->glyphs[glyphIndex];
+
+            FontFileGlyph fg;
+            fg.charcode     = (unsigned int)glyph.charcode;
+            fg.width        = glyph.width;
+            fg.height       = glyph.height;
+            fg.offset_x     = glyph.offset_x;
+            fg.offset_y     = glyph.offset_y;
+            fg.advance_x    = glyph.advance_x;
+            fg.advance_y    = glyph.advance_y;
+            fg.u0           = glyph.u0;
+            fg.v0           = glyph.v0;
+            fg.u1           = glyph.u1;
+            fg.v1           = glyph.v1;
+            fg.firstKerning = (unsigned int)k.size();
+            fg.numKerning   = (unsigned int)glyph.kerning_count;
+            g.push_back(fg);
+
+            for (unsigned int kernIndex = 0; kernIndex < glyph.kerning_count; kernIndex++)
+            {
+                FontFileKerning fk;
+                fk.charcode = (unsigned int)glyph.kerning[kernIndex].charcode;
+                fk.kerning  = glyph.kerning[kernIndex].kerning;
+                k.push_back(fk);
+            }
+        }
+    }
+
+    h.numGlyphs  = (unsigned int)g.size();
+    h.numKerning = (unsigned int)k.size();
+
+    builtin.resize(sizeof(h) + f.size() * sizeof(FontFileFont) +
+                   g.size() * sizeof(FontFileGlyph) + k.size() * sizeof(FontFileKerning));
+
+    char *out = &builtin[0];
+    memcpy(out, &h, sizeof(h));
+    out += sizeof(h);
+    if (!f.empty()) memcpy(out, &f[0], f.size() * sizeof(FontFileFont));
+    out += f.size() * sizeof(FontFileFont);
+    if (!g.empty()) memcpy(out, &g[0], g.size() * sizeof(FontFileGlyph));
+    out += g.size() * sizeof(FontFileGlyph);
+    if (!k.empty()) memcpy(out, &k[0], k.size() * sizeof(FontFileKerning));
+
+    setTables(&builtin[0], builtin.size(), false);
+    pixelData = fontAtlas.data;
+    sdfData   = fontSDFData;
+
+    buildLookup();
+}
+
+bool FontAtlas::write(const char *path) const
+{
+    if (!valid())
+        return false;
+
+    FILE *out = fopen(path, "wb");
+    if (!out)
+        return false;
+
+    size_t tables = (const char *)(kerningPairs + header->numKerning) - (const char *)header;
+    size_t sdfSize = size_t(header->sdfWidth) * header->sdfHeight;
+
+    bool ok = fwrite(header, 1, tables, out) == tables &&
+              fwrite(pixelData, 1, size_t(header->width) * header->height, out) == size_t(header->width) * header->height &&
+              (sdfSize == 0 || fwrite(sdfData, 1, sdfSize, out) == sdfSize);
+
+    return (fclose(out) == 0) && ok;
+}
+
+// Validate the header and every table range before trusting any index.
+//
+bool FontAtlas::setTables(const char *data, size_t dataSize, bool hasPixels)
+{
+    const FontFileHeader *h = (const FontFileHeader *)data;
+    if (dataSize < sizeof(FontFileHeader) ||
+        memcmp(h->magic, FONT_FILE_MAGIC, 8) != 0 ||
+        h->version != FONT_FILE_VERSION)
+        return false;
+
+    size_t tables = sizeof(FontFileHeader) +
+                    size_t(h->numFonts)   * sizeof(FontFileFont) +
+                    size_t(h->numGlyphs)  * sizeof(FontFileGlyph) +
+                    size_t(h->numKerning) * sizeof(FontFileKerning);
+    size_t pixels = size_t(h->width) * h->height;
+    size_t sdf    = size_t(h->sdfWidth) * h->sdfHeight;
+
+    if (dataSize < tables || (hasPixels && dataSize < tables + pixels + sdf))
+        return false;
+
+    const FontFileFont *f     = (const FontFileFont *)(data + sizeof(FontFileHeader));
+    const FontFileGlyph *g    = (const FontFileGlyph *)(f + h->numFonts);
+    const FontFileKerning *k  = (const FontFileKerning *)(g + h->numGlyphs);
+
+    for (unsigned int i = 0; i < h->numFonts; i++)
+        if (f[i].firstGlyph > h->numGlyphs || f[i].numGlyphs > h->numGlyphs - f[i].firstGlyph)
+            return false;
+
+    for (unsigned int i = 0; i < h->numGlyphs; i++)
+        if (g[i].firstKerning > h->numKerning || g[i].numKerning > h->numKerning - g[i].firstKerning)
+            return false;
+
+    header       = h;
+    fonts        = f;
+    glyphs       = g;
+    kerningPairs = k;
+
+    if (hasPixels)
+    {
+        pixelData = (const unsigned char *)(data + tables);
+        sdfData   = sdf ? pixelData + pixels : NULL;
+    }
+
+    return true;
+}
+
+// Integer hashes of the lookup tables
+//
+static inline unsigned int hashChar(unsigned int c)
+{
+    return c * 2654435761u;
+}
+
+static inline unsigned int hashPair(unsigned int glyph, unsigned int previous)
+{
+    return (glyph * 2654435761u) ^ (previous * 2246822519u);
+}
+
+// Smallest power of two that is at least twice count
+//
+static unsigned int tableSize(unsigned int count)
+{
+    unsigned int size = 1;
+    while (size < count * 2)
+        size <<= 1;
+    return size;
+}
+
+void FontAtlas::buildLookup()
+{
+    lookup.assign(header->numFonts, GlyphLookup());
+
+    for (unsigned int i = 0; i < header->numFonts; i++)
+    {
+        const FontFileFont &font = fonts[i];
+        GlyphLookup &table = lookup[i];
+
+        memset(table.latin1, 0, sizeof(table.latin1));
+
+        unsigned int numWide = 0;
+        for (unsigned int j = 0; j < font.numGlyphs; j++)
+            if (glyphs[font.firstGlyph + j].charcode >= 256)
+                numWide++;
+
+        if (numWide)
+        {
+            GlyphSlot empty = { 0, 0 };
+            table.slots.assign(tableSize(numWide), empty);
+        }
+
+        unsigned int mask = (unsigned int)table.slots.size() - 1;
+
+        for (unsigned int j = 0; j < font.numGlyphs; j++)
+        {
+            unsigned int index = font.firstGlyph + j;
+            unsigned int c = glyphs[index].charcode;
+
+            if (c < 256)
+            {
+                table.latin1[c] = index + 1;
+                continue;
+            }
+
+            unsigned int slot = hashChar(c) & mask;
+            while (table.slots[slot].glyph && table.slots[slot].charcode != c)
+                slot = (slot + 1) & mask;
+
+            table.slots[slot].charcode = c;
+            table.slots[slot].glyph = index + 1;
+        }
+    }
+
+    // Precompute the kerning pairs of every glyph
+    kerningTable.clear();
+    if (header->numKerning)
+    {
+        KerningSlot empty = { 0, 0, 0.0f };
+        kerningTable.assign(tableSize(header->numKerning), empty);
+        unsigned int mask = (unsigned int)kerningTable.size() - 1;
+
+        for (unsigned int i = 0; i < header->numGlyphs; i++)
+        {
+            const FontFileGlyph &glyph = glyphs[i];
+            for (unsigned int j = 0; j < glyph.numKerning; j++)
+            {
+                const FontFileKerning &k = kerningPairs[glyph.firstKerning + j];
+
+                unsigned int slot = hashPair(i, k.charcode) & mask;
+                while (kerningTable[slot].glyph &&
+                       (kerningTable[slot].glyph != i + 1 || kerningTable[slot].previous != k.charcode))
+                    slot = (slot + 1) & mask;
+
+                // Keep the first pair, as the linear search of font.h did
+                if (kerningTable[slot].glyph)
+                    continue;
+
+                kerningTable[slot].glyph    = i + 1;
+                kerningTable[slot].previous = k.charcode;
+                kerningTable[slot].kerning  = k.kerning;
+            }
+        }
+    }
+}
+
+void FontAtlas::unmap()
+{
+    if (base)
+    {
+#if defined(_WIN32)
+        delete [] base;
+#else
+        munmap((void *)base, size);
+#endif
+    }
+
+    base = NULL;
+    size = 0;
+    builtin.clear();
+    header = NULL;
+    fonts = NULL;
+    glyphs = NULL;
+    kerningPairs = NULL;
+    pixelData = NULL;
+    sdfData = NULL;
+    lookup.clear();
+    kerningTable.clear();
+}
+
+int FontAtlas::findFont(bool bold) const
+{
+    int best = -1;
+
+    for (unsigned int i = 0; valid() && i < header->numFonts; i++)
+    {
+        bool matches = (fonts[i].bold != 0) == bold;
+        bool bestMatches = best >= 0 && (fonts[best].bold != 0) == bold;
+
+        if (best < 0 || (matches && !bestMatches) ||
+            (matches == bestMatches && fonts[i].size > fonts[best].size))
+            best = int(i);
+    }
+
+    return best;
+}
+
+const FontFileGlyph *FontAtlas::findGlyph(int font, wchar_t ch) const
+{
+    const GlyphLookup &table = lookup[font];
+    unsigned int c = (unsigned int)ch;
+
+    if (c < 256)
+        return table.latin1[c] ? &glyphs[table.latin1[c] - 1] : NULL;
+
+    if (table.slots.empty())
+        return NULL;
+
+    unsigned int mask = (unsigned int)table.slots.size() - 1;
+    for (unsigned int slot = hashChar(c) & mask; table.slots[slot].glyph; slot = (slot + 1) & mask)
+    {
+        if (table.slots[slot].charcode == c)
+            return &glyphs[table.slots[slot].glyph - 1];
+    }
+
+    return NULL;
+}
+
+float FontAtlas::kerning(const FontFileGlyph *glyph, wchar_t previous) const
+{
+    if (kerningTable.empty())
+        return 0.0f;
+
+    unsigned int index = glyphIndex(glyph);
+    unsigned int p = (unsigned int)previous;
+
+    unsigned int mask = (unsigned int)kerningTable.size() - 1;
+    for (unsigned int slot = hashPair(index, p) & mask; kerningTable[slot].glyph; slot = (slot + 1) & mask)
+    {
+        const KerningSlot &k = kerningTable[slot];
+        if (k.glyph == index + 1 && k.previous == p)
+            return k.kerning;
+    }
+
+    return 0.0f;
+}
+
+FontAtlas    *FontRegistry::atlas = NULL;
+unsigned int FontRegistry::refCount = 0;
+bool         FontRegistry::initialized = false;
+
+// The views of a node create and delete their renderers on the threads
+// they draw on, so the references are counted under a lock
+static Mutex registryMutex = SP_MUTEX_INITIALIZER;
+
+void FontRegistry::initialize()
+{
+    if (initialized)
+        return;
+
+    acquire();
+    initialized = true;
+}
+
+void FontRegistry::uninitialize()
+{
+    if (!initialized)
+        return;
+
+    initialized = false;
+    release();
+}
+
+FontAtlas *FontRegistry::acquire()
+{
+    Lock lock(registryMutex);
+
+    if (!atlas)
+    {
+        atlas = new FontAtlas;
+
+        const char *path = getenv(FONT_ATLAS_ENV_VAR);
+        if (path && *path && !atlas->load(path))
+            std::cerr << "FontAtlas: unable to load font atlas " << path << ", using the default font" << std::endl;
+
+        if (!atlas->valid())
+            atlas->loadBuiltin();
+    }
+
+    refCount++;
+    return atlas;
+}
+
+void FontRegistry::release()
+{
+    Lock lock(registryMutex);
+
+    if (refCount == 0 || --refCount > 0)
+        return;
+
+    delete atlas;
+    atlas = NULL;
+}
@@ -0,0 +1,226 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  FontAtlas.h
+//  spReticle
+//
+
+#ifndef spReticle_FontAtlas_h
+#define spReticle_FontAtlas_h
+
+#include <vector>
+#include <stddef.h>
+#include <wchar.h>
+
+// Binary font atlas file. The file is produced by the spFontAtlas tool from
+// font.h and is memory mapped read-only by the plugin the first time text is
+// drawn, so several Maya sessions share its pages.
+//
+// Layout (all integers are little-endian 32 bit):
+//   FontFileHeader
+//   FontFileFont    font[numFonts]
+//   FontFileGlyph   glyph[numGlyphs]         grouped by font
+//   FontFileKerning kerning[numKerning]      grouped by glyph
+//   unsigned char   pixels[width*height]     alpha atlas
+//   unsigned char   sdf[sdfWidth*sdfHeight]  signed distance field atlas
+//
+// Texture coordinates are normalized so they are valid for both atlases.
+#define FONT_FILE_MAGIC     "SPFONT01"
+#define FONT_FILE_VERSION   1
+
+struct FontFileHeader
+{
+    char         magic[8];
+    unsigned int version;
+    unsigned int numFonts;
+    unsigned int numGlyphs;
+    unsigned int numKerning;
+    unsigned int width;
+    unsigned int height;
+    unsigned int sdfWidth;
+    unsigned int sdfHeight;
+    unsigned int sdfSpread;
+};
+
+struct FontFileFont
+{
+    float        size;
+    unsigned int bold;
+    unsigned int firstGlyph;
+    unsigned int numGlyphs;
+};
+
+struct FontFileGlyph
+{
+    unsigned int charcode;
+    int          width;
+    int          height;
+    int          offset_x;
+    int          offset_y;
+    float        advance_x;
+    float        advance_y;
+    float        u0, v0, u1, v1;
+    unsigned int firstKerning;
+    unsigned int numKerning;
+};
+
+// Kerning between the glyph and the previous character
+struct FontFileKerning
+{
+    unsigned int charcode;
+    float        kerning;
+};
+
+class FontAtlas
+{
+public:
+    FontAtlas();
+    ~FontAtlas();
+
+    // Map the atlas file at path. Returns false, leaving the atlas empty, if
+    // the file cannot be read or is not a valid atlas.
+    bool load(const char *path);
+
+    // Use the atlas compiled into the plugin from font.h
+    void loadBuiltin();
+
+    // Write the atlas to path in the binary format
+    bool write(const char *path) const;
+
+    bool valid() const { return header != NULL; }
+
+    unsigned int numFonts() const { return header->numFonts; }
+    const FontFileFont &font(int i) const { return fonts[i]; }
+
+    // Index of the largest font of the given weight, or of any weight if
+    // there is none. Returns -1 if the atlas is empty.
+    int findFont(bool bold) const;
+
+    // The glyph of character c in the given font, or NULL if it is missing
+    const FontFileGlyph *findGlyph(int font, wchar_t c) const;
+
+    // The kerning to apply between the previous character and the glyph
+    float kerning(const FontFileGlyph *glyph, wchar_t previous) const;
+
+    // The kerning pairs as stored in the file, see FontFileGlyph
+    unsigned int numKerning() const { return header->numKerning; }
+    const FontFileKerning &kerningPair(unsigned int i) const { return kerningPairs[i]; }
+
+    unsigned int numGlyphs() const { return header->numGlyphs; }
+    const FontFileGlyph &glyph(unsigned int i) const { return glyphs[i]; }
+    unsigned int glyphIndex(const FontFileGlyph *glyph) const { return (unsigned int)(glyph - glyphs); }
+
+    unsigned int width() const { return header->width; }
+    unsigned int height() const { return header->height; }
+    const unsigned char *pixels() const { return pixelData; }
+
+    // The distance field atlas, NULL if the atlas has none
+    unsigned int sdfWidth() const { return header->sdfWidth; }
+    unsigned int sdfHeight() const { return header->sdfHeight; }
+    const unsigned char *sdfPixels() const { return sdfData; }
+
+private:
+    FontAtlas(const FontAtlas &);
+    FontAtlas &operator=(const FontAtlas &);
+
+    // Point the tables into data and check that every range is in bounds
+    bool setTables(const char *data, size_t size, bool hasPixels);
+    void buildLookup();
+    void unmap();
+
+    // Glyphs of one font. Basic Latin and Latin-1 characters index latin1
+    // directly, every other character is found in an open addressing table
+    // kept at most half full. Both hold the glyph index + 1, 0 = missing.
+    struct GlyphSlot
+    {
+        unsigned int charcode;
+        unsigned int glyph;
+    };
+
+    struct GlyphLookup
+    {
+        unsigned int           latin1[256];
+        std::vector<GlyphSlot> slots;
+    };
+
+    // Kerning of every (glyph, previous character) pair, in an open
+    // addressing table kept at most half full. glyph is the glyph index + 1,
+    // 0 = empty slot.
+    struct KerningSlot
+    {
+        unsigned int glyph;
+        unsigned int previous;
+        float        kerning;
+    };
+
+    const char             *base;
+    size_t                 size;
+    std::vector<char>      builtin;
+    const FontFileHeader   *header;
+    const FontFileFont     *fonts;
+    const FontFileGlyph    *glyphs;
+    const FontFileKerning  *kerningPairs;
+    const unsigned char    *pixelData;
+    const unsigned char    *sdfData;
+    std::vector<GlyphLookup> lookup;
+    std::vector<KerningSlot> kerningTable;
+};
+
+// Process wide font atlas shared by every renderer. initializePlugin builds
+// it once and holds a reference until uninitializePlugin, and every renderer
+// holds one for its lifetime. The atlas is freed with the last reference.
+// References may be acquired and released from any thread.
+class FontRegistry
+{
+public:
+    // Load the atlas file named by SPRETICLE_FONT_ATLAS, or the fonts
+    // compiled from font.h, and hold the plugin's reference
+    static void initialize();
+
+    // Drop the plugin's reference
+    static void uninitialize();
+
+    // Get a reference to the shared atlas, loading it if needed
+    static FontAtlas *acquire();
+
+    // Drop a reference obtained with acquire
+    static void release();
+
+private:
+    static FontAtlas    *atlas;
+    static unsigned int refCount;
+    static bool         initialized;
+};
+
+#endif
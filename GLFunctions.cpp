@@ -0,0 +1,235 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  GLFunctions.cpp
+//  spReticle
+//
+
+#include <map>
+#include <string>
+#include <stdio.h>
+#include <string.h>
+
+#include "GLFunctions.h"
+#include "Lock.h"
+
+#if defined(SPRETICLE_OSMESA)
+#	include <GL/osmesa.h>
+#elif defined(SPRETICLE_EGL)
+#	include <EGL/egl.h>
+#elif defined(_WIN32)
+	// wglGetProcAddress comes with windows.h
+#elif defined(OSMac_MachO_)
+#	include <dlfcn.h>
+#else
+#	include <GL/glx.h>
+#endif
+
+#define SPGL_DEFINE(feature, ret, name, args) \
+    spPFNgl##name spgl##name = NULL;
+
+SPGL_FUNCTIONS(SPGL_DEFINE)
+
+#undef SPGL_DEFINE
+
+namespace
+{
+    struct Function
+    {
+        GLFunctions::Feature feature;
+        void                 **pointer;
+        const char           *name;
+    };
+
+#define SPGL_ENTRY(feature, ret, name, args) \
+    { GLFunctions::k##feature, reinterpret_cast<void **>(&spgl##name), "gl" #name },
+
+    const Function functions[] = {
+        SPGL_FUNCTIONS(SPGL_ENTRY)
+    };
+
+#undef SPGL_ENTRY
+
+    // The core version of a feature, and the extensions providing it in
+    // older versions along with the suffix of their function names
+    struct FeatureVersion
+    {
+        GLFunctions::Feature feature;
+        int                  major;
+        int                  minor;
+        const char           *extension;
+        const char           *extension2;
+        const char           *suffix;
+    };
+
+    // The shader functions of ARB_shader_objects take handles instead of
+    // names, so shaders need OpenGL 2.0.
+    const FeatureVersion features[] = {
+        { GLFunctions::kMultitexture,      1, 3, "GL_ARB_multitexture",          NULL,                    "ARB" },
+        { GLFunctions::kBlendFuncSeparate, 1, 4, "GL_EXT_blend_func_separate",   NULL,                    "EXT" },
+        { GLFunctions::kBuffers,           1, 5, "GL_ARB_vertex_buffer_object",  NULL,                    "ARB" },
+        { GLFunctions::kShaders,           2, 0, NULL,                           NULL,                    ""    },
+        { GLFunctions::kFramebuffers,      3, 0, "GL_ARB_framebuffer_object",    NULL,                    ""    },
+        { GLFunctions::kInstancing,        3, 3, "GL_ARB_instanced_arrays",      "GL_ARB_draw_instanced", "ARB" },
+        { GLFunctions::kTimerQueries,      3, 3, "GL_ARB_timer_query",           NULL,                    ""    }
+    };
+
+    // The features of every context, found and read under the lock, and
+    // the context being drawn on each thread and its features. The function
+    // pointers are only resolved under the lock too.
+    Mutex                                mutex = SP_MUTEX_INITIALIZER;
+    std::map<GLContextKey, unsigned int> contexts;
+    SP_THREAD_LOCAL GLContextKey         currentContext = NULL;
+    SP_THREAD_LOCAL unsigned int         current = 0;
+
+    // Whole words of the extension string only, GL_ARB_foo must not match
+    // GL_ARB_foo_bar
+    bool hasExtension(const char *extensions, const char *name)
+    {
+        if (!extensions || !name)
+            return false;
+
+        size_t length = strlen(name);
+        for (const char *p = strstr(extensions, name); p; p = strstr(p + length, name))
+        {
+            if ((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0'))
+                return true;
+        }
+        return false;
+    }
+
+    void *procAddress(const std::string &name)
+    {
+#if defined(SPRETICLE_OSMESA)
+        return (void *) OSMesaGetProcAddress(name.c_str());
+#elif defined(SPRETICLE_EGL)
+        return (void *) eglGetProcAddress(name.c_str());
+#elif defined(_WIN32)
+        // Some drivers return small integers instead of NULL
+        INT_PTR p = (INT_PTR) wglGetProcAddress(name.c_str());
+        if (p >= -1 && p <= 3)
+            return NULL;
+        return (void *) p;
+#elif defined(OSMac_MachO_)
+        return dlsym(RTLD_DEFAULT, name.c_str());
+#else
+        // Never NULL, the feature must be checked first
+        return (void *) glXGetProcAddressARB((const GLubyte *) name.c_str());
+#endif
+    }
+
+    // Resolve the functions still missing and return the features of the
+    // current context. A pointer that is already set is kept, as other
+    // contexts may be using it.
+    unsigned int findFeatures()
+    {
+        int major = 0, minor = 0;
+        const char *version = (const char *) glGetString( GL_VERSION );
+        if (!version || sscanf(version, "%d.%d", &major, &minor) != 2)
+            return 0;
+
+        // NULL in core profile contexts, which have the core versions
+        const char *extensions = (const char *) glGetString( GL_EXTENSIONS );
+
+        unsigned int found = 0;
+        for (size_t f = 0; f < sizeof(features) / sizeof(features[0]); f++)
+        {
+            const FeatureVersion &fv = features[f];
+            bool core = major > fv.major || (major == fv.major && minor >= fv.minor);
+            if (!core && !(hasExtension(extensions, fv.extension) &&
+                           (!fv.extension2 || hasExtension(extensions, fv.extension2))))
+                continue;
+
+            bool resolved = true;
+            for (size_t i = 0; i < sizeof(functions) / sizeof(functions[0]); i++)
+            {
+                if (functions[i].feature != fv.feature)
+                    continue;
+
+                if (!*functions[i].pointer)
+                    *functions[i].pointer = procAddress(std::string(functions[i].name) + (core ? "" : fv.suffix));
+                if (!*functions[i].pointer)
+                    resolved = false;
+            }
+
+            if (resolved)
+                found |= fv.feature;
+        }
+
+        // The instanced text shader is GLSL 1.30
+        const unsigned int instancing = GLFunctions::kShaders | GLFunctions::kBuffers;
+        if (major < 3 || (found & instancing) != instancing)
+            found &= ~GLFunctions::kInstancing;
+
+        return found;
+    }
+}
+
+void GLFunctions::beginDraw(GLContextKey context, bool newContext)
+{
+    currentContext = context;
+    if (!context)
+    {
+        current = 0;
+        return;
+    }
+
+    Lock lock(mutex);
+    std::map<GLContextKey, unsigned int>::iterator it = contexts.find(context);
+    if (it == contexts.end() || newContext)
+        current = contexts[context] = findFeatures();
+    else
+        current = it->second;
+}
+
+bool GLFunctions::has(Feature feature)
+{
+    return (current & feature) != 0;
+}
+
+void GLFunctions::forget(GLContextKey context)
+{
+    Lock lock(mutex);
+    contexts.erase(context);
+    if (context == currentContext)
+        current = 0;
+}
+
+void GLFunctions::clear()
+{
+    Lock lock(mutex);
+    contexts.clear();
+    currentContext = NULL;
+    current = 0;
+}
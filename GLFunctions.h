@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  GLFunctions.h
+//  spReticle
+//
+
+#ifndef spReticle_GLFunctions_h
+#define spReticle_GLFunctions_h
+
+#include <stddef.h>
+
+// Only the OpenGL 1.1 functions are exported by opengl32 on Windows and
+// the system headers of some platforms lack the 3.x names, so everything
+// newer is resolved at run time. Include this header instead of gl.h, and
+// never define GL_GLEXT_PROTOTYPES: the gl* names of the functions below
+// are macros for the resolved pointers.
+#if defined(_WIN32)
+#	include <windows.h>
+#	include <GL/gl.h>
+#elif defined(OSMac_MachO_)
+#	include <OpenGL/gl.h>
+#else
+#	include <GL/gl.h>
+#endif
+
+#include "GLResources.h"
+
+#if defined(_WIN32) || defined(APIENTRY)
+#	define SPGL_APIENTRY APIENTRY
+#else
+#	define SPGL_APIENTRY
+#endif
+
+// Types and enums missing from the OpenGL 1.1 headers
+#ifndef GL_VERSION_1_5
+typedef ptrdiff_t GLsizeiptr;
+typedef ptrdiff_t GLintptr;
+#endif
+#ifndef GL_VERSION_2_0
+typedef char GLchar;
+#endif
+#ifndef GL_VERSION_3_2
+typedef unsigned long long GLuint64;
+#endif
+
+#ifndef GL_CLAMP_TO_EDGE
+#	define GL_CLAMP_TO_EDGE 0x812F
+#endif
+#ifndef GL_GENERATE_MIPMAP
+#	define GL_GENERATE_MIPMAP 0x8191
+#endif
+#ifndef GL_TEXTURE0
+#	define GL_TEXTURE0 0x84C0
+#endif
+#ifndef GL_RGBA32F
+#	define GL_RGBA32F 0x8814
+#endif
+#ifndef GL_QUERY_RESULT
+#	define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#	define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+#ifndef GL_ARRAY_BUFFER
+#	define GL_ARRAY_BUFFER 0x8892
+#endif
+#ifndef GL_STATIC_DRAW
+#	define GL_STATIC_DRAW 0x88E4
+#endif
+#ifndef GL_DYNAMIC_DRAW
+#	define GL_DYNAMIC_DRAW 0x88E8
+#endif
+#ifndef GL_FRAGMENT_SHADER
+#	define GL_FRAGMENT_SHADER 0x8B30
+#endif
+#ifndef GL_VERTEX_SHADER
+#	define GL_VERTEX_SHADER 0x8B31
+#endif
+#ifndef GL_COMPILE_STATUS
+#	define GL_COMPILE_STATUS 0x8B81
+#endif
+#ifndef GL_LINK_STATUS
+#	define GL_LINK_STATUS 0x8B82
+#endif
+#ifndef GL_DRAW_FRAMEBUFFER_BINDING
+#	define GL_DRAW_FRAMEBUFFER_BINDING 0x8CA6
+#endif
+#ifndef GL_DRAW_FRAMEBUFFER
+#	define GL_DRAW_FRAMEBUFFER 0x8CA9
+#endif
+#ifndef GL_FRAMEBUFFER_COMPLETE
+#	define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#endif
+#ifndef GL_COLOR_ATTACHMENT0
+#	define GL_COLOR_ATTACHMENT0 0x8CE0
+#endif
+#ifndef GL_TIMESTAMP
+#	define GL_TIMESTAMP 0x8E28
+#endif
+
+// The functions the plugin uses past OpenGL 1.1, by the feature they
+// belong to. A feature is only available when all of its functions are.
+#define SPGL_FUNCTIONS(F) \
+    F(Multitexture,      void,   ActiveTexture,            (GLenum texture)) \
+    F(BlendFuncSeparate, void,   BlendFuncSeparate,        (GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)) \
+    F(Buffers,           void,   GenBuffers,               (GLsizei n, GLuint *buffers)) \
+    F(Buffers,           void,   DeleteBuffers,            (GLsizei n, const GLuint *buffers)) \
+    F(Buffers,           void,   BindBuffer,               (GLenum target, GLuint buffer)) \
+    F(Buffers,           void,   BufferData,               (GLenum target, GLsizeiptr size, const void *data, GLenum usage)) \
+    F(Shaders,           GLuint, CreateShader,             (GLenum type)) \
+    F(Shaders,           void,   ShaderSource,             (GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length)) \
+    F(Shaders,           void,   CompileShader,            (GLuint shader)) \
+    F(Shaders,           void,   GetShaderiv,              (GLuint shader, GLenum pname, GLint *params)) \
+    F(Shaders,           void,   GetShaderInfoLog,         (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)) \
+    F(Shaders,           void,   DeleteShader,             (GLuint shader)) \
+    F(Shaders,           GLuint, CreateProgram,            (void)) \
+    F(Shaders,           void,   AttachShader,             (GLuint program, GLuint shader)) \
+    F(Shaders,           void,   BindAttribLocation,       (GLuint program, GLuint index, const GLchar *name)) \
+    F(Shaders,           void,   LinkProgram,              (GLuint program)) \
+    F(Shaders,           void,   GetProgramiv,             (GLuint program, GLenum pname, GLint *params)) \
+    F(Shaders,           void,   GetProgramInfoLog,        (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)) \
+    F(Shaders,           void,   DeleteProgram,            (GLuint program)) \
+    F(Shaders,           void,   UseProgram,               (GLuint program)) \
+    F(Shaders,           GLint,  GetUniformLocation,       (GLuint program, const GLchar *name)) \
+    F(Shaders,           void,   Uniform1i,                (GLint location, GLint v0)) \
+    F(Shaders,           void,   VertexAttribPointer,      (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)) \
+    F(Shaders,           void,   EnableVertexAttribArray,  (GLuint index)) \
+    F(Shaders,           void,   DisableVertexAttribArray, (GLuint index)) \
+    F(Framebuffers,      void,   GenFramebuffers,          (GLsizei n, GLuint *framebuffers)) \
+    F(Framebuffers,      void,   DeleteFramebuffers,       (GLsizei n, const GLuint *framebuffers)) \
+    F(Framebuffers,      void,   BindFramebuffer,          (GLenum target, GLuint framebuffer)) \
+    F(Framebuffers,      void,   FramebufferTexture2D,     (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)) \
+    F(Framebuffers,      GLenum, CheckFramebufferStatus,   (GLenum target)) \
+    F(Instancing,        void,   DrawArraysInstanced,      (GLenum mode, GLint first, GLsizei count, GLsizei instancecount)) \
+    F(Instancing,        void,   VertexAttribDivisor,      (GLuint index, GLuint divisor)) \
+    F(TimerQueries,      void,   GenQueries,               (GLsizei n, GLuint *ids)) \
+    F(TimerQueries,      void,   DeleteQueries,            (GLsizei n, const GLuint *ids)) \
+    F(TimerQueries,      void,   QueryCounter,             (GLuint id, GLenum target)) \
+    F(TimerQueries,      void,   GetQueryObjectiv,         (GLuint id, GLenum pname, GLint *params)) \
+    F(TimerQueries,      void,   GetQueryObjectui64v,      (GLuint id, GLenum pname, GLuint64 *params))
+
+#define SPGL_DECLARE(feature, ret, name, args) \
+    typedef ret (SPGL_APIENTRY *spPFNgl##name) args; \
+    extern spPFNgl##name spgl##name;
+
+SPGL_FUNCTIONS(SPGL_DECLARE)
+
+#undef SPGL_DECLARE
+
+#define glActiveTexture            spglActiveTexture
+#define glBlendFuncSeparate        spglBlendFuncSeparate
+#define glGenBuffers               spglGenBuffers
+#define glDeleteBuffers            spglDeleteBuffers
+#define glBindBuffer               spglBindBuffer
+#define glBufferData               spglBufferData
+#define glCreateShader             spglCreateShader
+#define glShaderSource             spglShaderSource
+#define glCompileShader            spglCompileShader
+#define glGetShaderiv              spglGetShaderiv
+#define glGetShaderInfoLog         spglGetShaderInfoLog
+#define glDeleteShader             spglDeleteShader
+#define glCreateProgram            spglCreateProgram
+#define glAttachShader             spglAttachShader
+#define glBindAttribLocation       spglBindAttribLocation
+#define glLinkProgram              spglLinkProgram
+#define glGetProgramiv             spglGetProgramiv
+#define glGetProgramInfoLog        spglGetProgramInfoLog
+#define glDeleteProgram            spglDeleteProgram
+#define glUseProgram               spglUseProgram
+#define glGetUniformLocation       spglGetUniformLocation
+#define glUniform1i                spglUniform1i
+#define glVertexAttribPointer      spglVertexAttribPointer
+#define glEnableVertexAttribArray  spglEnableVertexAttribArray
+#define glDisableVertexAttribArray spglDisableVertexAttribArray
+#define glGenFramebuffers          spglGenFramebuffers
+#define glDeleteFramebuffers       spglDeleteFramebuffers
+#define glBindFramebuffer          spglBindFramebuffer
+#define glFramebufferTexture2D     spglFramebufferTexture2D
+#define glCheckFramebufferStatus   spglCheckFramebufferStatus
+#define glDrawArraysInstanced      spglDrawArraysInstanced
+#define glVertexAttribDivisor      spglVertexAttribDivisor
+#define glGenQueries               spglGenQueries
+#define glDeleteQueries            spglDeleteQueries
+#define glQueryCounter             spglQueryCounter
+#define glGetQueryObjectiv         spglGetQueryObjectiv
+#define glGetQueryObjectui64v      spglGetQueryObjectui64v
+
+// Resolves the functions above and tells which of them a context supports.
+// Code using a feature must check has first and fall back to the OpenGL
+// 1.1 path when it is not available: the pointers are shared by every
+// context and may be set for a feature the current context lacks.
+class GLFunctions
+{
+public:
+    enum Feature
+    {
+        kMultitexture      = 1 << 0,    // 1.3 or ARB_multitexture
+        kBlendFuncSeparate = 1 << 1,    // 1.4 or EXT_blend_func_separate
+        kBuffers           = 1 << 2,    // 1.5 or ARB_vertex_buffer_object
+        kShaders           = 1 << 3,    // 2.0
+        kFramebuffers      = 1 << 4,    // 3.0 or ARB_framebuffer_object
+        kInstancing        = 1 << 5,    // 3.3 or ARB_instanced_arrays and ARB_draw_instanced,
+                                        // with shaders and buffers and GLSL 1.30
+        kTimerQueries      = 1 << 6     // 3.3 or ARB_timer_query
+    };
+
+    // Called by GLResources::beginDraw with the context being drawn. The
+    // functions are resolved and the features of the context are found the
+    // first time it draws, or when it is new in place of a destroyed one.
+    static void beginDraw(GLContextKey context, bool newContext);
+
+    // Whether the context of the last beginDraw on the calling thread
+    // supports the feature
+    static bool has(Feature feature);
+
+    // Forget a destroyed context, or every context
+    static void forget(GLContextKey context);
+    static void clear();
+};
+
+#endif
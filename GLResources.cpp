@@ -0,0 +1,290 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  GLResources.cpp
+//  spReticle
+//
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "GLFunctions.h"
+#include "GLResources.h"
+#include "Lock.h"
+
+// The tests draw in an offscreen OSMesa or EGL context, see test/
+#if defined(SPRETICLE_OSMESA)
+#	include <GL/osmesa.h>
+#elif defined(SPRETICLE_EGL)
+#	include <EGL/egl.h>
+#elif defined(_WIN32)
+	// wglGetCurrentContext comes with windows.h
+#elif defined(OSMac_MachO_)
+#	include <OpenGL/OpenGL.h>
+#else
+#	include <GL/glx.h>
+#endif
+
+GLContextKey currentGLContext()
+{
+#if defined(SPRETICLE_OSMESA)
+    return OSMesaGetCurrentContext();
+#elif defined(SPRETICLE_EGL)
+    return eglGetCurrentContext();
+#elif defined(_WIN32)
+    return wglGetCurrentContext();
+#elif defined(OSMac_MachO_)
+    return CGLGetCurrentContext();
+#else
+    return glXGetCurrentContext();
+#endif
+}
+
+namespace
+{
+    struct Resource
+    {
+        GLResources::Type type;
+        GLuint            name;
+        size_t            bytes;
+    };
+
+    typedef std::pair<const void *, int>      ResourceKey;
+    typedef std::map<ResourceKey, Resource>   ResourceMap;
+
+    struct Context
+    {
+        Context() : sentinel(0) {}
+
+        // A texture created with the first object of the context. If it
+        // does not exist in the current context anymore, the context was
+        // destroyed and its handle reused by a new one.
+        GLuint                sentinel;
+        ResourceMap           resources;
+        std::vector<Resource> released;
+    };
+
+    typedef std::map<GLContextKey, Context> ContextMap;
+
+    // The views of a node may draw on several threads, each in its own
+    // context: the contexts are shared under a lock and the context being
+    // drawn is per thread
+    Mutex                       mutex = SP_MUTEX_INITIALIZER;
+    ContextMap                  contexts;
+    SP_THREAD_LOCAL Context     *current = NULL;
+
+    void deleteResource(const Resource &r)
+    {
+        switch (r.type)
+        {
+            case GLResources::kTexture:
+                glDeleteTextures(1, &r.name);
+                break;
+            case GLResources::kBuffer:
+                glDeleteBuffers(1, &r.name);
+                break;
+            case GLResources::kProgram:
+                glDeleteProgram(r.name);
+                break;
+            case GLResources::kFramebuffer:
+                glDeleteFramebuffers(1, &r.name);
+                break;
+            case GLResources::kQuery:
+                glDeleteQueries(1, &r.name);
+                break;
+        }
+    }
+
+    // Release the objects of owner in the slot, or in every slot if it is
+    // negative
+    void releaseResources(const void *owner, int slot)
+    {
+        GLContextKey key = currentGLContext();
+        Lock lock(mutex);
+
+        for (ContextMap::iterator c = contexts.begin(); c != contexts.end(); ++c)
+        {
+            ResourceMap &resources = c->second.resources;
+            for (ResourceMap::iterator it = resources.begin(); it != resources.end();)
+            {
+                if (it->first.first != owner || (slot >= 0 && it->first.second != slot))
+                {
+                    ++it;
+                    continue;
+                }
+
+                if (c->first == key)
+                    deleteResource(it->second);
+                else
+                    c->second.released.push_back(it->second);
+
+                resources.erase(it++);
+            }
+        }
+    }
+}
+
+void GLResources::beginDraw()
+{
+    GLContextKey key = currentGLContext();
+    if (!key)
+    {
+        GLFunctions::beginDraw(NULL, false);
+        current = NULL;
+        return;
+    }
+
+    Lock lock(mutex);
+    Context &context = contexts[key];
+    current = &context;
+
+    if (context.sentinel && !glIsTexture(context.sentinel))
+    {
+        // Everything died with the previous context
+        context.resources.clear();
+        context.released.clear();
+        context.sentinel = 0;
+    }
+
+    // The entry points and features are looked up again for a new context
+    GLFunctions::beginDraw(key, !context.sentinel);
+
+    if (!context.sentinel)
+    {
+        // Binding creates the texture, keep the binding of the caller
+        glPushAttrib(GL_TEXTURE_BIT);
+        glGenTextures(1, &context.sentinel);
+        glBindTexture(GL_TEXTURE_2D, context.sentinel);
+        glPopAttrib();
+    }
+
+    for (size_t i = 0; i < context.released.size(); i++)
+        deleteResource(context.released[i]);
+    context.released.clear();
+}
+
+GLuint GLResources::find(const void *owner, int slot)
+{
+    if (!current)
+        return 0;
+
+    Lock lock(mutex);
+    ResourceMap::const_iterator it = current->resources.find(ResourceKey(owner, slot));
+    return (it == current->resources.end()) ? 0 : it->second.name;
+}
+
+void GLResources::add(const void *owner, int slot, Type type, GLuint name, size_t bytes)
+{
+    if (!current)
+        return;
+
+    Resource r;
+    r.type  = type;
+    r.name  = name;
+    r.bytes = bytes;
+
+    Lock lock(mutex);
+    current->resources[ResourceKey(owner, slot)] = r;
+}
+
+void GLResources::setBytes(const void *owner, int slot, size_t bytes)
+{
+    if (!current)
+        return;
+
+    Lock lock(mutex);
+    ResourceMap::iterator it = current->resources.find(ResourceKey(owner, slot));
+    if (it != current->resources.end())
+        it->second.bytes = bytes;
+}
+
+void GLResources::release(const void *owner)
+{
+    releaseResources(owner, -1);
+}
+
+void GLResources::release(const void *owner, int slot)
+{
+    releaseResources(owner, slot);
+}
+
+void GLResources::releaseContext()
+{
+    GLContextKey key = currentGLContext();
+    Lock lock(mutex);
+    ContextMap::iterator c = contexts.find(key);
+    if (c == contexts.end())
+        return;
+
+    Context &context = c->second;
+    if (!context.sentinel || glIsTexture(context.sentinel))
+    {
+        for (ResourceMap::iterator it = context.resources.begin(); it != context.resources.end(); ++it)
+            deleteResource(it->second);
+        for (size_t i = 0; i < context.released.size(); i++)
+            deleteResource(context.released[i]);
+        if (context.sentinel)
+            glDeleteTextures(1, &context.sentinel);
+    }
+
+    if (current == &context)
+        current = NULL;
+    GLFunctions::forget(c->first);
+    contexts.erase(c);
+}
+
+void GLResources::clear()
+{
+    Lock lock(mutex);
+    contexts.clear();
+    current = NULL;
+    GLFunctions::clear();
+}
+
+unsigned int GLResources::numContexts()
+{
+    Lock lock(mutex);
+    return (unsigned int)contexts.size();
+}
+
+size_t GLResources::totalBytes()
+{
+    Lock lock(mutex);
+    size_t total = 0;
+    for (ContextMap::const_iterator c = contexts.begin(); c != contexts.end(); ++c)
+        for (ResourceMap::const_iterator it = c->second.resources.begin(); it != c->second.resources.end(); ++it)
+            total += it->second.bytes;
+    return total;
+}
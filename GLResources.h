@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  GLResources.h
+//  spReticle
+//
+
+#ifndef spReticle_GLResources_h
+#define spReticle_GLResources_h
+
+#include <stddef.h>
+
+#if defined(OSMac_MachO_)
+#	include <OpenGL/gl.h>
+#else
+#	include <GL/gl.h>
+#endif
+
+// Identifies an OpenGL context
+typedef const void *GLContextKey;
+
+// The context current on the calling thread, NULL if there is none
+GLContextKey currentGLContext();
+
+// Keeps track of the OpenGL objects of the plugin for every context they
+// were created in. Contexts that do not share objects, like the ones of
+// torn off panels or offscreen playblasts, each get their own objects, and
+// each context creates an object exactly once. The contexts may draw on
+// different threads at the same time: the lookups are in the context of the
+// last beginDraw on the calling thread.
+//
+// Objects are identified by an owner pointer and a slot number. Objects
+// that can be shared by every renderer of a context, like the font atlas
+// textures, are owned by the shared data instead of by a renderer.
+class GLResources
+{
+public:
+    enum Type
+    {
+        kTexture = 0,
+        kBuffer,
+        kProgram,
+        kFramebuffer,
+        kQuery
+    };
+
+    // Called once per draw, before any lookup, in the context being drawn.
+    // Forgets the objects of a destroyed context whose handle was reused
+    // and deletes the objects released while the context was not current.
+    static void beginDraw();
+
+    // The object of owner in the slot in the current context, 0 if it has
+    // not been created in this context yet.
+    static GLuint find(const void *owner, int slot);
+
+    // Register an object created in the current context and the amount of
+    // GPU memory it uses.
+    static void add(const void *owner, int slot, Type type, GLuint name, size_t bytes);
+
+    // Update the amount of memory used by an object, e.g. a resized buffer
+    static void setBytes(const void *owner, int slot, size_t bytes);
+
+    // Release the objects of owner in every context. The objects of other
+    // contexts are deleted the next time these contexts draw.
+    static void release(const void *owner);
+
+    // Release the object of owner in a slot in every context, like release
+    static void release(const void *owner, int slot);
+
+    // Delete every object of the current context
+    static void releaseContext();
+
+    // Forget every object, for plugin unload once releaseContext has been
+    // called in every context that still exists.
+    static void clear();
+
+    // Number of contexts with objects and GPU memory used by all of them
+    static unsigned int numContexts();
+    static size_t totalBytes();
+};
+
+#endif
@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  GLStateCache.cpp
+//  spReticle
+//
+
+#include "GLFunctions.h"
+#include "GLStateCache.h"
+
+GLStateCache::GLStateCache()
+{
+    reset();
+}
+
+void GLStateCache::begin()
+{
+    reset();
+    saveClient(GL_CLIENT_VERTEX_ARRAY_BIT);
+}
+
+void GLStateCache::reset()
+{
+    saved = 0;
+    savedClient = 0;
+    depth = 0;
+    clientDepth = 0;
+
+    for (int i = 0; i < kNumCaps; i++)
+        caps[i] = -1;
+    for (int i = 0; i < 4; i++)
+        blend[i] = GLenum(-1);
+    depthWrite = -1;
+    unpackAlignment = -1;
+    activeUnit = -1;
+    for (int i = 0; i < kMaxUnits; i++)
+    {
+        textures[i] = 0;
+        textureKnown[i] = false;
+    }
+    program = 0;
+    programUsed = false;
+}
+
+void GLStateCache::end()
+{
+    if (programUsed && program != 0)
+        glUseProgram(0);
+
+    while (clientDepth > 0)
+    {
+        glPopClientAttrib();
+        clientDepth--;
+    }
+
+    while (depth > 0)
+    {
+        glPopAttrib();
+        depth--;
+    }
+
+    saved = 0;
+    savedClient = 0;
+}
+
+void GLStateCache::save(GLbitfield group)
+{
+    if (saved & group)
+        return;
+
+    glPushAttrib(group);
+    saved |= group;
+    depth++;
+}
+
+void GLStateCache::saveClient(GLbitfield group)
+{
+    if (savedClient & group)
+        return;
+
+    glPushClientAttrib(group);
+    savedClient |= group;
+    clientDepth++;
+}
+
+void GLStateCache::setEnabled(GLenum cap, bool on)
+{
+    int index;
+    switch (cap)
+    {
+        case GL_BLEND:      index = kBlend;     break;
+        case GL_DEPTH_TEST: index = kDepthTest; break;
+        case GL_TEXTURE_2D: index = kTexture2D; break;
+        default:
+            // Not tracked, always set
+            save(GL_ENABLE_BIT);
+            if (on) glEnable(cap); else glDisable(cap);
+            return;
+    }
+
+    if (caps[index] == int(on))
+        return;
+
+    // GL_TEXTURE_2D is per texture unit, only unit 0 is textured this way
+    if (index == kTexture2D)
+        activeTexture(0);
+
+    save(GL_ENABLE_BIT);
+    if (on) glEnable(cap); else glDisable(cap);
+    caps[index] = int(on);
+}
+
+void GLStateCache::blendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    if (blend[0] == srcRGB && blend[1] == dstRGB && blend[2] == srcAlpha && blend[3] == dstAlpha)
+        return;
+
+    // Without separate functions the alpha is blended like the colors
+    save(GL_COLOR_BUFFER_BIT);
+    if ((srcRGB == srcAlpha && dstRGB == dstAlpha) || !GLFunctions::has(GLFunctions::kBlendFuncSeparate))
+        glBlendFunc(srcRGB, dstRGB);
+    else
+        glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+    blend[0] = srcRGB;
+    blend[1] = dstRGB;
+    blend[2] = srcAlpha;
+    blend[3] = dstAlpha;
+}
+
+void GLStateCache::clearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+    save(GL_COLOR_BUFFER_BIT);
+    glClearColor(r, g, b, a);
+}
+
+void GLStateCache::depthMask(GLboolean mask)
+{
+    if (depthWrite == int(mask))
+        return;
+
+    save(GL_DEPTH_BUFFER_BIT);
+    glDepthMask(mask);
+    depthWrite = int(mask);
+}
+
+void GLStateCache::pixelStore(GLenum pname, GLint param)
+{
+    // Only the unpack alignment is cached
+    if (pname == GL_UNPACK_ALIGNMENT && unpackAlignment == param)
+        return;
+
+    saveClient(GL_CLIENT_PIXEL_STORE_BIT);
+    glPixelStorei(pname, param);
+    if (pname == GL_UNPACK_ALIGNMENT)
+        unpackAlignment = param;
+}
+
+void GLStateCache::bindTexture(unsigned int unit, GLuint texture)
+{
+    if (unit >= kMaxUnits)
+        return;
+
+    if (textureKnown[unit] && textures[unit] == texture)
+        return;
+
+    if (!activeTexture(unit))
+        return;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    textures[unit] = texture;
+    textureKnown[unit] = true;
+}
+
+bool GLStateCache::activeTexture(unsigned int unit)
+{
+    // The texture group holds the active unit and the bindings of every unit
+    save(GL_TEXTURE_BIT);
+
+    if (activeUnit == int(unit))
+        return true;
+
+    // Only unit 0 exists without multitexturing
+    if (!GLFunctions::has(GLFunctions::kMultitexture))
+        return unit == 0;
+
+    glActiveTexture(GL_TEXTURE0 + unit);
+    activeUnit = int(unit);
+    return true;
+}
+
+void GLStateCache::useProgram(GLuint p)
+{
+    if (programUsed && program == p)
+        return;
+
+    // Nothing but the fixed function pipeline without shaders
+    if (!GLFunctions::has(GLFunctions::kShaders))
+        return;
+
+    glUseProgram(p);
+    program = p;
+    programUsed = true;
+}
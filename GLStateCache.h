@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  GLStateCache.h
+//  spReticle
+//
+
+#ifndef spReticle_GLStateCache_h
+#define spReticle_GLStateCache_h
+
+#if defined(OSMac_MachO_)
+#	include <OpenGL/gl.h>
+#else
+#	include <GL/gl.h>
+#endif
+
+// Tracks the OpenGL state changed by the reticle during a draw.
+//
+// The state is never read back with glGet, which needs a round trip to the
+// server on many drivers and with remote rendering. Instead, the first time
+// the reticle changes a state of an attribute group, that group is saved on
+// the attribute stack, and end pops exactly the groups that were pushed. The
+// setters skip calls that would not change the state.
+//
+// The current program is not part of any attribute group. Maya draws
+// locators with no program bound, so end unbinds any program that was used.
+class GLStateCache
+{
+public:
+    GLStateCache();
+
+    // Start tracking. The client vertex arrays are always saved.
+    void begin();
+
+    // Restore the state found by begin
+    void end();
+
+    void enable(GLenum cap) { setEnabled(cap, true); }
+    void disable(GLenum cap) { setEnabled(cap, false); }
+    void blendFunc(GLenum src, GLenum dst) { blendFuncSeparate(src, dst, src, dst); }
+    void blendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+    void clearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a);
+    void depthMask(GLboolean mask);
+    void pixelStore(GLenum pname, GLint param);
+
+    // Bind a 2D texture to a texture unit, 0 being GL_TEXTURE0. Only unit
+    // 0 exists without multitexturing.
+    void bindTexture(unsigned int unit, GLuint texture);
+
+    // Does nothing without shaders
+    void useProgram(GLuint program);
+
+private:
+    // The capabilities the reticle changes
+    enum Cap
+    {
+        kBlend = 0,
+        kDepthTest,
+        kTexture2D,
+        kNumCaps
+    };
+
+    enum { kMaxUnits = 2 };
+
+    void reset();
+    void setEnabled(GLenum cap, bool on);
+    // Returns false if the unit does not exist
+    bool activeTexture(unsigned int unit);
+
+    // Push an attribute group the first time one of its states changes
+    void save(GLbitfield group);
+    void saveClient(GLbitfield group);
+
+    GLbitfield saved;
+    GLbitfield savedClient;
+    int        depth;
+    int        clientDepth;
+
+    // -1 until the reticle sets the state
+    int        caps[kNumCaps];
+    GLenum     blend[4];
+    int        depthWrite;
+    int        unpackAlignment;
+    int        activeUnit;
+    GLuint     textures[kMaxUnits];
+    bool       textureKnown[kMaxUnits];
+    GLuint     program;
+    bool       programUsed;
+};
+
+#endif
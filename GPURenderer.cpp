@@ -39,9 +39,99 @@
 //
 //
 
+#include <iostream>
+
+#if defined(_WIN32)
+#	include <windows.h>
+#elif defined(OSMac_MachO_)
+#	include <sys/time.h>
+#else
+#	include <time.h>
+#endif
+#include <algorithm>
+#include <wchar.h>
+
+#include "defines.h"
+
 #include "GPURenderer.h"
 
-GPURenderer::GPURenderer()
+void RenderStats::reset()
+{
+    frames = 0;
+    lastTime = 0.0;
+    totalTime = 0.0;
+    maxTime = 0.0;
+    lastFrameAt = 0.0;
+    drawCalls = 0;
+    uploadBytes = 0;
+    cachedFrames = 0;
+    skippedFrames = 0;
+    textFrames = 0;
+    gpuFrames = 0;
+    gpuTime = 0.0;
+    gpuMaskTime = 0.0;
+    gpuLineTime = 0.0;
+    gpuTextTime = 0.0;
+}
+
+void RenderStats::addFrame(double seconds)
+{
+    frames++;
+    lastTime = seconds;
+    totalTime += seconds;
+    maxTime = std::max(maxTime, seconds);
+    lastFrameAt = now();
+}
+
+void RenderStats::add(const RenderStats &other)
+{
+    bool later = other.lastFrameAt >= lastFrameAt;
+
+    // The GPU times of the view that last read them back
+    if (other.gpuFrames && (!gpuFrames || later))
+    {
+        gpuTime = other.gpuTime;
+        gpuMaskTime = other.gpuMaskTime;
+        gpuLineTime = other.gpuLineTime;
+        gpuTextTime = other.gpuTextTime;
+    }
+
+    if (other.frames && (!frames || later))
+    {
+        lastTime = other.lastTime;
+        lastFrameAt = other.lastFrameAt;
+        drawCalls = other.drawCalls;
+        uploadBytes = other.uploadBytes;
+    }
+
+    frames += other.frames;
+    totalTime += other.totalTime;
+    maxTime = std::max(maxTime, other.maxTime);
+    cachedFrames += other.cachedFrames;
+    skippedFrames += other.skippedFrames;
+    textFrames += other.textFrames;
+    gpuFrames += other.gpuFrames;
+}
+
+double RenderStats::now()
+{
+#if defined(_WIN32)
+    LARGE_INTEGER count, frequency;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return double(count.QuadPart) / double(frequency.QuadPart);
+#elif defined(OSMac_MachO_)
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+GPURenderer::GPURenderer() : filmback(NULL), lineWidth(1.0f), stats(NULL), gpuTimers(false)
 {
 }
 
@@ -54,3 +144,174 @@ void GPURenderer::setFilmback(Filmback* filmback)
 {
     this->filmback = filmback;
 }
+
+void GPURenderer::setLineWidth(float width)
+{
+    lineWidth = width;
+}
+
+void GPURenderer::prepareForDraw(float portWidth, float portHeight)
+{
+    masks.clear();
+    
+    if (stats)
+    {
+        stats->drawCalls = 0;
+        stats->uploadBytes = 0;
+    }
+}
+
+void GPURenderer::addMaskQuad(double x1, double y1, double x2, double y2,
+                              double x3, double y3, double x4, double y4,
+                              const MColor &color)
+{
+    MaskVertex v;
+    v.r = color.r;
+    v.g = color.g;
+    v.b = color.b;
+    v.a = 1-color.a;
+    
+    v.x = float(x1); v.y = float(y1); masks.push_back(v);
+    v.x = float(x2); v.y = float(y2); masks.push_back(v);
+    v.x = float(x3); v.y = float(y3); masks.push_back(v);
+    v.x = float(x4); v.y = float(y4); masks.push_back(v);
+}
+
+// Given two Geom instances, this calculates the mask area between them.
+//
+void GPURenderer::drawMask( Geom g1, Geom g2, MColor color, bool sides, bool top )
+{
+    if (top)
+    {
+        if ( (g2.y1 - g1.y1) > EPSILON )
+        {
+            // Bottom Mask
+            addMaskQuad( g1.x1, g1.y1, g1.x2, g1.y1, g2.x2, g2.y1, g2.x1, g2.y1, color );
+        }
+        
+        if ( (g1.y2 - g2.y2) > EPSILON )
+        {
+            // Top Mask
+            addMaskQuad( g2.x1, g2.y2, g2.x2, g2.y2, g1.x2, g1.y2, g1.x1, g1.y2, color );
+        }
+    }
+    else
+    {
+        g1.y1 = g2.y1;
+        g1.y2 = g2.y2;
+    }
+    
+    if (sides)
+    {
+        // Left side mask
+        if ((g2.x1 - g1.x1) > EPSILON)
+        {
+            addMaskQuad( g1.x1, g1.y1, g2.x1, g2.y1, g2.x1, g2.y2, g1.x1, g1.y2, color );
+        }
+        
+        // right side mask
+        if ((g1.x2 - g2.x2) > EPSILON)
+        {
+            addMaskQuad( g2.x2, g2.y1, g1.x2, g1.y1, g1.x2, g1.y2, g2.x2, g2.y2, color );
+        }
+    }
+}
+
+void GPURenderer::flushMasks()
+{
+    if (masks.empty())
+        return;
+    
+    drawMaskBatch(masks);
+    masks.clear();
+}
+
+// Look up the glyphs of the string, measure it to align it and place every
+// glyph, the same way for every renderer.
+//
+bool GPURenderer::layoutText(const FontAtlas *atlas, const TextData *td, double tx, double ty,
+                             std::vector<PlacedGlyph> &glyphs, double &scale)
+{
+    glyphs.clear();
+    
+    // Get the specified font;
+    int fontIndex = atlas->findFont(td->textBold);
+    if (fontIndex < 0)
+        return false;
+    
+    const FontFileFont &font = atlas->font(fontIndex);
+    
+    double screenScaleFactor = (td->textScale) ? filmback->filmbackGeom.x/1280.0f : 1.0f;
+    scale = (double(td->textSize) / double(font.size)) * screenScaleFactor;
+    
+    // Get wchar pointer to text
+    const wchar_t *textPtr = td->textStr.asWChar();
+    int numChars = int(wcslen(textPtr));
+    
+    // Build glyph array to calculate width and then draw. The kerning is
+    // kept in the x of every glyph until the pen positions are known.
+    float textWidth = 0.0f;
+    float textHeight = 0.0f;
+    glyphs.resize(numChars);
+    
+    for (int i = 0; i < numChars; i++) {
+        const FontFileGlyph *glyph = glyphs[i].glyph = atlas->findGlyph(fontIndex, textPtr[i]);
+        if (!glyph) {
+            std::cout << "Unable to find font character for '" << textPtr[i] << "' for size " << font.size << std::endl;
+            glyphs.clear();
+            return false;
+        }
+        
+        textWidth += glyph->advance_x;
+        textHeight = std::max(textHeight,float(glyph->height));
+        
+        if (i > 0 && glyph->numKerning) {
+            glyphs[i].x = atlas->kerning(glyph, textPtr[i-1]);
+            textWidth += glyphs[i].x;
+        }
+        else
+            glyphs[i].x = 0.0;
+    }
+    
+    // Scale textWidth based upon the fontScaleFactor;
+    textWidth *= scale;
+    textHeight *= scale;
+    
+    // Adjust tx for text alignment
+    switch (td->textAlign) {
+        case 1:
+            tx -= textWidth / 2.0f;
+            break;
+        case 2:
+            tx -= textWidth;
+            break;
+    }
+    
+    // Adjust ty for text alignment
+    switch (td->textVAlign) {
+        case 1:
+            ty -= textHeight / 2.0f;
+            break;
+        case 2:
+            ty -= textHeight;
+            break;
+    }
+    
+    // Adjust text position to account for screen scaling
+    tx += td->textPosX*screenScaleFactor;
+    ty += td->textPosY*screenScaleFactor;
+    
+    // Pen positions
+    for (int i = 0; i < numChars; i++) {
+        const FontFileGlyph *glyph = glyphs[i].glyph;
+        double kerning = glyphs[i].x;
+        
+        glyphs[i].x = tx + kerning * scale;
+        glyphs[i].y = ty;
+        
+        tx += (glyph->advance_x + kerning) * scale;
+        ty += glyph->advance_y * scale;
+    }
+    
+    return true;
+}
@@ -42,7 +42,84 @@
 #ifndef spReticle_GPURenderer_h
 #define spReticle_GPURenderer_h
 
+#include <vector>
+
 #include "util.h"
+#include "FontAtlas.h"
+
+// A screen space mask vertex. Every vertex carries its own color so that all
+// of the masks of a frame can be drawn with a single call.
+class MaskVertex
+{
+public:
+    float x, y;
+    float r, g, b, a;
+};
+
+// Mask quads, four vertices per quad in drawing order
+typedef std::vector<MaskVertex> MaskBatch;
+
+// Counters of the frames drawn by a view of a reticle, added up over the
+// views by the spReticleLocStats command. The renderers fill in the calls
+// and uploads of the last frame, drawReticle times the whole frame. Views
+// drawing at the same time must not share statistics.
+class RenderStats
+{
+public:
+    RenderStats() { reset(); }
+    
+    void reset();
+    
+    // Add a frame that took the given number of seconds
+    void addFrame(double seconds);
+    
+    // Add the counters of another view. The last frame values are the ones
+    // of the view that drew last.
+    void add(const RenderStats &other);
+    
+    // Seconds since an arbitrary point, for timing
+    static double now();
+    
+    unsigned int frames;
+    double       lastTime;
+    double       totalTime;
+    double       maxTime;
+    
+    // When the last frame was added, see now()
+    double       lastFrameAt;
+    
+    // Draw calls and bytes uploaded to the GPU in the last frame
+    unsigned int drawCalls;
+    size_t       uploadBytes;
+    
+    // Frames drawn from the reticle cache, see OpenGLRenderer::drawCached
+    unsigned int cachedFrames;
+    
+    // Frames whose inputs were the same as the previous frame of the view,
+    // drawn again with GPURenderer::redraw without being computed
+    unsigned int skippedFrames;
+    
+    // Frames whose geometry was the same as the previous frame of the view,
+    // of which only the text was drawn, see GPURenderer::redrawGeometry
+    unsigned int textFrames;
+    
+    // GPU time of the last timed frame, in seconds, when GPU timers are on.
+    // The phases are 0 for frames composited from the cache.
+    unsigned int gpuFrames;
+    double       gpuTime;
+    double       gpuMaskTime;
+    double       gpuLineTime;
+    double       gpuTextTime;
+};
+
+// A glyph of a laid out string and its pen position in screen space,
+// kerning included
+class PlacedGlyph
+{
+public:
+    const FontFileGlyph *glyph;
+    double x, y;
+};
 
 class GPURenderer
 {
@@ -50,14 +127,41 @@ class GPURenderer
         GPURenderer();
         virtual ~GPURenderer() =0;
     
-        virtual void prepareForDraw(float portWidth, float portHeight) {};
+        // Subclasses must call the base implementation
+        virtual void prepareForDraw(float portWidth, float portHeight);
         virtual void postDraw() {};
     
+        // Draw the last recorded frame again in a port of the given size,
+        // without recording it. Returns false if the renderer cannot, in
+        // which case the frame must be recorded again.
+        virtual bool redraw(float /*portWidth*/, float /*portHeight*/) { return false; }
+    
+        // Start a frame that keeps the masks and lines of the last recorded
+        // frame. Only text is drawn before postDraw. Returns false if the
+        // renderer cannot, in which case the whole frame must be recorded.
+        virtual bool redrawGeometry(float /*portWidth*/, float /*portHeight*/) { return false; }
+    
         // Set the filmback
         virtual void setFilmback(Filmback* filmback);
     
-        // Given two Geom instances, this renders the mask area between them.
-        virtual void drawMask( Geom g1, Geom g2, MColor color, bool sides, bool top=true ) =0;
+        // Set the width, in pixels, of all of the lines drawn afterwards
+        virtual void setLineWidth(float width);
+    
+        // Set the counters of the frames drawn afterwards, NULL for none
+        void setStats(RenderStats *stats) { this->stats = stats; }
+        RenderStats *getStats() const { return stats; }
+    
+        // Measure the GPU time of the frames, when the renderer can
+        void setGPUTimers(bool enable) { gpuTimers = enable; }
+    
+        // Given two Geom instances, this adds the mask area between them to
+        // the mask batch.
+        void drawMask( Geom g1, Geom g2, MColor color, bool sides, bool top=true );
+    
+        // Draw all of the masks added since the last flush, in the order in
+        // which they were added. drawReticle calls this once, after the last
+        // mask and before any line or text, so that blending stays correct.
+        void flushMasks();
     
         // This draws a single line between the specified points.
         virtual void drawLine(double x1, double x2, double y1, double y2,
@@ -70,7 +174,7 @@ class GPURenderer
         virtual void drawLines( Geom g, MColor color, bool sides, bool stipple) =0;
     
         // This function is responsible for rendering text.
-        virtual void drawText(TextData *td, double tx, double ty) =0;
+        virtual void drawText(const TextData *td, double tx, double ty) =0;
         
         // Make sure everything is ready for text drawing
         virtual void enableTextRendering() {};
@@ -79,8 +183,31 @@ class GPURenderer
         virtual void disableTextRendering() {};
     
     protected:
+        // Draw a batch of mask quads with a single call
+        virtual void drawMaskBatch(const MaskBatch &batch) =0;
+    
+        // Place the glyphs of td with the fonts of atlas, aligned and offset
+        // as set in td. scale is the font scale factor, from font units to
+        // pixels. Returns false if the font or one of the glyphs is missing.
+        bool layoutText(const FontAtlas *atlas, const TextData *td, double tx, double ty,
+                        std::vector<PlacedGlyph> &glyphs, double &scale);
+    
         // The filmback of the camera
         Filmback *filmback;
+    
+        // The line width in pixels
+        float lineWidth;
+    
+        // The counters of the frame, may be NULL
+        RenderStats *stats;
+        bool gpuTimers;
+    
+    private:
+        void addMaskQuad(double x1, double y1, double x2, double y2,
+                         double x3, double y3, double x4, double y4,
+                         const MColor &color);
+    
+        MaskBatch masks;
 };
 
 #endif
@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Lock.h
+//  spReticle
+//
+
+#ifndef spReticle_Lock_h
+#define spReticle_Lock_h
+
+#if defined(_WIN32)
+#	include <windows.h>
+#else
+#	include <pthread.h>
+#endif
+
+// Viewport 2.0 may draw the views of a node on several threads at once, so
+// the state shared by the renderers is either kept per thread or guarded by
+// a static mutex.
+#if defined(_WIN32)
+#	define SP_THREAD_LOCAL     __declspec(thread)
+typedef SRWLOCK Mutex;
+#	define SP_MUTEX_INITIALIZER SRWLOCK_INIT
+#else
+#	define SP_THREAD_LOCAL     __thread
+typedef pthread_mutex_t Mutex;
+#	define SP_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#endif
+
+// Holds a mutex for the scope of the lock
+class Lock
+{
+public:
+#if defined(_WIN32)
+    explicit Lock(Mutex &mutex) : mutex(mutex) { AcquireSRWLockExclusive(&mutex); }
+    ~Lock() { ReleaseSRWLockExclusive(&mutex); }
+#else
+    explicit Lock(Mutex &mutex) : mutex(mutex) { pthread_mutex_lock(&mutex); }
+    ~Lock() { pthread_mutex_unlock(&mutex); }
+#endif
+
+private:
+    Lock(const Lock &);
+    Lock &operator=(const Lock &);
+
+    Mutex &mutex;
+};
+
+#endif
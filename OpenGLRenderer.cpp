@@ -39,53 +39,369 @@
 //
 //
 
-#include "font.h"
+#include <math.h>
 
 #include "OpenGLRenderer.h"
 
-OpenGLRenderer::OpenGLRenderer()
-{
-     // Populate fontMap
-     FontData *fd;
-     for (int fontIndex = 0; fontIndex < NUM_FONTS; fontIndex++) {
-         TextureFont *font = fonts[fontIndex];
-         int size = int(font->size);
-         
-         // Check to see if we already have a font for this size
-         FontMap::iterator it = fontMap.find(size);
-         if (it == fontMap.end()) {
-             fd = new FontData(size);
-             fontMap[size] = fd;
-         }
-         else
-             fd = fontMap[size];
-         
-         if (font->bold) {
-             fd->bold = font;
-             if (!fd->generic)
-             fd->generic = font;
-         }
-         else {
-             fd->normal = font;
-             fd->generic = font;
-         }
-         
-         // Populate glyphMap based on wchar_t
-         for (unsigned int glyphIndex = 0; glyphIndex < font->glyphs_count;glyphIndex++) {
-             TextureGlyph *glyph = &font->glyphs[glyphIndex];
-             font->glyphMap[glyph->charcode] = glyph;
-         }
-     }
+#define BUFFER_OFFSET(i) ((char *)NULL + (i))
+
+// Generic vertex attribute holding the line distance and dash period. 6 does
+// not alias any of the fixed function attributes on any driver.
+#define LINE_ATTRIB 6
+
+// First of the three generic vertex attributes of the glyph instances
+#define TEXT_ATTRIB 5
+
+// The objects shared by every renderer of a context are registered in
+// GLResources with this owner.
+static const char sharedResources = 0;
+
+enum SharedResource
+{
+    kLineProgram = 0,
+    kTextProgram,
+    kGlyphCorners,
+    kGlyphMetrics,
+    kSdfAtlas,
+    kAlphaAtlas
+};
+
+static const char *lineVertexShader =
+    "#version 120\n"
+    "attribute vec2 lineData;\n"
+    "varying vec2 line;\n"
+    "void main()\n"
+    "{\n"
+    "    line = lineData;\n"
+    "    gl_FrontColor = gl_Color;\n"
+    "    gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;\n"
+    "}\n";
+
+// line.x is the distance along the line and line.y the dash period. The
+// first half of every period is drawn, like the 0x00FF stipple pattern.
+static const char *lineFragmentShader =
+    "#version 120\n"
+    "varying vec2 line;\n"
+    "void main()\n"
+    "{\n"
+    "    if (line.y > 0.0 && mod(line.x, line.y) >= 0.5 * line.y)\n"
+    "        discard;\n"
+    "    gl_FragColor = gl_Color;\n"
+    "}\n";
+
+// The glyph metrics texture has one row per glyph: the texture coordinates
+// (u0, v0, u1, v1) and the geometry (offset_x, offset_y, width, height) in
+// font units. gl_Vertex holds the corner of the glyph quad.
+static const char *textVertexShader =
+    "#version 130\n"
+    "uniform sampler2D glyphMetrics;\n"
+    "in vec2 glyphPen;\n"
+    "in vec4 glyphColor;\n"
+    "in vec2 glyphData;\n"
+    "out vec2 uv;\n"
+    "out vec4 color;\n"
+    "void main()\n"
+    "{\n"
+    "    int index = int(glyphData.y);\n"
+    "    vec4 tex = texelFetch(glyphMetrics, ivec2(0, index), 0);\n"
+    "    vec4 geom = texelFetch(glyphMetrics, ivec2(1, index), 0);\n"
+    "    vec2 corner = gl_Vertex.xy;\n"
+    "    vec2 pos = glyphPen + vec2(geom.x + corner.x * geom.z,\n"
+    "                               geom.y - (1.0 - corner.y) * geom.w) * glyphData.x;\n"
+    "    uv = vec2(mix(tex.x, tex.z, corner.x), mix(tex.w, tex.y, corner.y));\n"
+    "    color = glyphColor;\n"
+    "    gl_Position = gl_ModelViewProjectionMatrix * vec4(pos, 0.0, 1.0);\n"
+    "}\n";
+
+// glyphAtlas is the signed distance field atlas, 0.5 on the glyph outlines.
+// The edge is smoothed over about one screen pixel whatever the text size.
+static const char *textFragmentShader =
+    "#version 130\n"
+    "uniform sampler2D glyphAtlas;\n"
+    "in vec2 uv;\n"
+    "in vec4 color;\n"
+    "void main()\n"
+    "{\n"
+    "    float d = texture(glyphAtlas, uv).a;\n"
+    "    float w = fwidth(d) * 0.5;\n"
+    "    float a = smoothstep(0.5 - w, 0.5 + w, d);\n"
+    "    gl_FragColor = vec4(color.rgb, color.a * a);\n"
+    "}\n";
+
+static GLuint compileShader(GLenum type, const char *source)
+{
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    
+    GLint compiled = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (!compiled) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        std::cout << "spReticleLoc: unable to compile shader: " << log << std::endl;
+        glDeleteShader(shader);
+        return 0;
+    }
+    
+    return shader;
+}
+
+// Compile and link a program, binding the given attribute names to
+// consecutive generic attribute locations starting at firstAttrib.
+//
+static GLuint buildProgram(const char *vsSource, const char *fsSource,
+                           GLuint firstAttrib, int numAttribs, const char **attribs)
+{
+    GLuint vs = compileShader(GL_VERTEX_SHADER, vsSource);
+    GLuint fs = compileShader(GL_FRAGMENT_SHADER, fsSource);
+    if (!vs || !fs) {
+        if (vs) glDeleteShader(vs);
+        if (fs) glDeleteShader(fs);
+        return 0;
+    }
+    
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    for (int i = 0; i < numAttribs; i++)
+        glBindAttribLocation(program, firstAttrib + i, attribs[i]);
+    glLinkProgram(program);
+    
+    // The program keeps the shaders alive as long as it needs them
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    
+    GLint linked = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        char log[1024];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        std::cout << "spReticleLoc: unable to link shader: " << log << std::endl;
+        glDeleteProgram(program);
+        return 0;
+    }
+    
+    return program;
+}
+
+void OpenGLRenderer::VertexBatch::add(double x, double y, const float *color)
+{
+    vertices.push_back(GLfloat(x));
+    vertices.push_back(GLfloat(y));
+    vertices.insert(vertices.end(), color, color+4);
+}
+
+void OpenGLRenderer::VertexBatch::add(double x, double y, float u, float v, const float *color)
+{
+    vertices.push_back(GLfloat(x));
+    vertices.push_back(GLfloat(y));
+    vertices.insert(vertices.end(), color, color+4);
+    vertices.push_back(u);
+    vertices.push_back(v);
+}
+
+const char *OpenGLRenderer::VertexBatch::upload()
+{
+    // Vertex arrays in client memory are OpenGL 1.1
+    if (!GLFunctions::has(GLFunctions::kBuffers))
+        return (const char *) &vertices[0];
+    
+    GLContextKey context = currentGLContext();
+    GLuint id = GLResources::find(this, 0);
+    
+    if (!id) {
+        glGenBuffers(1, &id);
+        GLResources::add(this, 0, GLResources::kBuffer, id, 0);
+        uploadedContext = NULL;
+    }
+    
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    
+    // Nothing to do if the layout has not changed since the last draw in
+    // this context
+    if (context == uploadedContext && vertices == uploaded)
+        return BUFFER_OFFSET(0);
+    
+    size_t bytes = vertices.size() * sizeof(GLfloat);
+    glBufferData(GL_ARRAY_BUFFER, bytes, &vertices[0], GL_DYNAMIC_DRAW);
+    GLResources::setBytes(this, 0, bytes);
+    uploadBytes += bytes;
+    
+    uploaded.assign(vertices.begin(), vertices.end());
+    uploadedContext = context;
+    return BUFFER_OFFSET(0);
+}
+
+bool OpenGLRenderer::VertexBatch::unchanged(GLContextKey context) const
+{
+    return context == uploadedContext && vertices == uploaded;
+}
+
+// An empty batch draws nothing, but still counts as uploaded so that the
+// next frame can tell it was empty
+//
+void OpenGLRenderer::VertexBatch::drawEmpty()
+{
+    uploaded.clear();
+    uploadedContext = currentGLContext();
+}
+
+void OpenGLRenderer::VertexBatch::draw(GLenum mode, GLint attrib)
+{
+    if (vertices.empty()) {
+        drawEmpty();
+        return;
+    }
+    
+    const char *base = upload();
+    
+    GLsizei stride = components() * sizeof(GLfloat);
+    
+    glVertexPointer(2, GL_FLOAT, stride, base);
+    glColorPointer(4, GL_FLOAT, stride, base + 2 * sizeof(GLfloat));
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    
+    if (extended && attrib >= 0)
+    {
+        glVertexAttribPointer(attrib, 2, GL_FLOAT, GL_FALSE, stride, base + 6 * sizeof(GLfloat));
+        glEnableVertexAttribArray(attrib);
+    }
+    else if (extended)
+    {
+        glTexCoordPointer(2, GL_FLOAT, stride, base + 6 * sizeof(GLfloat));
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    }
+    
+    glDrawArrays(mode, 0, count());
+    drawCalls++;
+    
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_COLOR_ARRAY);
+    if (extended && attrib >= 0)
+        glDisableVertexAttribArray(attrib);
+    else if (extended)
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+}
+
+void OpenGLRenderer::VertexBatch::drawInstanced(GLenum mode, GLsizei verticesPerInstance, GLuint attrib)
+{
+    if (vertices.empty()) {
+        drawEmpty();
+        return;
+    }
+    
+    const char *base = upload();
+    
+    GLsizei stride = components() * sizeof(GLfloat);
+    const GLint sizes[3]   = { 2, 4, 2 };
+    const GLint offsets[3] = { 0, 2, 6 };
+    int numAttribs = extended ? 3 : 2;
+    
+    for (int i = 0; i < numAttribs; i++) {
+        glVertexAttribPointer(attrib+i, sizes[i], GL_FLOAT, GL_FALSE, stride, base + offsets[i] * sizeof(GLfloat));
+        glVertexAttribDivisor(attrib+i, 1);
+        glEnableVertexAttribArray(attrib+i);
+    }
+    
+    glDrawArraysInstanced(mode, 0, verticesPerInstance, count());
+    drawCalls++;
+    
+    for (int i = 0; i < numAttribs; i++) {
+        glVertexAttribDivisor(attrib+i, 0);
+        glDisableVertexAttribArray(attrib+i);
+    }
+}
+
+OpenGLRenderer::OpenGLRenderer() :
+    lineBatch(true), glyphBatch(true), lineProgramFailed(false),
+    glyphInstances(true), instancedText(false), textProgramFailed(false), textEnabled(false),
+    viewWidth(0), viewHeight(0), cacheWidth(0), cacheHeight(0), cachedContext(NULL),
+    cacheValid(false), cacheFailed(false), compositeBatch(true),
+    timerFrame(NULL), timerQueries(0)
+{
+    atlas = FontRegistry::acquire();
 }
 
 OpenGLRenderer::~OpenGLRenderer()
 {
+    GLResources::release(this);
+    FontRegistry::release();
 }
 
 void OpenGLRenderer::prepareForDraw(float portWidth, float portHeight)
 {
-    // Store all of the openGL attribute settings
-    glPushAttrib(GL_COLOR_BUFFER_BIT | GL_ENABLE_BIT);
+    GPURenderer::prepareForDraw(portWidth, portHeight);
+    viewWidth = portWidth;
+    viewHeight = portHeight;
+    
+    // Look up the objects of the context being drawn
+    GLResources::beginDraw();
+    
+    // Start recording a new frame
+    maskBatch.clear();
+    lineBatch.clear();
+    glyphBatch.clear();
+    glyphInstances.clear();
+    compositeBatch.clear();
+    textEnabled = false;
+    
+    beginFrame(portWidth, portHeight);
+}
+
+// The batches still hold the last frame: set up the state and draw them as
+// postDraw does, from the cache texture when it is current.
+//
+bool OpenGLRenderer::redraw(float portWidth, float portHeight)
+{
+    if (portWidth != viewWidth || portHeight != viewHeight)
+        return false;
+    
+    GPURenderer::prepareForDraw(portWidth, portHeight);
+    
+    GLResources::beginDraw();
+    
+    maskBatch.restart();
+    lineBatch.restart();
+    glyphBatch.restart();
+    glyphInstances.restart();
+    compositeBatch.clear();
+    
+    beginFrame(portWidth, portHeight);
+    postDraw();
+    
+    return true;
+}
+
+// Like redraw, but the glyphs are cleared for the text of the frame to be
+// recorded before postDraw. Only they are uploaded again.
+//
+bool OpenGLRenderer::redrawGeometry(float portWidth, float portHeight)
+{
+    if (portWidth != viewWidth || portHeight != viewHeight)
+        return false;
+    
+    GPURenderer::prepareForDraw(portWidth, portHeight);
+    
+    GLResources::beginDraw();
+    
+    maskBatch.restart();
+    lineBatch.restart();
+    glyphBatch.clear();
+    glyphInstances.clear();
+    compositeBatch.clear();
+    textEnabled = false;
+    
+    beginFrame(portWidth, portHeight);
+    
+    return true;
+}
+
+void OpenGLRenderer::beginFrame(float portWidth, float portHeight)
+{
+    // Only the state changed below is saved, without reading it back
+    state.begin();
     
     // Go into 2D ortho mode
     glMatrixMode( GL_MODELVIEW );
@@ -103,31 +419,27 @@ void OpenGLRenderer::prepareForDraw(float portWidth, float portHeight)
     glLoadIdentity();
     
     // Turn on openGL blending for transparency
-    glEnable(GL_BLEND);
-    
-    // Store the current blend types
-    glGetIntegerv(GL_BLEND_SRC, & blendAttrs[0]);
-    glGetIntegerv(GL_BLEND_DST, & blendAttrs[1]);
-    
-    // Set the blending function
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    state.enable(GL_BLEND);
+    state.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     
     // Disable Depth testing
-    glDisable( GL_DEPTH_TEST );
-    glDepthMask( GL_FALSE );
+    state.disable(GL_DEPTH_TEST);
+    state.depthMask(GL_FALSE);
 }
 
 void OpenGLRenderer::postDraw()
 {
-    // Turn on z-depth test
-    glDepthMask( GL_TRUE );
-    glEnable( GL_DEPTH_TEST );
-    
-    // Turn off blending
-    glDisable(GL_BLEND);
-    
-    // Restore blend settings
-    glBlendFunc(blendAttrs[0], blendAttrs[1]);
+    // Draw everything that was recorded: masks first, then lines and text
+    // on top of them. The text is always drawn directly.
+    flushMasks();
+    
+    beginTimer();
+    bool cached = drawCached();
+    if (!cached)
+        drawGeometryBatches();
+    drawTextBatches();
+    endTimer();
+    countFrame(cached);
     
     // Restore matrix
     glMatrixMode( GL_PROJECTION );
@@ -135,229 +447,431 @@ void OpenGLRenderer::postDraw()
     glMatrixMode( GL_MODELVIEW );
     glPopMatrix();
     
-    // Restore all attributes
-    glPopAttrib();    
+    // Restore the state saved by the state cache, including the blending,
+    // depth and buffer bindings
+    state.end();
 }
 
-// Given two Geom instances, this calculates the mask area between them.
-//
-void OpenGLRenderer::drawMask( Geom g1, Geom g2, MColor color, bool sides, bool top=true )
+void OpenGLRenderer::drawGeometryBatches()
 {
-    glBegin( GL_QUADS );
-    
-    glColor4f( color.r, color.g, color.b, 1-color.a );
+    maskBatch.draw(GL_QUADS);
+    markTimer();
     
-    if (top)
+    if (lineBatch.count())
     {
-        if ( (g2.y1 - g1.y1) > EPSILON )
-        {
-            // Bottom Mask
-            glVertex2d( g1.x1, g1.y1 );
-            glVertex2d( g1.x2, g1.y1 );
-            glVertex2d( g2.x2, g2.y1 );
-            glVertex2d( g2.x1, g2.y1 );
-        }
-        
-        if ( (g1.y2 - g2.y2) > EPSILON )
+        GLuint program = lineProgram();
+        if (program)
         {
-            // Top Mask
-            glVertex2d( g2.x1, g2.y2 );
-            glVertex2d( g2.x2, g2.y2 );
-            glVertex2d( g1.x2, g1.y2 );
-            glVertex2d( g1.x1, g1.y2 );
+            state.useProgram(program);
+            lineBatch.draw(GL_QUADS, LINE_ATTRIB);
         }
+        else
+            lineBatch.draw(GL_QUADS);
     }
-    else
+    
+    markTimer();
+}
+
+void OpenGLRenderer::drawTextBatches()
+{
+    state.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    
+    if (textEnabled && glyphInstances.count())
     {
-        g1.y1 = g2.y1;
-        g1.y2 = g2.y2;
+        // One instanced draw for every character on screen
+        state.bindTexture(1, GLResources::find(&sharedResources, kGlyphMetrics));
+        state.bindTexture(0, GLResources::find(&sharedResources, kSdfAtlas));
+        
+        glBindBuffer( GL_ARRAY_BUFFER, GLResources::find(&sharedResources, kGlyphCorners) );
+        glVertexPointer( 2, GL_FLOAT, 0, BUFFER_OFFSET(0) );
+        glEnableClientState( GL_VERTEX_ARRAY );
+        
+        state.useProgram(GLResources::find(&sharedResources, kTextProgram));
+        glyphInstances.drawInstanced( GL_TRIANGLE_STRIP, 4, TEXT_ATTRIB );
+        
+        glDisableClientState( GL_VERTEX_ARRAY );
     }
     
-    if (sides)
+    if (textEnabled && glyphBatch.count())
     {
-        // Left side mask
-        if ((g2.x1 - g1.x1) > EPSILON)
-        {
-            glVertex2d( g1.x1, g1.y1 );
-            glVertex2d( g2.x1, g2.y1 );
-            glVertex2d( g2.x1, g2.y2 );
-            glVertex2d( g1.x1, g1.y2 );
-        }
-        
-        // right side mask
-        if ((g1.x2 - g2.x2) > EPSILON)
-        {
-            glVertex2d( g2.x2, g2.y1 );
-            glVertex2d( g1.x2, g1.y1 );
-            glVertex2d( g1.x2, g1.y2 );
-            glVertex2d( g2.x2, g2.y2 );
-        }
+        state.useProgram(0);
+        state.enable(GL_TEXTURE_2D);
+        state.bindTexture(0, GLResources::find(&sharedResources, kAlphaAtlas));
+        glyphBatch.draw(GL_QUADS);
+    }
+}
+
+void OpenGLRenderer::countFrame(bool cached)
+{
+    if (!stats)
+        return;
+    
+    const VertexBatch *batches[] = { &maskBatch, &lineBatch, &glyphBatch, &glyphInstances, &compositeBatch };
+    for (size_t i = 0; i < sizeof(batches) / sizeof(batches[0]); i++) {
+        stats->drawCalls += batches[i]->drawCalls;
+        stats->uploadBytes += batches[i]->uploadBytes;
     }
     
-    glEnd();
+    // The masks and lines were composited without being drawn
+    if (cached && maskBatch.drawCalls == 0 && lineBatch.drawCalls == 0)
+        stats->cachedFrames++;
 }
 
-// This draws a single line between the specified points.
-//
-void OpenGLRenderer::drawLine(double x1, double x2, double y1, double y2,
-                            MColor color, bool stipple)
+void OpenGLRenderer::beginTimer()
 {
-    if (stipple)
-    {
-        glEnable (GL_LINE_STIPPLE);
-        glLineStipple(2,0x00FF);
+    timerFrame = NULL;
+    if (!gpuTimers || !stats)
+        return;
+    
+    GLContextKey context = currentGLContext();
+    
+    // The queries are created once per context, timestamps need OpenGL 3.3
+    if (!GLResources::find(this, kTimerQueries)) {
+        if (!GLFunctions::has(GLFunctions::kTimerQueries))
+            return;
+        
+        GLuint queries[GPU_TIMER_FRAMES * kTimerMarks];
+        glGenQueries( GPU_TIMER_FRAMES * kTimerMarks, queries );
+        for (int i = 0; i < GPU_TIMER_FRAMES * kTimerMarks; i++)
+            GLResources::add(this, kTimerQueries + i, GLResources::kQuery, queries[i], 0);
+        
+        timerRings[context] = TimerRing();
     }
     
-    glBegin( GL_LINES );
+    TimerRing &ring = timerRings[context];
+    readTimers(ring);
     
-    glColor4f( color.r, color.g, color.b, 1-color.a );
+    // Skip the frame rather than wait when the GPU is that far behind
+    TimerFrame &frame = ring.frames[ring.next];
+    if (frame.pending)
+        return;
     
-    glVertex2d( x1, y1 );
-    glVertex2d( x2, y2 );
+    timerFrame = &frame;
+    timerFrame->numMarks = 0;
+    timerQueries = kTimerQueries + ring.next * kTimerMarks;
+    ring.next = (ring.next + 1) % GPU_TIMER_FRAMES;
     
-    glEnd();
+    markTimer();
+}
+
+void OpenGLRenderer::markTimer()
+{
+    if (!timerFrame || timerFrame->numMarks == kTimerMarks)
+        return;
+    
+    glQueryCounter( GLResources::find(this, timerQueries + timerFrame->numMarks), GL_TIMESTAMP );
+    timerFrame->numMarks++;
+}
+
+void OpenGLRenderer::endTimer()
+{
+    if (!timerFrame)
+        return;
+    
+    // The end always takes the last query
+    timerFrame->numMarks = std::min(timerFrame->numMarks, int(kTimerMarks) - 1);
+    markTimer();
+    timerFrame->pending = true;
+    timerFrame = NULL;
+}
+
+// Oldest first, so the stats end up with the latest frame
+//
+void OpenGLRenderer::readTimers(TimerRing &ring)
+{
+    for (int i = 0; i < GPU_TIMER_FRAMES; i++) {
+        unsigned int slot = (ring.next + i) % GPU_TIMER_FRAMES;
+        TimerFrame &frame = ring.frames[slot];
+        if (!frame.pending)
+            continue;
+        
+        int first = kTimerQueries + slot * kTimerMarks;
+        GLint available = 0;
+        glGetQueryObjectiv( GLResources::find(this, first + frame.numMarks - 1), GL_QUERY_RESULT_AVAILABLE, &available );
+        if (!available)
+            continue;
+        
+        GLuint64 t[kTimerMarks];
+        for (int m = 0; m < frame.numMarks; m++)
+            glGetQueryObjectui64v( GLResources::find(this, first + m), GL_QUERY_RESULT, &t[m] );
+        frame.pending = false;
+        
+        stats->gpuFrames++;
+        stats->gpuTime = (t[frame.numMarks-1] - t[0]) * 1e-9;
+        if (frame.numMarks == kTimerMarks) {
+            stats->gpuMaskTime = (t[1] - t[0]) * 1e-9;
+            stats->gpuLineTime = (t[2] - t[1]) * 1e-9;
+            stats->gpuTextTime = (t[3] - t[2]) * 1e-9;
+        }
+        else
+            stats->gpuMaskTime = stats->gpuLineTime = stats->gpuTextTime = 0.0;
+    }
+}
+
+bool OpenGLRenderer::drawCached()
+{
+    if (cacheFailed || !GLFunctions::has(GLFunctions::kBuffers))
+        return false;
+    
+    GLsizei width = GLsizei(ceil(viewWidth));
+    GLsizei height = GLsizei(ceil(viewHeight));
+    if (width <= 0 || height <= 0)
+        return false;
+    
+    // The batches remember what they last drew, whether into the cache or
+    // directly, so they are compared as is rather than hashed, and without
+    // being copied. Masks or lines that differ from the last frame are
+    // drawn directly: the cache is only filled once they repeat, so frames
+    // that keep changing never pay for it.
+    GLContextKey context = currentGLContext();
+    if (!maskBatch.unchanged(context) || !lineBatch.unchanged(context)) {
+        cacheValid = false;
+        return false;
+    }
     
-    if (stipple)
-        glDisable (GL_LINE_STIPPLE);
+    GLuint texture = GLResources::find(this, kCacheTexture);
+    if (!texture || !cacheValid || context != cachedContext ||
+        width != cacheWidth || height != cacheHeight) {
+        if (!renderCache(width, height))
+            return false;
+        
+        texture = GLResources::find(this, kCacheTexture);
+        cacheValid = true;
+    }
     
+    // The cache holds premultiplied colors
+    compositeBatch.clear();
+    const float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    compositeBatch.add( 0,     0,      0.0f, 0.0f, white );
+    compositeBatch.add( width, 0,      1.0f, 0.0f, white );
+    compositeBatch.add( width, height, 1.0f, 1.0f, white );
+    compositeBatch.add( 0,     height, 0.0f, 1.0f, white );
+    
+    state.useProgram(0);
+    state.blendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    state.enable(GL_TEXTURE_2D);
+    state.bindTexture(0, texture);
+    compositeBatch.draw(GL_QUADS);
+    return true;
 }
 
-// Given a Geom instance, this will draw a line connecting the points.
-// The argument side determines whether the sides will be drawn (the top
-// will always be drawn). The stipple argument specifies whether the line
-// should be solid or dashed/stippled.
+void OpenGLRenderer::releaseCache()
+{
+    GLResources::release(this, kCacheFramebuffer);
+    GLResources::release(this, kCacheTexture);
+    cacheValid = false;
+}
+
+// Render the masks and lines into the cache. This is the only place where
+// the GL state is read back, and only on the first frame that repeats the
+// masks and lines of a change: the framebuffer, viewport and scissor test of
+// the caller are restored before compositing.
 //
-void OpenGLRenderer::drawLines( Geom g, MColor color, bool sides, bool stipple)
+bool OpenGLRenderer::renderCache(GLsizei width, GLsizei height)
 {
-    if (stipple)
-    {
-        glEnable (GL_LINE_STIPPLE);
-        glLineStipple(1,0x00FF);
+    GLuint texture = GLResources::find(this, kCacheTexture);
+    GLuint framebuffer = GLResources::find(this, kCacheFramebuffer);
+    
+    // Render to texture needs OpenGL 3.0, the batches are drawn directly
+    // in the contexts without it
+    if (!framebuffer && !GLFunctions::has(GLFunctions::kFramebuffers))
+        return false;
+    
+    GLint previousFramebuffer = 0;
+    GLint viewport[4];
+    glGetIntegerv( GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer );
+    glGetIntegerv( GL_VIEWPORT, viewport );
+    GLboolean scissor = glIsEnabled( GL_SCISSOR_TEST );
+    
+    // The texture is reallocated when the port is resized
+    GLContextKey context = currentGLContext();
+    if (!texture || width != cacheWidth || height != cacheHeight || context != cachedContext) {
+        if (!texture) {
+            glGenTextures( 1, &texture );
+            state.bindTexture( 0, texture );
+            glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+            glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+            glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+            glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+            GLResources::add(this, kCacheTexture, GLResources::kTexture, texture, 0);
+        }
+        else
+            state.bindTexture( 0, texture );
+        
+        glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL );
+        GLResources::setBytes(this, kCacheTexture, size_t(width) * height * 4);
+        cacheWidth = width;
+        cacheHeight = height;
+        cachedContext = context;
     }
     
-    GLenum mode = ( sides ) ? GL_LINE_LOOP : GL_LINES;
+    if (!framebuffer) {
+        glGenFramebuffers( 1, &framebuffer );
+        glBindFramebuffer( GL_DRAW_FRAMEBUFFER, framebuffer );
+        glFramebufferTexture2D( GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0 );
+        GLResources::add(this, kCacheFramebuffer, GLResources::kFramebuffer, framebuffer, 0);
+        
+        if (glCheckFramebufferStatus( GL_DRAW_FRAMEBUFFER ) != GL_FRAMEBUFFER_COMPLETE) {
+            glBindFramebuffer( GL_DRAW_FRAMEBUFFER, previousFramebuffer );
+            cacheFailed = true;
+            return false;
+        }
+    }
+    else
+        glBindFramebuffer( GL_DRAW_FRAMEBUFFER, framebuffer );
     
-    glBegin( mode );
+    glViewport( 0, 0, width, height );
+    if (scissor)
+        glDisable( GL_SCISSOR_TEST );
     
-    glColor4f( color.r, color.g, color.b, 1-color.a );
+    state.clearColor( 0.0f, 0.0f, 0.0f, 0.0f );
+    glClear( GL_COLOR_BUFFER_BIT );
     
-    glVertex2d( g.x1, g.y1 );
-    glVertex2d( g.x2, g.y1 );
-    glVertex2d( g.x2, g.y2 );
-    glVertex2d( g.x1, g.y2 );
+    // Premultiply the colors, and accumulate the coverage in the alpha
+    state.blendFuncSeparate( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA );
+    drawGeometryBatches();
     
-    glEnd( );
+    glBindFramebuffer( GL_DRAW_FRAMEBUFFER, previousFramebuffer );
+    glViewport( viewport[0], viewport[1], viewport[2], viewport[3] );
+    if (scissor)
+        glEnable( GL_SCISSOR_TEST );
     
-    if (stipple)
-        glDisable (GL_LINE_STIPPLE);
+    return true;
 }
 
-// This function uses a font texture atlas to draw text.
+// Add the batched masks to the mask vertex buffer. MaskVertex has the same
+// layout as the plain VertexBatch vertices so they are copied as is.
 //
-void OpenGLRenderer::drawText(TextData *td, double tx, double ty)
+void OpenGLRenderer::drawMaskBatch(const MaskBatch &batch)
 {
-    double screenScaleFactor = (td->textScale) ? filmback->filmbackGeom.x/1280.0f : 1.0f;
-    double fontScaleFactor = (double(td->textSize) / double(MAXFONT)) * screenScaleFactor;
-    
-    // Get the specified font;
-    TextureFont *font = (td->textBold) ? &font_120pt_bold : &font_120pt;
+    const GLfloat *data = &batch[0].x;
+    maskBatch.vertices.insert(maskBatch.vertices.end(), data, data + batch.size() * 6);
+}
+
+// Compile and link the line shader the first time it is needed in the
+// current context.
+//
+GLuint OpenGLRenderer::lineProgram()
+{
+    GLuint program = GLResources::find(&sharedResources, kLineProgram);
+    if (program || lineProgramFailed || !GLFunctions::has(GLFunctions::kShaders))
+        return program;
+    
+    const char *attribs[] = { "lineData" };
+    program = buildProgram(lineVertexShader, lineFragmentShader, LINE_ATTRIB, 1, attribs);
+    if (!program) {
+        lineProgramFailed = true;
+        return 0;
+    }
     
-    // Get wchar pointer to text
-    const wchar_t *textPtr = td->textStr.asWChar();
+    GLResources::add(&sharedResources, kLineProgram, GLResources::kProgram, program, 0);
+    return program;
+}
+
+// Adds a single line segment to the line batch as a quad lineWidth pixels
+// wide. The ends are extended by half the width so that the corners of thick
+// rectangles are closed.
+//
+void OpenGLRenderer::addLine(double x1, double y1, double x2, double y2,
+                             const float *color, float dashPeriod)
+{
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double length = sqrt(dx*dx + dy*dy);
+    
+    if (length < EPSILON)
+        return;
+    
+    double hw = std::max(lineWidth, 1.0f) / 2.0;
+    double ux = dx / length * hw;
+    double uy = dy / length * hw;
+    
+    // Distances are measured from the start point so that the dash pattern
+    // restarts on every segment, as the stipple pattern did.
+    float d1 = float(-hw);
+    float d2 = float(length + hw);
+    
+    lineBatch.add( x1 - ux - uy, y1 - uy + ux, d1, dashPeriod, color );
+    lineBatch.add( x1 - ux + uy, y1 - uy - ux, d1, dashPeriod, color );
+    lineBatch.add( x2 + ux + uy, y2 + uy - ux, d2, dashPeriod, color );
+    lineBatch.add( x2 + ux - uy, y2 + uy + ux, d2, dashPeriod, color );
+}
+
+// This draws a single line between the specified points.
+//
+void OpenGLRenderer::drawLine(double x1, double x2, double y1, double y2,
+                            MColor color, bool stipple)
+{
+    const float c[4] = { color.r, color.g, color.b, 1-color.a };
     
-    // Build glyph array to calculate width and then draw
-    float textWidth = 0.0f;
-    float textHeight = 0.0f;
-    int numChars = wcslen(textPtr);
+    addLine( x1, y1, x2, y2, c, stipple ? WIDE_DASH_PERIOD : 0.0f );
+}
+
+// Given a Geom instance, this will draw a line connecting the points.
+// The argument side determines whether the sides will be drawn (the top
+// will always be drawn). The stipple argument specifies whether the line
+// should be solid or dashed/stippled.
+//
+void OpenGLRenderer::drawLines( Geom g, MColor color, bool sides, bool stipple)
+{
+    const float c[4] = { color.r, color.g, color.b, 1-color.a };
+    float period = stipple ? DASH_PERIOD : 0.0f;
     
-    TextureGlyph *glyphs[numChars];
-    double kerning[numChars];
+    addLine( g.x1, g.y1, g.x2, g.y1, c, period );
+    addLine( g.x2, g.y2, g.x1, g.y2, c, period );
     
-    for (int i = 0; i < numChars; i++) {
-        GlyphMap::iterator it = font->glyphMap.find(textPtr[i]);
-        if (it == font->glyphMap.end()) {
-            std::cout << "Unable to find font character for '" << textPtr[i] << "' for size " << font->size << std::endl;
-            return;
-        }
-        
-        TextureGlyph *glyph = glyphs[i] = it->second;
-        
-        textWidth += glyph->advance_x;
-        textHeight = std::max(textHeight,float(glyph->height));
+    if (sides)
+    {
+        addLine( g.x2, g.y1, g.x2, g.y2, c, period );
+        addLine( g.x1, g.y2, g.x1, g.y1, c, period );
+    }
+}
+
+// This function uses a font texture atlas to draw text.
+//
+void OpenGLRenderer::drawText(const TextData *td, double tx, double ty)
+{
+    double fontScaleFactor;
+    if (!layoutText(atlas, td, tx, ty, placedGlyphs, fontScaleFactor))
+        return;
+    
+    // Add one instance per glyph, or the glyph quads when instancing is not
+    // available
+    const float c[4] = { td->textColor.r, td->textColor.g, td->textColor.b, 1-td->textColor.a };
+    for (size_t i = 0; i < placedGlyphs.size(); i++) {
+        const FontFileGlyph *glyph = placedGlyphs[i].glyph;
+        double px = placedGlyphs[i].x;
+        double py = placedGlyphs[i].y;
         
-        if (i > 0 && glyph->kerning_count) {
-            double kernAmount = 0;
-            for(unsigned int kernIndex =0; kernIndex < glyph->kerning_count; kernIndex++) {
-                if (glyph->kerning[kernIndex].charcode == textPtr[i-1] ) {
-                    kernAmount = glyph->kerning[kernIndex].kerning;
-                    break;
-                }
-            }
-            kerning[i] = kernAmount;
-            textWidth += kerning[i];
+        if (instancedText) {
+            glyphInstances.add( px, py, float(fontScaleFactor), GLfloat(atlas->glyphIndex(glyph)), c );
+            continue;
         }
-        else
-            kerning[i] = 0.0f;
-    }
-    
-    // Scale textWidth based upon the fontScaleFactor;
-    textWidth *= fontScaleFactor;
-    textHeight *= fontScaleFactor;
-    
-    // Adjust tx for text alignment
-    switch (td->textAlign) {
-        case 1:
-            tx -= textWidth / 2.0f;
-            break;
-        case 2:
-            tx -= textWidth;
-            break;
-    }
-    
-    // Adjust ty for text alignment
-    switch (td->textVAlign) {
-        case 1:
-            ty -= textHeight / 2.0f;
-            break;
-        case 2:
-            ty -= textHeight;
-            break;
-    }
-    
-    // Adjust text position to account for screen scaling
-    tx += td->textPosX*screenScaleFactor;
-    ty += td->textPosY*screenScaleFactor;
-    
-    // Actually draw the glyphs
-    glColor4f( td->textColor.r, td->textColor.g, td->textColor.b, 1-td->textColor.a );
-    for( int i=0; i<numChars; i++) {
-        TextureGlyph *glyph = glyphs[i];
         
-        double x = double(tx + ((glyph->offset_x + kerning[i]) * fontScaleFactor));
-        double y = double(ty + (glyph->offset_y*fontScaleFactor));
+        double x = px + glyph->offset_x * fontScaleFactor;
+        double y = py + glyph->offset_y * fontScaleFactor;
         double w  = glyph->width * fontScaleFactor;
         double h  = glyph->height * fontScaleFactor;
-        glBegin( GL_QUADS );
-        {
-            glTexCoord2f( glyph->u0, glyph->v0 ); glVertex2d( x,   y   );
-            glTexCoord2f( glyph->u0, glyph->v1 ); glVertex2d( x,   y-h );
-            glTexCoord2f( glyph->u1, glyph->v1 ); glVertex2d( x+w, y-h );
-            glTexCoord2f( glyph->u1, glyph->v0 ); glVertex2d( x+w, y   );
-        }
-        glEnd();
-        tx += (glyph->advance_x + kerning[i]) * fontScaleFactor;
-        ty += glyph->advance_y * fontScaleFactor;
+        
+        glyphBatch.add( x,   y,   glyph->u0, glyph->v0, c );
+        glyphBatch.add( x,   y-h, glyph->u0, glyph->v1, c );
+        glyphBatch.add( x+w, y-h, glyph->u1, glyph->v1, c );
+        glyphBatch.add( x+w, y,   glyph->u1, glyph->v0, c );
     }
 }
 
 // Make sure everything is ready for text drawing
 void OpenGLRenderer::enableTextRendering() {
-    // Enable GL textures
-    glEnable( GL_TEXTURE_2D );
+    textEnabled = true;
     
-    if (!fontAtlas.id) {
-        glGenTextures( 1, &fontAtlas.id );
-        glBindTexture( GL_TEXTURE_2D, fontAtlas.id );
+    // The instanced path uses the distance field atlas, so the alpha atlas
+    // and its mipmaps are only uploaded when instancing is not available.
+    instancedText = initTextResources();
+    
+    if (!instancedText && !GLResources::find(&sharedResources, kAlphaAtlas)) {
+        GLuint alphaAtlas;
+        glGenTextures( 1, &alphaAtlas );
+        state.bindTexture( 0, alphaAtlas );
         glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP );
         glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP );
         glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
@@ -366,15 +880,83 @@ void OpenGLRenderer::enableTextRendering() {
         //Generate the texture with mipmaps
         glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
         
-        glTexImage2D( GL_TEXTURE_2D, 0, GL_ALPHA, fontAtlas.width, fontAtlas.height, 0, GL_ALPHA, GL_UNSIGNED_BYTE, fontAtlas.data );
+        state.pixelStore( GL_UNPACK_ALIGNMENT, 1 );
+        glTexImage2D( GL_TEXTURE_2D, 0, GL_ALPHA, atlas->width(), atlas->height(), 0, GL_ALPHA, GL_UNSIGNED_BYTE, atlas->pixels() );
+        
+        // The mipmaps add a third
+        size_t bytes = size_t(atlas->width()) * atlas->height() * 4 / 3;
+        GLResources::add(&sharedResources, kAlphaAtlas, GLResources::kTexture, alphaAtlas, bytes);
+    }
+}
+
+// Compile the text shader and upload the glyph metrics, once per context.
+// Instancing needs OpenGL 3.3 or the instancing extensions.
+//
+bool OpenGLRenderer::initTextResources()
+{
+    if (GLResources::find(&sharedResources, kTextProgram))
+        return true;
+    if (textProgramFailed || !atlas->sdfPixels())
+        return false;
+    
+    if (!GLFunctions::has(GLFunctions::kInstancing))
+        return false;
+    
+    const char *attribs[] = { "glyphPen", "glyphColor", "glyphData" };
+    GLuint program = buildProgram(textVertexShader, textFragmentShader, TEXT_ATTRIB, 3, attribs);
+    if (!program) {
+        textProgramFailed = true;
+        return false;
     }
     
-    glBindTexture( GL_TEXTURE_2D, fontAtlas.id );
+    state.useProgram( program );
+    glUniform1i( glGetUniformLocation(program, "glyphAtlas"), 0 );
+    glUniform1i( glGetUniformLocation(program, "glyphMetrics"), 1 );
+    state.useProgram( 0 );
+    
+    // Two RGBA texels per glyph, for the glyphs of every font of the atlas
+    std::vector<GLfloat> metrics;
+    for (unsigned int i = 0; i < atlas->numGlyphs(); i++) {
+        const FontFileGlyph &glyph = atlas->glyph(i);
+        const GLfloat texel[8] = {
+            glyph.u0, glyph.v0, glyph.u1, glyph.v1,
+            GLfloat(glyph.offset_x), GLfloat(glyph.offset_y), GLfloat(glyph.width), GLfloat(glyph.height) };
+        metrics.insert(metrics.end(), texel, texel+8);
+    }
+    
+    GLuint glyphMetrics;
+    glGenTextures( 1, &glyphMetrics );
+    state.bindTexture( 0, glyphMetrics );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+    glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA32F, 2, GLsizei(metrics.size() / 8), 0, GL_RGBA, GL_FLOAT, &metrics[0] );
+    GLResources::add(&sharedResources, kGlyphMetrics, GLResources::kTexture, glyphMetrics, metrics.size() * sizeof(GLfloat));
+    
+    // The distance field atlas is bilinear filtered without mipmaps
+    GLuint sdfAtlas;
+    glGenTextures( 1, &sdfAtlas );
+    state.bindTexture( 0, sdfAtlas );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+    state.pixelStore( GL_UNPACK_ALIGNMENT, 1 );
+    glTexImage2D( GL_TEXTURE_2D, 0, GL_ALPHA, atlas->sdfWidth(), atlas->sdfHeight(), 0, GL_ALPHA, GL_UNSIGNED_BYTE, atlas->sdfPixels() );
+    GLResources::add(&sharedResources, kSdfAtlas, GLResources::kTexture, sdfAtlas, size_t(atlas->sdfWidth()) * atlas->sdfHeight());
+    
+    // The corners of the glyph quad, as a triangle strip
+    const GLfloat corners[8] = { 0, 0,  1, 0,  0, 1,  1, 1 };
+    GLuint glyphCorners;
+    glGenBuffers( 1, &glyphCorners );
+    glBindBuffer( GL_ARRAY_BUFFER, glyphCorners );
+    glBufferData( GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW );
+    GLResources::add(&sharedResources, kGlyphCorners, GLResources::kBuffer, glyphCorners, sizeof(corners));
+    
+    // Registered last, it marks the text resources of the context complete
+    GLResources::add(&sharedResources, kTextProgram, GLResources::kProgram, program, 0);
+    return true;
 }
 
-// Turn off text rendering
+// Turn off text rendering. The glyphs are drawn in postDraw.
 void OpenGLRenderer::disableTextRendering() {
-    // Disable GL textures
-    glDisable( GL_TEXTURE_2D );
 }
-
@@ -44,19 +44,17 @@
 
 #include <iostream>
 #include <map>
+#include <vector>
 #include <stdlib.h>
 
 #include "defines.h"
-#include "font.h"
+#include "FontAtlas.h"
+#include "GLFunctions.h"
+#include "GLResources.h"
+#include "GLStateCache.h"
 
 #include "GPURenderer.h"
 
-#if defined(OSMac_MachO_)
-#	include <OpenGL/gl.h>
-#else
-#	include <GL/gl.h>
-#endif
-
 // General OpenGL Renderer
 class OpenGLRenderer : public GPURenderer
 {
@@ -67,9 +65,13 @@ class OpenGLRenderer : public GPURenderer
         virtual void prepareForDraw(float portWidth, float portHeight);
         virtual void postDraw();
     
-        // Given two Geom instances, this renders the mask area between them.
-        virtual void drawMask( Geom g1, Geom g2, MColor color, bool sides, bool top );
-        
+        // Draw the batches of the last frame again
+        virtual bool redraw(float portWidth, float portHeight);
+    
+        // Keep the mask and line batches of the last frame, the text is
+        // recorded again
+        virtual bool redrawGeometry(float portWidth, float portHeight);
+    
         // This draws a single line between the specified points.
         virtual void drawLine(double x1, double x2, double y1, double y2,
                               MColor color, bool stipple);
@@ -81,34 +83,206 @@ class OpenGLRenderer : public GPURenderer
         virtual void drawLines( Geom g, MColor color, bool sides, bool stipple);
         
         // This function is responsible for rendering text.
-        virtual void drawText(TextData *td, double tx, double ty);
+        virtual void drawText(const TextData *td, double tx, double ty);
         
         // Make sure everything is ready for text drawing
         virtual void enableTextRendering();
         
         // Turn off text rendering
         virtual void disableTextRendering();
+        
+        // Release the cache texture, e.g. when the view it was rendered for
+        // is resized or recycled. It is rendered again when needed.
+        void releaseCache();
+    
+    protected:
+        // Add the batched masks to the mask vertex buffer
+        virtual void drawMaskBatch(const MaskBatch &batch);
     
     private:
-        class FontData
+        // The objects of the renderer in GLResources, per context
+        enum Resource
+        {
+            kCacheTexture = 0,
+            kCacheFramebuffer,
+            
+            // GPU_TIMER_FRAMES * kTimerMarks timestamp queries
+            kTimerQueries
+        };
+        
+        // Timestamps of a timed frame: start, after the masks, after the
+        // lines and end. Frames composited from the cache only have the
+        // start and the end.
+        enum { kTimerMarks = 4 };
+        
+        class TimerFrame
         {
         public:
-            int                 size;
-            TextureFont         *normal;
-            TextureFont         *bold;
-            TextureFont         *generic;
-            FontData(int fontSize) {
-                size    =fontSize;
-                normal  = NULL;
-                bold    =NULL;
-                generic =NULL;
-            }
+            TimerFrame() : numMarks(0), pending(false) {}
+            
+            int  numMarks;
+            bool pending;
         };
         
-        typedef std::map<int,FontData *> FontMap;
-        FontMap    fontMap;
+        // The timer queries of a context, used in turn
+        class TimerRing
+        {
+        public:
+            TimerRing() : next(0) {}
+            
+            TimerFrame   frames[GPU_TIMER_FRAMES];
+            unsigned int next;
+        };
+        
+        // Start timing the frame in the next free slot of the ring of the
+        // current context, after reading back the frames that are done.
+        void beginTimer();
         
-        GLint blendAttrs[2];
+        // Add a timestamp to the frame being timed
+        void markTimer();
+        void endTimer();
+        
+        // Read the frames of the ring whose results are available
+        void readTimers(TimerRing &ring);
+
+        // A batch of vertices recorded during drawBase. The vertices are
+        // only uploaded to the GL buffer when they differ from the ones
+        // uploaded for the previous draw in the same context, and each batch
+        // is drawn with a single glDrawArrays call in postDraw. The buffer
+        // of every context is kept in GLResources. Without buffer objects
+        // the batch is drawn from client memory.
+        class VertexBatch
+        {
+        public:
+            // Vertex layout: position (2), color (4) and optionally two
+            // extra floats, all floats. The extra floats are either texture
+            // coordinates or the line attributes of the line shader.
+            VertexBatch(bool extended=false) :
+                extended(extended), uploadedContext(NULL), drawCalls(0), uploadBytes(0) {}
+            ~VertexBatch() { GLResources::release(this); }
+
+            int components() const { return extended ? 8 : 6; }
+            GLsizei count() const { return GLsizei(vertices.size() / components()); }
+
+            // Start a new frame
+            void clear() { vertices.clear(); restart(); }
+
+            // Start a new frame with the vertices of the last one
+            void restart() { drawCalls = 0; uploadBytes = 0; }
+            void add(double x, double y, const float *color);
+            void add(double x, double y, float u, float v, const float *color);
+
+            // Upload the vertices if they changed since the last upload.
+            // Returns the base of the vertex pointers: the start of the
+            // bound buffer, or the vertices themselves when buffer objects
+            // are not available.
+            const char *upload();
+
+            // Draw the batch with the given primitive type. The extra floats
+            // are bound to the given generic vertex attribute, or used as
+            // texture coordinates when attrib is negative.
+            void draw(GLenum mode, GLint attrib=-1);
+
+            // Draw verticesPerInstance vertices for every vertex of the batch,
+            // which is bound as per instance data to the generic vertex
+            // attributes attrib (position), attrib+1 (color) and attrib+2
+            // (extra floats).
+            void drawInstanced(GLenum mode, GLsizei verticesPerInstance, GLuint attrib);
+
+            // True if the batch was last drawn in the given context with the
+            // same vertices. Only tracked with buffer objects.
+            bool unchanged(GLContextKey context) const;
+
+            bool                 extended;
+            GLContextKey         uploadedContext;
+            std::vector<GLfloat> vertices;
+            std::vector<GLfloat> uploaded;
+
+            // Counters since the last clear, see RenderStats
+            unsigned int         drawCalls;
+            size_t               uploadBytes;
+
+        private:
+            void drawEmpty();
+        };
+
+        // Every line is added to the line batch as a screen space quad whose
+        // vertices carry the distance along the line and the dash period,
+        // 0 for solid lines. The line shader cuts the dashes, so all of the
+        // lines of a frame are drawn with a single call.
+        void addLine(double x1, double y1, double x2, double y2,
+                     const float *color, float dashPeriod);
+
+        // The line shader of the current context, compiled the first time
+        // it is needed. Returns 0 if the shader is not available, in which
+        // case the lines are drawn solid.
+        GLuint lineProgram();
+
+        // Set up the instanced text path in the current context: compile the
+        // text shader and upload the glyph metrics and the distance field
+        // atlas. Returns false if instancing is not available, in which case
+        // the glyphs are drawn as quads from the alpha atlas.
+        bool initTextResources();
+
+        // Set up the GL state of a frame, saving what is changed
+        void beginFrame(float portWidth, float portHeight);
+
+        // Draw the recorded masks and lines
+        void drawGeometryBatches();
+
+        // Draw the recorded text over the masks and lines
+        void drawTextBatches();
+
+        // Add the counters of the batches to the stats of the frame
+        void countFrame(bool cached);
+
+        // The masks and lines are rendered into a texture of the port size,
+        // which is composited with a single quad as long as they and the
+        // port size are the same as when it was rendered. The cache is only
+        // filled once a frame repeats the masks and lines of the previous
+        // one. Returns false if the masks and lines have to be drawn
+        // directly, because they changed or render to texture is not
+        // available.
+        bool drawCached();
+
+        // Render the masks and lines into the cache texture of the current
+        // context
+        bool renderCache(GLsizei width, GLsizei height);
+
+        VertexBatch maskBatch;
+        VertexBatch lineBatch;
+        VertexBatch glyphBatch;
+        bool        lineProgramFailed;
+
+        // One instance per character: pen position, color, scale and glyph
+        // index. The shader reads the rest from the glyph metrics texture.
+        VertexBatch glyphInstances;
+        std::vector<PlacedGlyph> placedGlyphs;
+        bool        instancedText;
+        bool        textProgramFailed;
+        bool        textEnabled;
+
+        // The shared font atlas, see FontRegistry
+        FontAtlas   *atlas;
+
+        // The GL state changed between prepareForDraw and postDraw
+        GLStateCache state;
+
+        // The port size of the frame, and the size and context of the cache
+        // texture. The cache is valid as long as the masks and lines are
+        // unchanged.
+        float        viewWidth;
+        float        viewHeight;
+        GLsizei      cacheWidth;
+        GLsizei      cacheHeight;
+        GLContextKey cachedContext;
+        bool         cacheValid;
+        bool         cacheFailed;
+        VertexBatch  compositeBatch;
+
+        std::map<GLContextKey, TimerRing> timerRings;
+        TimerFrame   *timerFrame;
+        int          timerQueries;
 };
 
 #endif
@@ -0,0 +1,292 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  RendererBackend.cpp
+//  spReticle
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(_WIN32)
+#	include <windows.h>
+#else
+#	include <unistd.h>
+#endif
+
+#include <maya/MGlobal.h>
+
+#if (MAYA_API_VERSION >= 201600)
+#include <maya/MViewport2Renderer.h>
+#include <maya/MDrawContext.h>
+#endif
+
+#include "defines.h"
+#include "GLFunctions.h"
+#include "GPURenderer.h"
+#include "RendererBackend.h"
+
+#if (MAYA_API_VERSION >= 201600)
+static const MString renderNotification("spReticleLocBackend");
+bool                  RendererBackend::notifications = false;
+#endif
+
+double                RendererBackend::renderStart = 0.0;
+RendererBackend::Type RendererBackend::renderType = RendererBackend::kAuto;
+bool                  RendererBackend::subSceneOverride = false;
+RendererBackend::Type RendererBackend::requestedType = RendererBackend::kOpenGL;
+RendererBackend::Type RendererBackend::chosen = RendererBackend::kAuto;
+unsigned int          RendererBackend::numFrames[RendererBackend::kAuto] = { 0, 0 };
+double                RendererBackend::totalTime[RendererBackend::kAuto] = { 0.0, 0.0 };
+MString               RendererBackend::deviceName;
+
+static const char *backendNames[RendererBackend::kNumTypes] = { "openGL", "drawManager", "auto" };
+
+void RendererBackend::initialize()
+{
+#if (MAYA_API_VERSION >= 201600)
+    MHWRender::MRenderer* theRenderer = MHWRender::MRenderer::theRenderer();
+    if (theRenderer && !notifications)
+    {
+        notifications =
+            theRenderer->addNotification(beginRender, renderNotification, MHWRender::MPassContext::kBeginRenderSemantic, NULL) &&
+            theRenderer->addNotification(endRender, renderNotification, MHWRender::MPassContext::kEndRenderSemantic, NULL);
+        if (!notifications)
+            MGlobal::displayWarning( "spReticleLoc: could not add the render notifications of the auto backend" );
+    }
+#endif
+
+    const char *value = getenv(BACKEND_ENV_VAR);
+    subSceneOverride = false;
+    if (value && MString(value) == SUBSCENE_BACKEND)
+    {
+#if (MAYA_API_VERSION >= 201700)
+        subSceneOverride = true;
+#else
+        MGlobal::displayWarning( "spReticleLoc: the " SUBSCENE_BACKEND " backend requires Maya 2017, using the draw override" );
+#endif
+        value = NULL;
+    }
+
+    if (value && *value)
+    {
+        if (select(value))
+            return;
+
+        MGlobal::displayWarning( MString("spReticleLoc: unknown backend ") + value + " in " + BACKEND_ENV_VAR );
+    }
+
+    select(DEFAULT_BACKEND);
+}
+
+void RendererBackend::uninitialize()
+{
+#if (MAYA_API_VERSION >= 201600)
+    MHWRender::MRenderer* theRenderer = MHWRender::MRenderer::theRenderer();
+    if (theRenderer && notifications)
+    {
+        theRenderer->removeNotification(renderNotification, MHWRender::MPassContext::kBeginRenderSemantic);
+        theRenderer->removeNotification(renderNotification, MHWRender::MPassContext::kEndRenderSemantic);
+    }
+    notifications = false;
+#endif
+}
+
+bool RendererBackend::select(const MString &name)
+{
+    for (int i = 0; i < kNumTypes; i++)
+    {
+        if (name == backendNames[i])
+        {
+            requestedType = Type(i);
+
+            // Without the render notifications the backends can't be timed
+#if (MAYA_API_VERSION >= 201600)
+            if (requestedType == kAuto && !notifications)
+#else
+            if (requestedType == kAuto)
+#endif
+            {
+                MGlobal::displayWarning( "spReticleLoc: the auto backend requires the render notifications of Maya 2016, using openGL" );
+                requestedType = kOpenGL;
+            }
+
+            renderType = kAuto;
+            chosen = kAuto;
+            for (int j = 0; j < kAuto; j++)
+            {
+                numFrames[j] = 0;
+                totalTime[j] = 0.0;
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+RendererBackend::Type RendererBackend::current()
+{
+    if (requestedType != kAuto)
+        return requestedType;
+
+    if (chosen != kAuto)
+        return chosen;
+
+    // Take turns while the trial runs
+    return numFrames[kOpenGL] <= numFrames[kDrawManager] ? kOpenGL : kDrawManager;
+}
+
+void RendererBackend::drewFrame(Type type)
+{
+    if (!trial() || type >= kAuto)
+        return;
+
+    // A render in which both backends drew, as when the backend is selected
+    // again during it, is not timed
+    if (renderType == kAuto || renderType == type)
+        renderType = type;
+    else
+        renderType = kNumTypes;
+}
+
+#if (MAYA_API_VERSION >= 201600)
+void RendererBackend::beginRender(MHWRender::MDrawContext & /*context*/, void * /*clientData*/)
+{
+    renderType = kAuto;
+    if (!trial())
+        return;
+
+    // Don't count the GPU work of the previous renders
+    MHWRender::MRenderer* theRenderer = MHWRender::MRenderer::theRenderer();
+    if (theRenderer && theRenderer->drawAPIIsOpenGL())
+        glFinish();
+
+    renderStart = RenderStats::now();
+}
+
+void RendererBackend::endRender(MHWRender::MDrawContext & /*context*/, void * /*clientData*/)
+{
+    if (!trial() || renderType >= kAuto)
+    {
+        renderType = kAuto;
+        return;
+    }
+
+    MHWRender::MRenderer* theRenderer = MHWRender::MRenderer::theRenderer();
+    if (theRenderer && theRenderer->drawAPIIsOpenGL())
+        glFinish();
+
+    addFrame(renderType, RenderStats::now() - renderStart);
+    renderType = kAuto;
+}
+#endif
+
+void RendererBackend::addFrame(Type type, double time)
+{
+    if (type >= kAuto)
+        return;
+
+    numFrames[type]++;
+    totalTime[type] += time;
+
+    if (trial() &&
+        numFrames[kOpenGL] >= AUTO_BACKEND_FRAMES && numFrames[kDrawManager] >= AUTO_BACKEND_FRAMES)
+    {
+        chosen = averageTime(kDrawManager) < averageTime(kOpenGL) ? kDrawManager : kOpenGL;
+        record();
+    }
+}
+
+void RendererBackend::setDevice(const char *device)
+{
+    if (device)
+        deviceName = device;
+}
+
+double RendererBackend::averageTime(Type type)
+{
+    if (type >= kAuto || numFrames[type] == 0)
+        return 0.0;
+
+    return totalTime[type] / numFrames[type];
+}
+
+const char *RendererBackend::name(Type type)
+{
+    return backendNames[type];
+}
+
+void RendererBackend::record()
+{
+    // Times in milliseconds
+    char times[256];
+    sprintf(times, "%s %.3f ms, %s %.3f ms",
+            backendNames[kOpenGL], averageTime(kOpenGL) * 1000.0,
+            backendNames[kDrawManager], averageTime(kDrawManager) * 1000.0);
+
+    MGlobal::displayInfo( MString("spReticleLoc: auto backend selected ") + backendNames[chosen] + " (" + times + ")" );
+
+    const char *path = getenv(BACKEND_LOG_ENV_VAR);
+    if (!path || !*path)
+        return;
+
+    FILE *file = fopen(path, "a");
+    if (!file)
+    {
+        MGlobal::displayWarning( MString("spReticleLoc: could not open ") + path );
+        return;
+    }
+
+    char host[256] = "";
+#if defined(_WIN32)
+    const char *computer = getenv("COMPUTERNAME");
+    if (computer)
+        sprintf(host, "%.255s", computer);
+#else
+    if (gethostname(host, sizeof(host)) != 0)
+        host[0] = '\0';
+    host[sizeof(host) - 1] = '\0';
+#endif
+
+    char date[64];
+    time_t now = time(NULL);
+    strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", localtime(&now));
+
+    // One tab separated line per decision
+    fprintf(file, "%s\t%s\t%d\t%s\t%s\t%s\n", date, host, MAYA_API_VERSION,
+            deviceName.asChar(), backendNames[chosen], times);
+    fclose(file);
+}
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  RendererBackend.h
+//  spReticle
+//
+
+#ifndef spReticle_RendererBackend_h
+#define spReticle_RendererBackend_h
+
+#include <maya/MTypes.h>
+#include <maya/MString.h>
+
+#if (MAYA_API_VERSION >= 201600)
+namespace MHWRender { class MDrawContext; }
+#endif
+
+// Selects the renderer drawing the reticle in Viewport 2.0, for every node.
+// The backend is read from SPRETICLE_BACKEND when the plugin is loaded and
+// can be changed with the spReticleLocBackend command.
+//
+// In auto mode the OpenGL and MUIDrawManager renderers take turns drawing
+// the reticles, one Viewport 2.0 render each, until each drew reticles in
+// full in AUTO_BACKEND_FRAMES renders, and the one with the lowest average
+// render time is kept. Those renders are timed from their beginning to their
+// end, after glFinish on OpenGL, so that the GPU time of the OpenGL renderer
+// and the time Viewport 2.0 spends drawing the MUIDrawManager primitives are
+// both counted. Renders whose reticles were only drawn again, or with new
+// text only, are not timed. Auto mode uses the render notifications of
+// Maya 2016; before, the openGL backend is used instead. The decision is
+// reported in the script editor and appended to the file named by
+// SPRETICLE_BACKEND_LOG.
+//
+// The subScene backend replaces the draw override with the sub-scene
+// override, Maya 2017+. As the override is registered with the node, it can
+// only be chosen with SPRETICLE_BACKEND when the plugin is loaded.
+class RendererBackend
+{
+public:
+    enum Type { kOpenGL = 0, kDrawManager, kAuto, kNumTypes };
+
+    // Read the backend from the environment, or use DEFAULT_BACKEND, and
+    // add the render notifications timing auto mode
+    static void initialize();
+
+    // Whether Viewport 2.0 draws through the sub-scene override, chosen by
+    // initialize for the plugin to register the node with it
+    static bool subScene() { return subSceneOverride; }
+
+    // Remove the render notifications
+    static void uninitialize();
+
+    // Select a backend by name, restarting the trial of auto mode. Returns
+    // false if the name is not a backend.
+    static bool select(const MString &name);
+
+    // The backend that was asked for, possibly kAuto
+    static Type requested() { return requestedType; }
+
+    // The renderer to draw the next frame with, kOpenGL or kDrawManager
+    static Type current();
+
+    // Whether auto mode picked a backend
+    static bool decided() { return requestedType == kAuto && chosen != kAuto; }
+
+    // Account for a reticle drawn in full by a backend in the current
+    // render, see spReticleLoc::drawBase
+    static void drewFrame(Type type);
+
+    // Describe the device drawing the OpenGL frames, for the log
+    static void setDevice(const char *device);
+
+    static unsigned int frames(Type type) { return numFrames[type]; }
+    static double averageTime(Type type);
+
+    static const char *name(Type type);
+
+private:
+    // Account for a render in which a backend drew reticles, in seconds
+    static void addFrame(Type type, double time);
+
+    // Report the decision of auto mode
+    static void record();
+
+    // Whether auto mode is still timing the backends
+    static bool trial() { return requestedType == kAuto && chosen == kAuto; }
+
+#if (MAYA_API_VERSION >= 201600)
+    static void beginRender(MHWRender::MDrawContext &context, void *clientData);
+    static void endRender(MHWRender::MDrawContext &context, void *clientData);
+
+    static bool         notifications;
+#endif
+
+    // The start of the render being timed and the backend that drew
+    // reticles in full in it, kAuto if none did
+    static double       renderStart;
+    static Type         renderType;
+
+    static bool         subSceneOverride;
+    static Type         requestedType;
+    static Type         chosen;
+    static unsigned int numFrames[kAuto];
+    static double       totalTime[kAuto];
+    static MString      deviceName;
+};
+
+#endif
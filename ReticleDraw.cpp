@@ -0,0 +1,1072 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  ReticleDraw.cpp
+//  spReticle
+//
+
+#include <iostream>
+#include <math.h>
+#include <stdio.h>
+
+#include "defines.h"
+
+#include "ReticleDraw.h"
+
+static ReticleErrorHandler errorHandler = NULL;
+
+void setReticleErrorHandler(ReticleErrorHandler handler)
+{
+    errorHandler = handler;
+}
+
+static void reportError(const MString & message)
+{
+    if (errorHandler)
+        errorHandler(message);
+    else
+        std::cerr << message.asChar() << std::endl;
+}
+
+// This method calculates the geometry of the current window. This data is
+// stored in a instance of the Geom class.
+//
+static void calcPortGeom( Layout & l )
+{
+    l.portGeom.x1 = 0;
+    l.portGeom.x2 = l.portWidth;
+    l.portGeom.y1 = 0;
+    l.portGeom.y2 = l.portHeight;
+
+    l.portGeom.x = l.portWidth / 2;
+    l.portGeom.y = l.portHeight / 2;
+    l.portGeom.isValid = true;
+}
+
+// This method calculates the geometry for the filmback. There are multiple
+// Geom instances that are used for displaying all of the filmback options.
+// This method takes the filmback data and calculates the appropriate settings
+// for the filmback Geom instances.
+//
+static void calcFilmbackGeom( const ReticleSettings & s, const CameraState & cam, Layout & l )
+{
+    Filmback &filmback = l.filmback;
+    PadOptions &pad = l.pad;
+    Geom &portGeom = l.portGeom;
+
+    // See if we are using the camera's filmback data
+    bool useCameraFilmback = filmback.horizontalFilmAperture < 0;
+
+    // If the horizontalFilmAperture equals -1, then use the cameras settings.
+    // Driving the camera aperture is done by prepForDraw.
+    if (useCameraFilmback)
+    {
+        filmback.horizontalFilmAperture = cam.horizontalFilmAperture;
+        filmback.verticalFilmAperture = cam.verticalFilmAperture;
+    }
+
+    // Calculate the aspect ratio of the cameras filmback
+    double cameraAspectRatio = cam.horizontalFilmAperture / cam.verticalFilmAperture;
+
+    // Calculate the aspect ratio of the viewport and determine if it has a horizontal or vertical orientation
+    double portAspectRatio = l.portWidth/l.portHeight;
+    bool portHoriz = portAspectRatio > cameraAspectRatio;
+
+    int filmFit = cam.filmFit;
+    if (filmFit == kFillFilmFit)
+    {
+        if (portHoriz)
+            filmFit = kHorizontalFilmFit;
+        else
+            filmFit = kVerticalFilmFit;
+    }
+    else if (filmFit == kOverscanFilmFit)
+    {
+        if (portHoriz)
+            filmFit = kVerticalFilmFit;
+        else
+            filmFit = kHorizontalFilmFit;
+    }
+
+    double panX = cam.panX;
+    double panY = cam.panY;
+    double zoom = cam.zoom;
+
+    double pixelScale = 1.0;
+
+    // Calculate the pixel scale value to use when drawing the filmback
+    switch ( filmFit )
+    {
+        case kInvalidFilmFit :
+        case kHorizontalFilmFit :
+        {
+            pixelScale = l.portWidth / cam.overscan / cam.horizontalFilmAperture / zoom;
+            portGeom.x -= (panX * pixelScale);
+            portGeom.y -= (panY * pixelScale);
+            break;
+        }
+        case kVerticalFilmFit :
+        {
+            pixelScale = l.portHeight / cam.overscan / cam.verticalFilmAperture / zoom;
+            portGeom.x -= (panX * pixelScale);
+            portGeom.y -= (panY * pixelScale);
+            break;
+        }
+        default:
+        {
+            reportError( s.name + " invalid camera film fit (" + filmFit + ")");
+            break;
+        }
+    }
+
+    // If the reticle is in relativeFilmback mode, then scale the reticle filmback to fit the camera filmback
+    if (filmback.relativeFilmback)
+    {
+        double aspectRatio = filmback.horizontalFilmAperture / filmback.verticalFilmAperture;
+        if (aspectRatio > cameraAspectRatio)
+            pixelScale *= cam.horizontalFilmAperture / filmback.horizontalFilmAperture;
+        else
+            pixelScale *= cam.verticalFilmAperture / filmback.verticalFilmAperture;
+    }
+
+    // Account for lens squeeze for the filmback
+    double pixelScaleX = pixelScale * l.lensSqueezeRatio;
+
+    // Calculate the filmback width and height
+    filmback.filmbackGeom.x = filmback.horizontalFilmAperture * pixelScaleX;
+    filmback.filmbackGeom.y = filmback.verticalFilmAperture * pixelScale;
+    
+    // Calculate the actual filmback geometry corner values    
+    filmback.filmbackGeom.x1 = portGeom.x - (filmback.filmbackGeom.x / 2);
+    filmback.filmbackGeom.x2 = portGeom.x + (filmback.filmbackGeom.x / 2);
+    filmback.filmbackGeom.y1 = portGeom.y - (filmback.filmbackGeom.y / 2);
+    filmback.filmbackGeom.y2 = portGeom.y + (filmback.filmbackGeom.y / 2);
+    filmback.filmbackGeom.isValid = true;
+
+    // Set the image area to match the filmback    
+    filmback.imageGeom = filmback.filmbackGeom;
+    filmback.horizontalImageAperture	= filmback.horizontalFilmAperture;
+    filmback.verticalImageAperture		= filmback.verticalFilmAperture;
+
+    // Calculate the pad area width and height
+    if (pad.usePad && pad.isPadded)
+    {
+        pad.padGeom.x = (filmback.horizontalFilmAperture - pad.padAmountX) * pixelScaleX;
+        pad.padGeom.y = (filmback.verticalFilmAperture - pad.padAmountY) * pixelScale;
+
+        // Calculate rest of the pad area
+        pad.padGeom.x1 = portGeom.x - (pad.padGeom.x / 2);
+        pad.padGeom.x2 = portGeom.x + (pad.padGeom.x / 2);
+        pad.padGeom.y1 = portGeom.y - (pad.padGeom.y / 2);
+        pad.padGeom.y2 = portGeom.y + (pad.padGeom.y / 2);
+        pad.padGeom.isValid = true;
+
+        //Update the image area
+        filmback.horizontalImageAperture -= pad.padAmountX;
+        filmback.verticalImageAperture -= pad.padAmountY;
+    }
+
+    // Adjust for sound track if necessary
+    double imageOffsetX = 0;
+    if (filmback.soundTrackWidth > EPSILON)
+    {
+        filmback.horizontalImageAperture -= filmback.soundTrackWidth;
+        imageOffsetX = (filmback.soundTrackWidth * pixelScaleX) / 2.0;
+    }
+
+    // Calculate the image area width & height
+    filmback.imageGeom.x = filmback.horizontalImageAperture * pixelScaleX;
+    filmback.imageGeom.y = filmback.verticalImageAperture * pixelScale;
+    
+    // Calculate the actual filmback geometry corner values    
+    filmback.imageGeom.x1 = (portGeom.x + imageOffsetX) - (filmback.imageGeom.x / 2.0f);
+    filmback.imageGeom.x2 = (portGeom.x + imageOffsetX) + (filmback.imageGeom.x / 2.0f);
+    filmback.imageGeom.y1 = portGeom.y - (filmback.imageGeom.y / 2.0f);
+    filmback.imageGeom.y2 = portGeom.y + (filmback.imageGeom.y / 2.0f);
+    filmback.imageGeom.isValid = true;
+
+    // reset safe action/title    
+    filmback.safeActionGeom.isValid = false;
+    filmback.safeTitleGeom.isValid = false;
+}
+
+// This method calculates the actual mask x,y values for a given Geom
+// instance.
+//
+static void calcMaskGeom(const Layout & l, Geom & g, double w, double h, const Geom & gSrc,
+                         double wSrc, double hSrc)
+{
+    double pw = (w >= 0)?((wSrc-w)/2.0)/wSrc:(1.0-wSrc)/2.0;
+    double ph = (h >= 0)?((hSrc-h)/2.0)/hSrc:(1.0-hSrc)/2.0;
+
+    g.x = gSrc.x*pw*l.lensSqueezeRatio;
+    g.y = gSrc.y*ph;
+
+    g.x1 = gSrc.x1+g.x;
+    g.x2 = gSrc.x2-g.x;
+    g.y1 = gSrc.y1+g.y;
+    g.y2 = gSrc.y2-g.y;
+}
+
+// This method calculates the safe action area for the filmback.
+//
+static void calcFilmbackSafeActionGeom( Layout & l )
+{
+    Filmback &filmback = l.filmback;
+    calcMaskGeom(l,filmback.safeActionGeom,filmback.horizontalSafeAction,filmback.verticalSafeAction,filmback.imageGeom,filmback.horizontalImageAperture,filmback.verticalImageAperture);
+    filmback.safeActionGeom.isValid = true;
+}
+
+// This method calculates the safe title area for the filmback.
+//
+static void calcFilmbackSafeTitleGeom( Layout & l )
+{
+    Filmback &filmback = l.filmback;
+    calcMaskGeom(l,filmback.safeTitleGeom,filmback.horizontalSafeTitle,filmback.verticalSafeTitle,filmback.imageGeom,filmback.horizontalImageAperture,filmback.verticalImageAperture);
+    filmback.safeTitleGeom.isValid = true;
+}
+
+// Calculates the safe action geometry for an Aspect Ratio.
+//
+static void calcSafeActionGeom( const Layout & l, Aspect_Ratio & ar )
+{
+    if ( ar.aspectGeom.isValid )
+    {
+        ar.safeActionGeom = ar.aspectGeom;
+        calcMaskGeom(l, ar.safeActionGeom, -1, -1, ar.aspectGeom, 0.9, 0.9);
+        ar.safeActionGeom.isValid = true;
+    }
+    else
+    {
+        ar.safeActionGeom.isValid = false;
+    }
+}
+
+// Calculates the safe title geometry for an Aspect Ratio.
+//
+static void calcSafeTitleGeom( const Layout & l, Aspect_Ratio & ar )
+{
+    if (ar.aspectGeom.isValid)
+    {
+        ar.safeTitleGeom = ar.aspectGeom;
+        calcMaskGeom(l, ar.safeTitleGeom, -1, -1, ar.aspectGeom, 0.8, 0.8);
+        ar.safeTitleGeom.isValid = true;
+    }
+    else
+    {
+        ar.safeTitleGeom.isValid = false;
+    }
+}
+
+// This calculates the various Geom instances for a particular aspectRatio
+// instance.
+//
+static void calcAspectGeom( const Layout & l, Aspect_Ratio & ar )
+{
+    const Filmback &filmback = l.filmback;
+
+    ar.aspectGeom.x = filmback.imageGeom.x / l.lensSqueezeRatio;
+    ar.aspectGeom.y = ar.aspectGeom.x / ar.aspectRatio;
+
+    ar.aspectGeom.x1 = filmback.imageGeom.x1;
+    ar.aspectGeom.x2 = filmback.imageGeom.x2;
+    ar.aspectGeom.y1 = l.portGeom.y - (ar.aspectGeom.y / 2);
+    ar.aspectGeom.y2 = l.portGeom.y + (ar.aspectGeom.y / 2);
+
+    ar.aspectGeom.isValid = true;
+    ar.safeActionGeom.isValid = false;
+    ar.safeTitleGeom.isValid = false;
+
+    if (ar.displaySafeAction)
+        calcSafeActionGeom(l, ar);
+
+    if (ar.displaySafeTitle)
+        calcSafeTitleGeom(l, ar);
+}
+
+// This calculates the PanScan Geom instances.
+//
+static void calcPanScanGeom( const Layout & l, PanScan & ps )
+{
+    const Filmback &filmback = l.filmback;
+
+    //Calculate the aspect ratio of the filmback to later determine the fit of the pan/scan area    
+    float aspectRatio = filmback.horizontalImageAperture / filmback.verticalImageAperture;
+    
+    //If the aspect ratio of the pan/scan area is not set, use the filmback's aspect ratio    
+    if (ps.aspectRatio < 0)
+        ps.aspectRatio = aspectRatio;
+
+    //Determine the fit of the pan/scan & pan/scan area against the filmback    
+    if (ps.aspectRatio > aspectRatio && ps.panScanRatio < ps.aspectRatio)
+    {
+        ps.aspectGeom.y = (filmback.imageGeom.x / l.lensSqueezeRatio) / ps.aspectRatio;
+        ps.aspectGeom.x = ps.aspectGeom.y * ps.panScanRatio;
+    }
+    else if (ps.panScanRatio > aspectRatio)
+    {
+        ps.aspectGeom.x = filmback.imageGeom.x / l.lensSqueezeRatio;
+        ps.aspectGeom.y = ps.aspectGeom.x / ps.panScanRatio;
+    }
+    else
+    {
+        ps.aspectGeom.y = filmback.imageGeom.y;
+        ps.aspectGeom.x = ps.aspectGeom.y * ps.panScanRatio;
+    }
+    
+    //Adjust for lens squeeze
+    ps.aspectGeom.x *= l.lensSqueezeRatio;
+
+    ps.aspectGeom.x1 = filmback.imageGeom.x1+ ( ((ps.panScanOffset+1)/2)*(filmback.imageGeom.x-ps.aspectGeom.x) );
+    ps.aspectGeom.x2 = ps.aspectGeom.x1+ps.aspectGeom.x;
+    ps.aspectGeom.y1 = l.portGeom.y - (ps.aspectGeom.y / 2.0f);
+    ps.aspectGeom.y2 = l.portGeom.y + (ps.aspectGeom.y / 2.0f);
+
+    ps.aspectGeom.isValid = true;
+    ps.safeActionGeom.isValid = false;
+    ps.safeTitleGeom.isValid = false;
+
+    if (ps.displaySafeAction)
+        calcSafeActionGeom( l, ps );
+
+    if (ps.displaySafeTitle)
+        calcSafeTitleGeom( l, ps );
+}
+
+static bool getTextLevelGeometry(const ReticleSettings &s, Layout &l, const TextData *td, Geom &g, const int i)
+{
+    Filmback &filmback = l.filmback;
+    std::vector<Aspect_Ratio> &ars = l.ars;
+    PanScan &panScan = l.panScan;
+
+    switch (td->textLevel)
+    {
+        case 0:
+            g = l.portGeom;
+            break;
+        case 1:
+            g = l.pad.padGeom;
+            break;
+        case 2:
+            {
+                switch (td->textType)
+                {
+                    case 19:
+                        if (!filmback.safeActionGeom.isValid)
+                            calcFilmbackSafeActionGeom(l);
+                        g = filmback.safeActionGeom;
+                        break;
+                    case 20:
+                        if (!filmback.safeTitleGeom.isValid)
+                            calcFilmbackSafeTitleGeom(l);
+                        g = filmback.safeTitleGeom;
+                        break;
+                    default:
+                        g = filmback.filmbackGeom;
+                        break;
+                }
+            }
+            break;
+        case 3:
+            if (!filmback.displayProjGate)
+            {
+                reportError( s.name + " cannot anchor text item " + i + " to undisplayed projection mask");
+                return false;
+            }
+            g = filmback.projGeom;
+            break;
+        case 4:
+            {
+                int level = td->textARLevel;
+                if (level < 0 || level >= (int)ars.size())
+                {
+                    reportError( s.name + " invalid aspect ratio level (" + td->textARLevel + ") for text item " + i);
+                    return false;
+                }
+                
+                if (!ars[level].aspectGeom.isValid)
+                    return false;
+                
+                switch (td->textType)
+                {
+                    case 19:
+                        if (!ars[level].safeActionGeom.isValid)
+                            calcSafeActionGeom(l, ars[level]);
+                        g = ars[level].safeActionGeom;
+                        break;
+                    case 20:
+                        if (!ars[level].safeTitleGeom.isValid)
+                            calcSafeTitleGeom(l, ars[level]);
+                        g = ars[level].safeTitleGeom;
+                        break;
+                    default:
+                        g = ars[level].aspectGeom;
+                        break;
+                }
+            }
+            break;
+        case 5:
+            {
+                if (!panScan.aspectGeom.isValid)
+                    calcPanScanGeom( l, panScan );
+                
+                switch (td->textType)
+                {
+                    case 19:
+                        if (!panScan.safeActionGeom.isValid)
+                            calcSafeActionGeom(l, panScan);
+                        g = panScan.safeActionGeom;
+                        break;
+                    case 20:
+                        if (!panScan.safeTitleGeom.isValid)
+                            calcSafeTitleGeom(l, panScan);
+                        g = panScan.safeTitleGeom;
+                        break;
+                    default:
+                        g = panScan.aspectGeom;
+                        break;
+                }
+            }
+            break;
+        default:
+            reportError( s.name + " invalid text anchor for text item " + i);
+            break;
+    }
+    
+    return true;
+}
+
+static bool calcTextPosition(const ReticleSettings &s, const TextData *td, const Geom &g, double &x, double &y, const int i)
+{
+    switch (td->textPosRel)
+    {
+        case 0:						//Bottom Left
+            x = g.x1;
+            y = g.y1;
+            break;
+        case 1:						//Bottom Center
+            x = (g.x1 + g.x2 ) / 2;
+            y = g.y1;
+            break;
+        case 2:						//Bottom Right
+            x = g.x2;
+            y = g.y1;
+            break;
+        case 3:						//Middle Left
+            x = g.x1;
+            y = (g.y1 + g.y2 ) / 2;
+            break;
+        case 4:						//Center
+            x = (g.x1 + g.x2 ) / 2;
+            y = (g.y1 + g.y2 ) / 2;
+            break;
+        case 5:						//Middle Right
+            x = g.x2;
+            y = (g.y1 + g.y2 ) / 2;
+            break;
+        case 6:						//Top Left
+            x = g.x1;
+            y = g.y2;
+            break;
+        case 7:						//Top Center
+            x = (g.x1 + g.x2 ) / 2;
+            y = g.y2;
+            break;
+        case 8:						//Top Right
+            x = g.x2;
+            y = g.y2;
+            break;
+        default:
+            reportError( s.name + " invalid text relative position (" + td->textPosRel + ") for text item " + i);
+            return false;
+    }
+    
+    return true;
+}
+
+static void drawCustomTextElements(const ReticleSettings &s, const CameraState &cam, Layout &l, GPURenderer* renderer)
+{
+    if (!cam.text.size())
+        return;
+
+    const TextData *td;
+
+    // Make sure everything is ready for drawing text
+    renderer->enableTextRendering();
+
+    Geom g;
+    for (int i = 0; i < (int)cam.text.size(); i++)
+    {
+        td = &cam.text[i];
+
+        // If the text is not enabled, or its dynamic text could not be
+        // resolved by prepForDraw, skip it
+        if (!td->textEnabled)
+            continue;
+
+        // Determine the level geometry
+        if (!getTextLevelGeometry(s, l, td, g, i))
+            continue;
+
+        // Determine the position
+        double x,y;
+        if (!calcTextPosition(s,td,g,x,y,i))
+            continue;
+
+        // Actually draw the text
+        renderer->drawText( td, x, y);
+    }
+
+    // Disable text rendering
+    renderer->disableTextRendering();
+}
+
+// Draws the statistics of the previous frames in the bottom left corner of
+// the port. The GPU times lag a few frames behind, see OpenGLRenderer.
+//
+static void drawStatsLabel(const ReticleSettings &s, GPURenderer* renderer)
+{
+    const RenderStats *stats = renderer->getStats();
+    if (!stats)
+        return;
+
+    char label[256];
+    if (stats->gpuFrames)
+        sprintf(label,
+                 "cpu %.2f ms  gpu %.2f ms (masks %.2f  lines %.2f  text %.2f)  calls %u  cached %u/%u",
+                 stats->lastTime * 1000.0, stats->gpuTime * 1000.0, stats->gpuMaskTime * 1000.0,
+                 stats->gpuLineTime * 1000.0, stats->gpuTextTime * 1000.0,
+                 stats->drawCalls, stats->cachedFrames, stats->frames);
+    else
+        sprintf(label, "cpu %.2f ms  calls %u  cached %u/%u",
+                 stats->lastTime * 1000.0, stats->drawCalls, stats->cachedFrames, stats->frames);
+
+    TextData td;
+    td.textType = 0;
+    td.textStr = label;
+    td.textAlign = 0;
+    td.textVAlign = 0;
+    td.textPosX = 0.0;
+    td.textPosY = 0.0;
+    td.textPosRel = 0;
+    td.textLevel = 0;
+    td.textARLevel = 0;
+    td.textColor = s.options.textColor;
+    td.textEnabled = true;
+    td.textSize = 12;
+    td.textBold = false;
+    td.textScale = false;
+
+    renderer->enableTextRendering();
+    renderer->drawText( &td, 10.0, 10.0 );
+    renderer->disableTextRendering();
+}
+
+// These hash everything drawReticle reads, split between what the masks and
+// lines depend on and what the text depends on. The geometry depends on the
+// settings through their version, the camera state and the port size. The
+// maximum distance of the camera only matters through whether it is over the
+// maximum distance setting. The text is hashed as resolved for the camera,
+// which is where the time ends up, at the displayed precision.
+//
+static unsigned long long geometryHash(const ReticleSettings &s, int width, int height, const CameraState & cam)
+{
+    InputHash h;
+
+    h.add(s.configVersion);
+    h.add(width);
+    h.add(height);
+
+    h.add(cam.name);
+    h.add(cam.focalLength);
+    h.add(cam.horizontalFilmAperture);
+    h.add(cam.verticalFilmAperture);
+    h.add(cam.lensSqueezeRatio);
+    h.add(cam.filmFit);
+    h.add(cam.panX);
+    h.add(cam.panY);
+    h.add(cam.zoom);
+    h.add(cam.overscan);
+    h.add(int(s.options.maximumDistance > 0 && fabs(cam.maximumDist) >= s.options.maximumDistance));
+
+    return h.value;
+}
+
+static unsigned long long textHash(const CameraState & cam)
+{
+    InputHash h;
+
+    for (size_t i = 0; i < cam.text.size(); i++)
+    {
+        const TextData &td = cam.text[i];
+        h.add(td.textType);
+        h.add(td.textStr);
+        h.add(td.textAlign);
+        h.add(td.textVAlign);
+        h.add(td.textPosX);
+        h.add(td.textPosY);
+        h.add(td.textPosRel);
+        h.add(td.textLevel);
+        h.add(td.textARLevel);
+        h.add(td.textColor);
+        h.add(int(td.textEnabled));
+        h.add(td.textSize);
+        h.add(int(td.textBold));
+        h.add(int(td.textScale));
+    }
+
+    return h.value;
+}
+
+// This draws the text of a frame whose geometry is in the layout: the field
+// guide numbers, the custom text elements and the statistics label.
+//
+static void drawTextElements(const ReticleSettings &s, const CameraState & cam, Layout & layout, GPURenderer* renderer)
+{
+    // Display Field Guide numbers
+    if ( s.options.displayFieldGuide)
+    {
+        const Filmback &filmback = layout.filmback;
+
+        //Calculate constants
+        int numLines = FIELDGUIDE_NUM_LINES;
+
+        double sx = (filmback.imageGeom.x / 2.0) / double(numLines+1);
+        double sy = (filmback.imageGeom.y / 2.0) / double(numLines+1);
+
+        //Draw Numbers
+        TextData td;
+        td.textAlign = 1;
+        td.textVAlign = 1;
+        td.textSize = 12;
+        td.textBold = false;
+        td.textColor = s.options.textColor;
+        td.textPosX = 0;
+        td.textPosY = 0;
+        td.textScale = false;
+
+        renderer->enableTextRendering();
+        for (int i = 1; i <= numLines; i++)
+        {
+            double lx = sx * i;
+            double lx1 = filmback.imageGeom.x1 + lx;
+            double lx2 = filmback.imageGeom.x2 - lx;
+
+            double ly = sy * i;
+            double ly1 = filmback.imageGeom.y1 + ly;
+            double ly2 = filmback.imageGeom.y2 - ly;
+
+            //Draw text
+            td.textStr.set((numLines - i)+1);
+            renderer->drawText(&td,lx1,ly1);
+            renderer->drawText(&td,lx2,ly1);
+            renderer->drawText(&td,lx1,ly2);
+            renderer->drawText(&td,lx2,ly2);
+        }
+        renderer->disableTextRendering();
+    }
+
+    // Draw custom text elements
+    if ( s.options.enableTextDrawing )
+        drawCustomTextElements(s, cam, layout, renderer);
+
+    if ( s.options.displayStats )
+        drawStatsLabel(s, renderer);
+}
+
+// This is the main function which draws the reticle.
+//
+bool drawReticle(const ReticleSettings & s, const CameraState & cam, int width, int height, Layout & layout, GPURenderer* renderer)
+{
+    double frameStart = RenderStats::now();
+    
+    // Draw the last frame of the view again if none of its inputs changed.
+    // If only the text changed, as it does on every frame of a playback,
+    // the masks and lines are kept and only the text is drawn. The
+    // statistics label changes every frame, so it is always drawn.
+    unsigned long long geometry = geometryHash(s, width, height, cam);
+    unsigned long long text = textHash(cam);
+    if (layout.renderer == renderer && layout.geometryHash == geometry)
+    {
+        if (!s.options.displayStats && layout.textHash == text &&
+            renderer->redraw(float(width), float(height)))
+        {
+            if (renderer->getStats())
+            {
+                renderer->getStats()->skippedFrames++;
+                renderer->getStats()->addFrame(RenderStats::now() - frameStart);
+            }
+            return false;
+        }
+
+        if (renderer->redrawGeometry(float(width), float(height)))
+        {
+            layout.textHash = text;
+            drawTextElements(s, cam, layout, renderer);
+            renderer->postDraw();
+
+            if (renderer->getStats())
+            {
+                renderer->getStats()->textFrames++;
+                renderer->getStats()->addFrame(RenderStats::now() - frameStart);
+            }
+            return false;
+        }
+    }
+    layout.geometryHash = geometry;
+    layout.textHash = text;
+    layout.renderer = renderer;
+
+    // Start from the settings. Everything below is computed into the layout
+    // of the view, the settings themselves are only read.
+    layout.portWidth = double(width);
+    layout.portHeight = double(height);
+    layout.lensSqueezeRatio = cam.lensSqueezeRatio;
+    layout.filmback = s.filmback;
+    layout.pad = s.pad;
+    layout.panScan = s.panScan;
+    layout.ars = s.ars;
+
+    Filmback &filmback = layout.filmback;
+    PadOptions &pad = layout.pad;
+    PanScan &panScan = layout.panScan;
+    std::vector<Aspect_Ratio> &ars = layout.ars;
+    const Geom &portGeom = layout.portGeom;
+
+    // Calculate the port geometry
+    calcPortGeom(layout);
+
+    // Peform the calculations necessary to define the filmback geometry.
+    calcFilmbackGeom(s, cam, layout);
+
+    // Calculate the projection gate geometry
+    if (filmback.displayProjGate)
+        calcMaskGeom(layout,filmback.projGeom,filmback.horizontalProjectionGate,filmback.verticalProjectionGate,filmback.imageGeom,filmback.horizontalImageAperture,filmback.verticalImageAperture);
+
+    // Calculate the safe action geometry
+    if (filmback.displaySafeAction)
+        calcFilmbackSafeActionGeom(layout);
+
+    // Calculate the safe title geometry
+    if (filmback.displaySafeTitle)
+        calcFilmbackSafeTitleGeom(layout);
+
+    // Calculate the projection gate geometry
+    if (panScan.displayMode != 0)
+        calcPanScanGeom( layout, panScan );
+
+    // Calculate the aspect ratio geometry
+    for (int i = 0; i < (int)ars.size(); i++ )
+    {
+        // Only calculate the aspect geom if the display mode != 0
+        if (ars[i].displayMode != 0)
+        {
+            calcAspectGeom( layout, ars[i] );
+        }
+    }
+    
+    // Set the filmback and line width for the renderer
+    renderer->setFilmback(&filmback);
+    renderer->setLineWidth(s.options.lineWidth);
+
+    // Get everything setup for rendering
+    renderer->prepareForDraw(layout.portWidth, layout.portHeight);
+    
+    // create variable to store what the first geometry object to draw aspect ratios to
+    Geom aspectContainerGeom = portGeom;
+    Geom filmbackGeom = filmback.filmbackGeom;
+
+    // Draw all of the masks first, so that no line or text ends up below a
+    // mask. The renderer batches them and draws them all at once.
+
+    // Draw the filmback Mask
+    if ( filmback.displayFilmGate == 3 )
+    {
+        renderer->drawMask(aspectContainerGeom, filmbackGeom, filmback.filmbackGeom.maskColor, 1);
+        aspectContainerGeom = filmback.filmbackGeom;
+    }
+
+    // Draw the padGeomMask
+    if (pad.usePad && pad.isPadded)
+    {
+        if (pad.displayMode == 3)
+            renderer->drawMask(aspectContainerGeom, pad.padGeom, pad.padGeom.maskColor, true);
+        aspectContainerGeom = pad.padGeom;
+    }
+    
+    // Draw the aspectRatio masks
+    Aspect_Ratio ar;
+    for (int i = 0; i < (int)ars.size(); i++ )
+    {
+        ar = ars[i];
+        // Draw the masks as Quads
+        if (ar.displayMode == 3)
+        {
+            Geom g = (i == 0)?aspectContainerGeom:ars[i-1].aspectGeom;
+            MColor maskColor = ar.aspectGeom.maskColor;
+            // Draw the mask in red if over the max distance
+            if (s.options.maximumDistance > 0 &&
+                fabs(cam.maximumDist) >= s.options.maximumDistance)
+            {
+                if (i == 0)
+                {
+                    maskColor = MColor(1,0,0,maskColor.a);
+                }
+                else
+                {
+                    maskColor *= MColor(1.5,0.5,0.5,1);
+                }
+            }
+            //drawMask(g, ar.aspectGeom, maskColor, (i == 0 && !(pad.usePad && pad.isPadded)) );
+            renderer->drawMask(g, ar.aspectGeom, maskColor, i == 0);
+            
+            if ( ar.displaySafeAction == 3 )
+            {
+                float sf = (ar.displaySafeTitle == 3) ? 0.66 : 0.5;
+                MColor c = MColor(maskColor.r,maskColor.g,maskColor.b,1+((maskColor.a-1) * sf));
+                renderer->drawMask(ar.aspectGeom,ar.safeActionGeom,c,true);
+            }
+            if ( ar.displaySafeTitle == 3 )
+            {
+                float sf = (panScan.displaySafeAction == 3) ? 0.33 : 0.5;
+                MColor c = MColor(maskColor.r,maskColor.g,maskColor.b,1+((maskColor.a-1) * sf));
+                if ( ar.displaySafeAction == 3 )
+                    renderer->drawMask(ar.safeActionGeom,ar.safeTitleGeom,c,true);
+                else
+                    renderer->drawMask(ar.aspectGeom,ar.safeTitleGeom,c,true);
+            }
+        }
+    }
+
+    // Draw the panScan masks
+    if ( panScan.displayMode == 2 )
+    {
+        renderer->drawMask(filmback.imageGeom, panScan.aspectGeom, panScan.aspectGeom.maskColor, true, false );
+        
+        Geom g = panScan.aspectGeom;
+        
+        if ( panScan.displaySafeAction == 3 )
+        {
+            float sf = (panScan.displaySafeTitle == 3) ? 0.66 : 0.5;
+            MColor c = MColor(panScan.aspectGeom.maskColor.r,panScan.aspectGeom.maskColor.g,panScan.aspectGeom.maskColor.b,1+((panScan.aspectGeom.maskColor.a-1) * sf));
+            renderer->drawMask(panScan.aspectGeom,panScan.safeActionGeom, c, true );
+            g = panScan.safeActionGeom;
+        }
+        
+        if ( panScan.displaySafeTitle == 3 )
+        {
+            float sf = (panScan.displaySafeAction == 3) ? 0.33 : 0.5;
+            MColor c = MColor(panScan.aspectGeom.maskColor.r,panScan.aspectGeom.maskColor.g,panScan.aspectGeom.maskColor.b,1+((panScan.aspectGeom.maskColor.a-1) * sf));
+            renderer->drawMask(g,panScan.safeTitleGeom, c, true );
+        }
+    }
+
+    // Draw the projection gate mask
+    if ( filmback.displayProjGate == 3 )
+        renderer->drawMask(filmback.filmbackGeom, filmback.projGeom, filmback.projGeom.maskColor, 1);
+
+    // Draw the batched masks
+    renderer->flushMasks();
+
+    // Draw the filmback
+    if ( filmback.displayFilmGate )
+    {
+        // Draw filmback Line
+        renderer->drawLines(filmback.filmbackGeom, filmback.filmbackGeom.lineColor, 1, filmback.displayFilmGate == 2);
+        
+        // Draw Sound Area Line
+        if ( filmback.soundTrackWidth > EPSILON )
+            renderer->drawLine(filmback.imageGeom.x1, filmback.imageGeom.x1, filmback.imageGeom.y1, filmback.imageGeom.y2, filmback.imageGeom.lineColor, 0 );
+    }
+
+    // Draw the aspectRatio lines
+    for (int i = 0; i < (int)ars.size(); i++ )
+    {
+        ar = ars[i];
+
+        if (ar.displayMode != 0)
+        {
+            bool sides = (i == 0 || (fabs(ar.aspectGeom.x - ars[i].aspectGeom.x) > EPSILON) );
+            renderer->drawLines(ar.aspectGeom, ar.aspectGeom.lineColor, sides, ar.displayMode == 2);
+            // Draw safe action
+            if (ar.displaySafeAction)
+                renderer->drawLines( ar.safeActionGeom, ar.safeActionGeom.lineColor, true, ar.displaySafeAction == 2);
+
+            // Draw safe title
+            if (ar.displaySafeTitle)
+                renderer->drawLines( ar.safeTitleGeom, ar.safeTitleGeom.lineColor, true, ar.displaySafeTitle == 2);
+        }
+    }
+
+    // Draw the panScan
+    if ( panScan.displayMode != 0 )
+    {
+        renderer->drawLines(panScan.aspectGeom, panScan.aspectGeom.lineColor, 1, 0);
+        
+        // Draw safe action
+        if (panScan.displaySafeAction)
+        {
+            renderer->drawLines( panScan.safeActionGeom, panScan.safeActionGeom.lineColor, true, panScan.displaySafeAction == 2);
+        }
+
+        // Draw safe title
+        if (panScan.displaySafeTitle)
+        {
+            renderer->drawLines( panScan.safeTitleGeom, panScan.safeTitleGeom.lineColor, true, panScan.displaySafeTitle == 2);
+        }
+    }
+
+    // Draw the projection gate
+    if ( filmback.displayProjGate )
+    {
+        renderer->drawLines(filmback.projGeom, filmback.projGeom.lineColor, 1, filmback.displayProjGate == 2);
+    }
+
+    // Draw filmback safe action
+    if (filmback.displaySafeAction)
+    {
+        renderer->drawLines( filmback.safeActionGeom, filmback.safeActionGeom.lineColor, 1, filmback.displaySafeAction == 2);
+    }
+
+    // Draw filmback safe title
+    if (filmback.displaySafeTitle)
+    {
+        renderer->drawLines( filmback.safeTitleGeom, filmback.safeTitleGeom.lineColor, 1, filmback.displaySafeTitle == 2);
+    }
+
+    // Display horizontal line
+    if ( s.options.displayLineH )
+    {
+        renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, portGeom.y, portGeom.y, s.options.lineColor, 0 );
+    }
+
+    // Display vertical line
+    if ( s.options.displayLineV )
+    {
+        double cx = ( filmback.imageGeom.x1 + filmback.imageGeom.x2 ) / 2;
+        renderer->drawLine( cx, cx, filmback.imageGeom.y1, filmback.imageGeom.y2, s.options.lineColor, 0 );
+    }
+
+    // Display Horizontal Thirds
+    if ( s.options.displayThirdsH)
+    {
+        Geom g = aspectContainerGeom;
+        double y1 = g.y1+ ( ( g.y2 - g.y1 ) * 0.33 );
+        double y2 = g.y1+ ( ( g.y2 - g.y1 ) * 0.66 );
+        renderer->drawLine( g.x1, g.x2, y1, y1, s.options.lineColor, 0 );
+        renderer->drawLine( g.x1, g.x2, y2, y2, s.options.lineColor, 0 );
+    }
+
+    // Display Vertical Thirds
+    if ( s.options.displayThirdsV)
+    {
+        Geom g = aspectContainerGeom;
+        double x1 = g.x1+ ( ( g.x2 - g.x1 ) * 0.33 );
+        double x2 = g.x1+ ( ( g.x2 - g.x1 ) * 0.66 );
+        renderer->drawLine( x1, x1, g.y1, g.y2, s.options.lineColor, 0 );
+        renderer->drawLine( x2, x2, g.y1, g.y2, s.options.lineColor, 0 );
+    }
+
+    // Display crosshair
+    if ( s.options.displayCrosshair )
+    {
+        double cx = ( filmback.imageGeom.x1 + filmback.imageGeom.x2 ) / 2;
+        renderer->drawLine( cx-25, cx-5, portGeom.y, portGeom.y, s.options.lineColor, 0 );
+        renderer->drawLine( cx+25, cx+5, portGeom.y, portGeom.y, s.options.lineColor, 0 );
+        renderer->drawLine( cx, cx, portGeom.y-25, portGeom.y-5, s.options.lineColor, 0 );
+        renderer->drawLine( cx, cx, portGeom.y+25, portGeom.y+5, s.options.lineColor, 0 );
+    }
+    
+    // Display Field Guide
+    if ( s.options.displayFieldGuide)
+    {
+        //Calculate constants
+        int numLines = FIELDGUIDE_NUM_LINES;
+
+        double cx = ( filmback.imageGeom.x1 + filmback.imageGeom.x2 ) / 2.0;
+        double cy = ( filmback.imageGeom.y1 + filmback.imageGeom.y2 ) / 2.0;
+
+        double sx = (filmback.imageGeom.x / 2.0) / double(numLines+1);
+        double sy = (filmback.imageGeom.y / 2.0) / double(numLines+1);
+        
+        //If the filmback is not being drawn, then draw lines for it
+        if ( !filmback.displayFilmGate )
+            renderer->drawLines(filmback.filmbackGeom, s.options.lineColor, 1, 0);
+
+        //Draw field guide lines
+        for (int i = 1; i <= numLines; i++)
+        {
+            //Draw horizontal lines
+            double lx = sx * i;
+            double lx1 = filmback.imageGeom.x1 + lx;
+            double lx2 = filmback.imageGeom.x2 - lx;
+            
+            renderer->drawLine( lx1, lx1, filmback.imageGeom.y1, filmback.imageGeom.y2, s.options.lineColor, 0);
+            renderer->drawLine( lx2, lx2, filmback.imageGeom.y1, filmback.imageGeom.y2, s.options.lineColor, 0);
+            
+            //Draw vertical lines
+            double ly = sy * i;
+            double ly1 = filmback.imageGeom.y1 + ly;
+            double ly2 = filmback.imageGeom.y2 - ly;
+            
+            renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, ly1, ly1, s.options.lineColor, 0);
+            renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, ly2, ly2, s.options.lineColor, 0);
+        }
+
+        //Draw center lines
+        renderer->drawLine( cx, cx, filmback.imageGeom.y1, filmback.imageGeom.y2, s.options.lineColor, 0);
+        renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, cy, cy, s.options.lineColor, 0);
+        
+        //Draw Diagonal lines
+        renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, filmback.imageGeom.y1, filmback.imageGeom.y2, s.options.lineColor, 0);
+        renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, filmback.imageGeom.y2, filmback.imageGeom.y1, s.options.lineColor, 0);
+    }
+
+    // Display the pad area
+    if (pad.usePad && pad.isPadded && pad.displayMode > 0)
+    {
+        renderer->drawLines(pad.padGeom, pad.padGeom.lineColor, 1, pad.displayMode == 2);
+    }
+
+    // Draw the text last, drawReticle can draw it again on its own
+    drawTextElements(s, cam, layout, renderer);
+
+    // Clean-up after draw
+    renderer->postDraw();
+    
+    if (renderer->getStats())
+        renderer->getStats()->addFrame(RenderStats::now() - frameStart);
+
+    return true;
+}
@@ -0,0 +1,60 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  ReticleDraw.h
+//  spReticle
+//
+
+#ifndef spReticle_ReticleDraw_h
+#define spReticle_ReticleDraw_h
+
+#include "util.h"
+#include "GPURenderer.h"
+
+// Lays a reticle out for the camera state and a port of the given size into
+// layout and draws it with renderer. Only the layout is written, so that the
+// views of a node can draw the same settings at the same time. The frame is
+// counted in the statistics the renderer was given. Returns whether the frame
+// was computed and drawn in full, rather than drawn again or with new text
+// only. Used by spReticleLoc::drawBase and by the tests, without Maya.
+bool drawReticle(const ReticleSettings & settings, const CameraState & cam, int width, int height,
+                 Layout & layout, GPURenderer* renderer);
+
+// Reports the errors in the settings found while drawing, such as text
+// anchored to a mask that is not displayed. They go to std::cerr until the
+// plugin sets a handler that shows them in Maya.
+typedef void (*ReticleErrorHandler)(const MString & message);
+void setReticleErrorHandler(ReticleErrorHandler handler);
+
+#endif
@@ -0,0 +1,307 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  ShotMetadata.cpp
+//  spReticle
+//
+
+#include <iostream>
+#include <string.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#	include <stdio.h>
+#else
+#	include <fcntl.h>
+#	include <unistd.h>
+#	include <sys/mman.h>
+#endif
+
+#include "defines.h"
+
+#include "ShotMetadata.h"
+
+ShotMetadata::ShotMetadata()
+:   mtime(0),
+    inode(0),
+    fileSize(0),
+    lastCheck(0),
+    gen(1),
+    base(NULL),
+    size(0),
+    header(NULL),
+    buckets(NULL),
+    fieldNames(NULL),
+    shots(NULL),
+    strings(NULL)
+{
+}
+
+ShotMetadata::~ShotMetadata()
+{
+    unmap();
+}
+
+void ShotMetadata::setPath(const char *newPath)
+{
+    std::string p = (newPath) ? newPath : "";
+    if (p == path)
+        return;
+
+    unmap();
+    path = p;
+    mtime = 0;
+    inode = 0;
+    fileSize = 0;
+    lastCheck = 0;
+    gen++;
+}
+
+void ShotMetadata::refresh()
+{
+    if (path.empty())
+        return;
+
+    // Throttle the file system checks, whether the index could be mapped
+    // or not
+    time_t now = time(NULL);
+    if (now - lastCheck < SHOT_METADATA_CHECK_INTERVAL)
+        return;
+    lastCheck = now;
+
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0)
+    {
+        mtime = 0;
+        inode = 0;
+        fileSize = 0;
+        if (base)
+        {
+            unmap();
+            gen++;
+        }
+        return;
+    }
+
+    // The file is remembered for an invalid index too, so that it is only
+    // mapped again, and reported again, once the file was rewritten
+    if (st.st_mtime == mtime && st.st_ino == inode && st.st_size == fileSize)
+        return;
+    mtime = st.st_mtime;
+    inode = st.st_ino;
+    fileSize = st.st_size;
+
+    bool wasMapped = (base != NULL);
+    unmap();
+
+    // The references only need resolving again if the index changed
+    if (map() || wasMapped)
+        gen++;
+}
+
+// Map the index file and validate its header. On failure nothing is mapped
+// and every lookup returns NULL.
+//
+bool ShotMetadata::map()
+{
+#if defined(_WIN32)
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f)
+        return false;
+
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    char *data = new char[size];
+    if (fread(data, 1, size, f) != size)
+    {
+        delete [] data;
+        fclose(f);
+        size = 0;
+        return false;
+    }
+    fclose(f);
+    base = data;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    size = st.st_size;
+
+    void *data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        size = 0;
+        return false;
+    }
+    base = (const char *)data;
+#endif
+
+    header = (const ShotIndexHeader *)base;
+
+    // Validate the header and the table sizes before trusting any offsets.
+    // The counts come from the file: each table is checked against the
+    // words left in the file, so that no size computation can wrap.
+    if (size >= sizeof(ShotIndexHeader) &&
+        memcmp(header->magic, SHOT_INDEX_MAGIC, 8) == 0 &&
+        header->version == SHOT_INDEX_VERSION &&
+        header->numBuckets > 0 &&
+        (header->numBuckets & (header->numBuckets - 1)) == 0)
+    {
+        unsigned long long words = (size - sizeof(ShotIndexHeader)) / sizeof(unsigned int);
+        unsigned long long recordWords = 1ULL + header->numFields;
+
+        bool fits = header->numBuckets <= words;
+        if (fits)
+        {
+            words -= header->numBuckets;
+            fits = header->numFields <= words;
+        }
+        if (fits)
+        {
+            words -= header->numFields;
+            fits = header->numShots <= words / recordWords;
+        }
+
+        size_t tables = 0;
+        if (fits)
+            tables = sizeof(ShotIndexHeader) +
+                     sizeof(unsigned int) * (size_t(header->numBuckets) +
+                                             size_t(header->numFields) +
+                                             size_t(header->numShots) * size_t(recordWords));
+
+        if (fits && header->stringsSize > 0 && header->stringsSize <= size - tables)
+        {
+            buckets    = (const unsigned int *)(base + sizeof(ShotIndexHeader));
+            fieldNames = buckets + header->numBuckets;
+            shots      = fieldNames + header->numFields;
+            strings    = base + tables;
+
+            // The string table must be NUL terminated for the lookups to be safe
+            if (strings[header->stringsSize - 1] == '\0')
+                return true;
+        }
+    }
+
+    std::cerr << "ShotMetadata: invalid shot metadata index " << path << std::endl;
+    unmap();
+    return false;
+}
+
+void ShotMetadata::unmap()
+{
+    if (base)
+    {
+#if defined(_WIN32)
+        delete [] base;
+#else
+        munmap((void *)base, size);
+#endif
+    }
+
+    base = NULL;
+    size = 0;
+    header = NULL;
+    buckets = NULL;
+    fieldNames = NULL;
+    shots = NULL;
+    strings = NULL;
+}
+
+// Open addressing lookup of a shot by name.
+//
+int ShotMetadata::findShot(const char *shot) const
+{
+    unsigned int mask = header->numBuckets - 1;
+    unsigned int slot = shotIndexHash(shot) & mask;
+
+    for (unsigned int probe = 0; probe < header->numBuckets; probe++)
+    {
+        unsigned int entry = buckets[slot];
+        if (entry == 0 || entry > header->numShots)
+            return -1;
+
+        const unsigned int *record = shots + size_t(entry - 1) * (1 + size_t(header->numFields));
+        if (record[0] < header->stringsSize && strcmp(string(record[0]), shot) == 0)
+            return int(entry - 1);
+
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
+}
+
+int ShotMetadata::findField(const char *field) const
+{
+    for (unsigned int i = 0; i < header->numFields; i++)
+    {
+        if (fieldNames[i] < header->stringsSize && strcmp(string(fieldNames[i]), field) == 0)
+            return int(i);
+    }
+
+    return -1;
+}
+
+const char *ShotMetadata::resolve(ShotFieldRef &ref)
+{
+    if (ref.generation == gen)
+        return ref.value;
+
+    ref.generation = gen;
+    ref.value = NULL;
+
+    if (!base)
+        return NULL;
+
+    int shot = findShot(ref.shot.c_str());
+    int field = findField(ref.field.c_str());
+    if (shot < 0 || field < 0)
+        return NULL;
+
+    unsigned int offset = shots[size_t(shot) * (1 + size_t(header->numFields)) + 1 + field];
+    if (offset == 0 || offset >= header->stringsSize)
+        return NULL;
+
+    ref.value = string(offset);
+    return ref.value;
+}
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  ShotMetadata.h
+//  spReticle
+//
+
+#ifndef spReticle_ShotMetadata_h
+#define spReticle_ShotMetadata_h
+
+#include <string>
+#include <stddef.h>
+#include <time.h>
+#include <sys/types.h>
+
+// Binary shot metadata index. The file is produced by the spShotIndex tool
+// from a JSON sidecar and is memory mapped read-only by the plugin.
+//
+// Layout (all integers are little-endian uint32):
+//   ShotIndexHeader
+//   uint32  bucket[numBuckets]          shot index + 1, 0 = empty slot
+//   uint32  fieldName[numFields]        string offsets of the field names
+//   uint32  shot[numShots][1+numFields] shot name offset, then one value
+//                                       offset per field (0 = missing)
+//   char    strings[]                   NUL terminated strings
+//
+// Strings are addressed by their offset from the start of the string table.
+// Offset 0 is reserved for the empty string so it can double as "missing".
+#define SHOT_INDEX_MAGIC    "SPSHOTDB"
+#define SHOT_INDEX_VERSION  1
+
+struct ShotIndexHeader
+{
+    char         magic[8];
+    unsigned int version;
+    unsigned int numShots;
+    unsigned int numFields;
+    unsigned int numBuckets;
+    unsigned int stringsSize;
+};
+
+// Hash used for the shot buckets, shared by the plugin and spShotIndex.
+inline unsigned int shotIndexHash(const char *str)
+{
+    unsigned int hash = 2166136261u;
+    while (*str)
+    {
+        hash ^= (unsigned char)(*str++);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Reference to a single field of a single shot. Labels resolve their field
+// once and hold on to the reference until the index is reloaded.
+class ShotFieldRef
+{
+public:
+    ShotFieldRef() : generation(0), value(NULL) {}
+
+    std::string  shot;
+    std::string  field;
+    unsigned int generation;
+    const char   *value;
+};
+
+class ShotMetadata
+{
+public:
+    ShotMetadata();
+    ~ShotMetadata();
+
+    // Set the path of the index file. The file is mapped lazily.
+    void setPath(const char *path);
+
+    // Remap the file if it has been modified since it was last checked. The
+    // file system is checked at most once every SHOT_METADATA_CHECK_INTERVAL
+    // seconds, even while the file is missing or invalid, so this is cheap
+    // to call once per draw.
+    void refresh();
+
+    // Incremented every time the index is (re)mapped or unmapped.
+    unsigned int generation() const { return gen; }
+
+    // Resolve ref against the current index if it is stale. Returns the
+    // value of the field, or NULL if either the shot or the field is unknown.
+    const char *resolve(ShotFieldRef &ref);
+
+private:
+    ShotMetadata(const ShotMetadata &);
+    ShotMetadata &operator=(const ShotMetadata &);
+
+    bool map();
+    void unmap();
+
+    int findShot(const char *shot) const;
+    int findField(const char *field) const;
+
+    const char *string(unsigned int offset) const { return strings + offset; }
+
+    // The file the index was last checked against. The modification time
+    // only has a one second resolution, so an index replaced twice within
+    // a second is told apart by its inode and size.
+    std::string  path;
+    time_t       mtime;
+    ino_t        inode;
+    off_t        fileSize;
+    time_t       lastCheck;
+    unsigned int gen;
+
+    const char            *base;
+    size_t                size;
+    const ShotIndexHeader *header;
+    const unsigned int    *buckets;
+    const unsigned int    *fieldNames;
+    const unsigned int    *shots;
+    const char            *strings;
+};
+
+#endif
@@ -0,0 +1,453 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  SoftwareRenderer.cpp
+//  spReticle
+//
+
+#include <math.h>
+#include <algorithm>
+
+#if defined(_WIN32)
+#	include <windows.h>
+#else
+#	include <pthread.h>
+#	include <unistd.h>
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_IX86)
+#	include <xmmintrin.h>
+#	define SOFTWARE_RENDERER_SSE
+#endif
+
+#include "SoftwareRenderer.h"
+
+// Blend a premultiplied color, scaled by the coverage, over count pixels
+static inline void blendSpan(float *dst, int count, const float *color, float coverage)
+{
+#ifdef SOFTWARE_RENDERER_SSE
+    __m128 src = _mm_mul_ps(_mm_loadu_ps(color), _mm_set1_ps(coverage));
+    __m128 inv = _mm_set1_ps(1.0f - color[3] * coverage);
+    for (int i = 0; i < count; i++, dst += 4)
+        _mm_storeu_ps(dst, _mm_add_ps(src, _mm_mul_ps(_mm_loadu_ps(dst), inv)));
+#else
+    float src[4] = { color[0] * coverage, color[1] * coverage, color[2] * coverage, color[3] * coverage };
+    float inv = 1.0f - src[3];
+    for (int i = 0; i < count; i++, dst += 4)
+    {
+        dst[0] = src[0] + dst[0] * inv;
+        dst[1] = src[1] + dst[1] * inv;
+        dst[2] = src[2] + dst[2] * inv;
+        dst[3] = src[3] + dst[3] * inv;
+    }
+#endif
+}
+
+// The first pixel whose center is at or after x
+static inline int pixelAfter(float x)
+{
+    return int(ceilf(x - 0.5f));
+}
+
+SoftwareRenderer::SoftwareRenderer() :
+    imageWidth(0), imageHeight(0), numThreads(0)
+{
+    atlas = FontRegistry::acquire();
+}
+
+SoftwareRenderer::~SoftwareRenderer()
+{
+    FontRegistry::release();
+}
+
+void SoftwareRenderer::prepareForDraw(float portWidth, float portHeight)
+{
+    GPURenderer::prepareForDraw(portWidth, portHeight);
+    
+    primitives.clear();
+    imageWidth = std::max(int(ceilf(portWidth)), 0);
+    imageHeight = std::max(int(ceilf(portHeight)), 0);
+    image.assign(size_t(imageWidth) * imageHeight * 4, 0.0f);
+}
+
+struct SoftwareRenderer::Band
+{
+    const SoftwareRenderer *renderer;
+    int rowBegin, rowEnd;
+};
+
+#if defined(_WIN32)
+DWORD WINAPI SoftwareRenderer::rasterizeBand(LPVOID data)
+{
+    Band *band = (Band *) data;
+    band->renderer->rasterize(band->rowBegin, band->rowEnd);
+    return 0;
+}
+#else
+void *SoftwareRenderer::rasterizeBand(void *data)
+{
+    Band *band = (Band *) data;
+    band->renderer->rasterize(band->rowBegin, band->rowEnd);
+    return NULL;
+}
+#endif
+
+// Rasterize the recorded primitives. Every thread draws all of the primitives
+// clipped to its own rows, so the drawing order is kept without locking.
+//
+void SoftwareRenderer::postDraw()
+{
+    flushMasks();
+    
+    if (stats)
+        stats->drawCalls += (unsigned int) primitives.size();
+    
+    if (primitives.empty() || imageWidth == 0 || imageHeight == 0)
+        return;
+    
+    int threads = 1;
+    if (size_t(imageWidth) * imageHeight >= SOFTWARE_THREAD_PIXELS)
+    {
+        threads = numThreads;
+        if (threads <= 0)
+        {
+#if defined(_WIN32)
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            threads = int(info.dwNumberOfProcessors);
+#else
+            threads = int(sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+        }
+        threads = std::max(1, std::min(std::min(threads, SOFTWARE_MAX_THREADS), imageHeight));
+    }
+    
+    Band bands[SOFTWARE_MAX_THREADS];
+    for (int i = 0; i < threads; i++)
+    {
+        bands[i].renderer = this;
+        bands[i].rowBegin = imageHeight * i / threads;
+        bands[i].rowEnd = imageHeight * (i+1) / threads;
+    }
+    
+    // The calling thread draws the first band
+#if defined(_WIN32)
+    HANDLE handles[SOFTWARE_MAX_THREADS];
+    int started = 0;
+    for (int i = 1; i < threads; i++)
+    {
+        handles[started] = CreateThread(NULL, 0, rasterizeBand, &bands[i], 0, NULL);
+        if (handles[started])
+            started++;
+        else
+            rasterizeBand(&bands[i]);
+    }
+    rasterizeBand(&bands[0]);
+    WaitForMultipleObjects(started, handles, TRUE, INFINITE);
+    for (int i = 0; i < started; i++)
+        CloseHandle(handles[i]);
+#else
+    pthread_t handles[SOFTWARE_MAX_THREADS];
+    bool started[SOFTWARE_MAX_THREADS];
+    for (int i = 1; i < threads; i++)
+    {
+        started[i] = pthread_create(&handles[i], NULL, rasterizeBand, &bands[i]) == 0;
+        if (!started[i])
+            rasterizeBand(&bands[i]);
+    }
+    rasterizeBand(&bands[0]);
+    for (int i = 1; i < threads; i++)
+    {
+        if (started[i])
+            pthread_join(handles[i], NULL);
+    }
+#endif
+}
+
+void SoftwareRenderer::rasterize(int rowBegin, int rowEnd) const
+{
+    for (size_t i = 0; i < primitives.size(); i++)
+    {
+        const Primitive &p = primitives[i];
+        switch (p.type)
+        {
+            case Primitive::kRect:
+                fillRect(p, rowBegin, rowEnd);
+                break;
+            case Primitive::kLine:
+                fillLine(p, rowBegin, rowEnd);
+                break;
+            case Primitive::kGlyph:
+                fillGlyph(p, rowBegin, rowEnd);
+                break;
+        }
+    }
+}
+
+// The pixels whose centers are inside the rectangle
+//
+void SoftwareRenderer::fillRect(const Primitive &p, int rowBegin, int rowEnd) const
+{
+    int x0 = std::max(pixelAfter(p.v[0]), 0);
+    int x1 = std::min(pixelAfter(p.v[2]), imageWidth);
+    int y0 = std::max(pixelAfter(p.v[1]), rowBegin);
+    int y1 = std::min(pixelAfter(p.v[3]), rowEnd);
+    
+    if (x0 >= x1)
+        return;
+    
+    for (int y = y0; y < y1; y++)
+        blendSpan(pixel(x0, y), x1 - x0, p.color, 1.0f);
+}
+
+// The pixels whose centers are inside the line quad and, for dashed lines,
+// in the first half of a dash period, like the line shader.
+//
+void SoftwareRenderer::fillLine(const Primitive &p, int rowBegin, int rowEnd) const
+{
+    float x1 = p.v[0], y1 = p.v[1];
+    float dx = p.v[2] - x1;
+    float dy = p.v[3] - y1;
+    float hw = p.v[4];
+    float period = p.v[5];
+    
+    float length = sqrtf(dx*dx + dy*dy);
+    float ux = dx / length;
+    float uy = dy / length;
+    
+    float minX = std::min(x1, p.v[2]) - hw;
+    float maxX = std::max(x1, p.v[2]) + hw;
+    float minY = std::min(y1, p.v[3]) - hw;
+    float maxY = std::max(y1, p.v[3]) + hw;
+    
+    int px0 = std::max(pixelAfter(minX), 0);
+    int px1 = std::min(pixelAfter(maxX), imageWidth);
+    int py0 = std::max(pixelAfter(minY), rowBegin);
+    int py1 = std::min(pixelAfter(maxY), rowEnd);
+    
+    for (int y = py0; y < py1; y++)
+    {
+        float ry = y + 0.5f - y1;
+        
+        // Horizontal and vertical solid lines are spans
+        if (period <= 0.0f && (dx == 0.0f || dy == 0.0f))
+        {
+            blendSpan(pixel(px0, y), std::max(px1 - px0, 0), p.color, 1.0f);
+            continue;
+        }
+        
+        for (int x = px0; x < px1; x++)
+        {
+            float rx = x + 0.5f - x1;
+            float along = rx * ux + ry * uy;
+            float across = rx * uy - ry * ux;
+            
+            if (along < -hw || along >= length + hw || fabsf(across) >= hw)
+                continue;
+            if (period > 0.0f && along - period * floorf(along / period) >= 0.5f * period)
+                continue;
+            
+            blendSpan(pixel(x, y), 1, p.color, 1.0f);
+        }
+    }
+}
+
+// Bilinear filtered glyph from the alpha atlas. v0 is at the top of the
+// glyph, as in the OpenGL renderer.
+//
+void SoftwareRenderer::fillGlyph(const Primitive &p, int rowBegin, int rowEnd) const
+{
+    const unsigned char *alpha = atlas->pixels();
+    int aw = int(atlas->width());
+    int ah = int(atlas->height());
+    if (!alpha || aw <= 0 || ah <= 0)
+        return;
+    
+    float left = p.v[0], top = p.v[1], w = p.v[2], h = p.v[3];
+    if (w <= 0.0f || h <= 0.0f)
+        return;
+    
+    int px0 = std::max(pixelAfter(left), 0);
+    int px1 = std::min(pixelAfter(left + w), imageWidth);
+    int py0 = std::max(pixelAfter(top - h), rowBegin);
+    int py1 = std::min(pixelAfter(top), rowEnd);
+    
+    for (int y = py0; y < py1; y++)
+    {
+        float v = p.v[5] + (top - (y + 0.5f)) / h * (p.v[7] - p.v[5]);
+        float ty = v * ah - 0.5f;
+        int   t0 = int(floorf(ty));
+        float fy = ty - t0;
+        int   r0 = std::min(std::max(t0, 0), ah-1);
+        int   r1 = std::min(std::max(t0+1, 0), ah-1);
+        
+        for (int x = px0; x < px1; x++)
+        {
+            float u = p.v[4] + (x + 0.5f - left) / w * (p.v[6] - p.v[4]);
+            float tx = u * aw - 0.5f;
+            int   s0 = int(floorf(tx));
+            float fx = tx - s0;
+            int   c0 = std::min(std::max(s0, 0), aw-1);
+            int   c1 = std::min(std::max(s0+1, 0), aw-1);
+            
+            float a0 = alpha[r0*aw + c0] + (alpha[r0*aw + c1] - alpha[r0*aw + c0]) * fx;
+            float a1 = alpha[r1*aw + c0] + (alpha[r1*aw + c1] - alpha[r1*aw + c0]) * fx;
+            float coverage = (a0 + (a1 - a0) * fy) / 255.0f;
+            
+            if (coverage > 0.0f)
+                blendSpan(pixel(x, y), 1, p.color, coverage);
+        }
+    }
+}
+
+void SoftwareRenderer::addLine(double x1, double y1, double x2, double y2,
+                               MColor color, float dashPeriod)
+{
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    if (sqrt(dx*dx + dy*dy) < EPSILON)
+        return;
+    
+    float a = 1-color.a;
+    Primitive p;
+    p.type = Primitive::kLine;
+    p.v[0] = float(x1); p.v[1] = float(y1);
+    p.v[2] = float(x2); p.v[3] = float(y2);
+    p.v[4] = std::max(lineWidth, 1.0f) / 2.0f;
+    p.v[5] = dashPeriod;
+    p.v[6] = p.v[7] = 0.0f;
+    p.color[0] = color.r * a;
+    p.color[1] = color.g * a;
+    p.color[2] = color.b * a;
+    p.color[3] = a;
+    primitives.push_back(p);
+}
+
+// This draws a single line between the specified points.
+//
+void SoftwareRenderer::drawLine(double x1, double x2, double y1, double y2,
+                                MColor color, bool stipple)
+{
+    addLine( x1, y1, x2, y2, color, stipple ? WIDE_DASH_PERIOD : 0.0f );
+}
+
+// Given a Geom instance, this will draw a line connecting the points.
+// The argument side determines whether the sides will be drawn (the top
+// will always be drawn). The stipple argument specifies whether the line
+// should be solid or dashed/stippled.
+//
+void SoftwareRenderer::drawLines( Geom g, MColor color, bool sides, bool stipple)
+{
+    float period = stipple ? DASH_PERIOD : 0.0f;
+    
+    addLine( g.x1, g.y1, g.x2, g.y1, color, period );
+    addLine( g.x2, g.y2, g.x1, g.y2, color, period );
+    
+    if (sides)
+    {
+        addLine( g.x2, g.y1, g.x2, g.y2, color, period );
+        addLine( g.x1, g.y2, g.x1, g.y1, color, period );
+    }
+}
+
+// Glyph quads from the alpha atlas, placed like the OpenGL renderer does.
+//
+void SoftwareRenderer::drawText(const TextData *td, double tx, double ty)
+{
+    double fontScaleFactor;
+    if (!layoutText(atlas, td, tx, ty, placedGlyphs, fontScaleFactor))
+        return;
+    
+    float a = 1-td->textColor.a;
+    Primitive p;
+    p.type = Primitive::kGlyph;
+    p.color[0] = td->textColor.r * a;
+    p.color[1] = td->textColor.g * a;
+    p.color[2] = td->textColor.b * a;
+    p.color[3] = a;
+    
+    for (size_t i = 0; i < placedGlyphs.size(); i++) {
+        const FontFileGlyph *glyph = placedGlyphs[i].glyph;
+        
+        p.v[0] = float(placedGlyphs[i].x + glyph->offset_x * fontScaleFactor);
+        p.v[1] = float(placedGlyphs[i].y + glyph->offset_y * fontScaleFactor);
+        p.v[2] = float(glyph->width * fontScaleFactor);
+        p.v[3] = float(glyph->height * fontScaleFactor);
+        p.v[4] = glyph->u0;
+        p.v[5] = glyph->v0;
+        p.v[6] = glyph->u1;
+        p.v[7] = glyph->v1;
+        primitives.push_back(p);
+    }
+}
+
+// The mask quads drawn by GPURenderer::drawMask are axis aligned, so they
+// are recorded as rectangles.
+//
+void SoftwareRenderer::drawMaskBatch(const MaskBatch &batch)
+{
+    for (size_t i = 0; i + 3 < batch.size(); i += 4)
+    {
+        const MaskVertex *q = &batch[i];
+        
+        Primitive p;
+        p.type = Primitive::kRect;
+        p.v[0] = std::min(std::min(q[0].x, q[1].x), std::min(q[2].x, q[3].x));
+        p.v[1] = std::min(std::min(q[0].y, q[1].y), std::min(q[2].y, q[3].y));
+        p.v[2] = std::max(std::max(q[0].x, q[1].x), std::max(q[2].x, q[3].x));
+        p.v[3] = std::max(std::max(q[0].y, q[1].y), std::max(q[2].y, q[3].y));
+        p.color[0] = q[0].r * q[0].a;
+        p.color[1] = q[0].g * q[0].a;
+        p.color[2] = q[0].b * q[0].a;
+        p.color[3] = q[0].a;
+        primitives.push_back(p);
+    }
+}
+
+void SoftwareRenderer::toRGBA8(std::vector<unsigned char> &rgba) const
+{
+    rgba.resize(size_t(imageWidth) * imageHeight * 4);
+    
+    for (int y = 0; y < imageHeight; y++)
+    {
+        const float *src = &image[size_t(imageHeight - 1 - y) * imageWidth * 4];
+        unsigned char *dst = &rgba[size_t(y) * imageWidth * 4];
+        
+        for (int i = 0; i < imageWidth * 4; i++)
+        {
+            float c = std::min(std::max(src[i], 0.0f), 1.0f);
+            dst[i] = (unsigned char)(c * 255.0f + 0.5f);
+        }
+    }
+}
@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  SoftwareRenderer.h
+//  spReticle
+//
+
+#ifndef spReticle_SoftwareRenderer_h
+#define spReticle_SoftwareRenderer_h
+
+#include <vector>
+
+#include "defines.h"
+#include "FontAtlas.h"
+
+#include "GPURenderer.h"
+
+// Renders the reticle on the CPU, for machines without a GL context such as
+// render farm nodes burning the reticle into frames.
+//
+// The image has one premultiplied RGBA float pixel per viewport pixel, the
+// bottom row first like glReadPixels. Everything drawn between
+// prepareForDraw and postDraw is recorded and rasterized in postDraw, with
+// the rows of large images split across threads. Lines and text match the
+// OpenGL renderer: solid or dashed quads lineWidth pixels wide, and glyphs
+// bilinear filtered from the alpha atlas.
+class SoftwareRenderer : public GPURenderer
+{
+    public:
+        SoftwareRenderer();
+        virtual ~SoftwareRenderer();
+        
+        // Clears the image to transparent black at the port size
+        virtual void prepareForDraw(float portWidth, float portHeight);
+        virtual void postDraw();
+    
+        // This draws a single line between the specified points.
+        virtual void drawLine(double x1, double x2, double y1, double y2,
+                              MColor color, bool stipple);
+        
+        // Given a Geom instance, this will draw a line connecting the points.
+        // The argument side determines whether the sides will be drawn (the top
+        // will always be drawn). The stipple argument specifies whether the line
+        // should be solid or dashed/stippled.
+        virtual void drawLines( Geom g, MColor color, bool sides, bool stipple);
+        
+        // This function is responsible for rendering text.
+        virtual void drawText(const TextData *td, double tx, double ty);
+        
+        // Number of threads for large images, 0 for one per processor
+        void setNumThreads(int threads) { numThreads = threads; }
+        
+        int width() const { return imageWidth; }
+        int height() const { return imageHeight; }
+        
+        // The image rendered by the last postDraw
+        const float *pixels() const { return image.empty() ? NULL : &image[0]; }
+        
+        // Convert the image to premultiplied 8 bit RGBA, top row first
+        void toRGBA8(std::vector<unsigned char> &rgba) const;
+    
+    protected:
+        // Record the mask quads
+        virtual void drawMaskBatch(const MaskBatch &batch);
+    
+    private:
+        // A recorded shape, with its premultiplied color
+        class Primitive
+        {
+        public:
+            enum Type
+            {
+                kRect = 0,
+                kLine,
+                kGlyph
+            };
+            
+            Type  type;
+            
+            // kRect:  x0, y0, x1, y1
+            // kLine:  x1, y1, x2, y2, half width, dash period
+            // kGlyph: left, top, width, height, u0, v0, u1, v1
+            float v[8];
+            float color[4];
+        };
+        
+        void addLine(double x1, double y1, double x2, double y2,
+                     MColor color, float dashPeriod);
+        
+        // Rasterize every primitive, in order, into rows [rowBegin, rowEnd)
+        void rasterize(int rowBegin, int rowEnd) const;
+        
+        void fillRect(const Primitive &p, int rowBegin, int rowEnd) const;
+        void fillLine(const Primitive &p, int rowBegin, int rowEnd) const;
+        void fillGlyph(const Primitive &p, int rowBegin, int rowEnd) const;
+        
+        // The red component of a pixel
+        float *pixel(int x, int y) const { return const_cast<float *>(&image[(size_t(y) * imageWidth + x) * 4]); }
+        
+        struct Band;
+#if defined(_WIN32)
+        static unsigned long __stdcall rasterizeBand(void *band);
+#else
+        static void *rasterizeBand(void *band);
+#endif
+        
+        std::vector<Primitive>   primitives;
+        std::vector<float>       image;
+        int                      imageWidth;
+        int                      imageHeight;
+        int                      numThreads;
+        
+        std::vector<PlacedGlyph> placedGlyphs;
+        
+        // The shared font atlas, see FontRegistry
+        FontAtlas               *atlas;
+};
+
+#endif
@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  SubSceneRenderer.cpp
+//  spReticle
+//
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+#include "SubSceneRenderer.h"
+
+SubSceneRenderer::SubSceneRenderer() :
+    trianglesChanged(true), keepTriangles(false), viewWidth(0), viewHeight(0)
+{
+}
+
+SubSceneRenderer::~SubSceneRenderer()
+{
+}
+
+void SubSceneRenderer::prepareForDraw(float portWidth, float portHeight)
+{
+    GPURenderer::prepareForDraw(portWidth, portHeight);
+    
+    // Keep the previous triangles to tell whether the buffers need updating
+    previous.swap(vertices);
+    vertices.clear();
+    textItems.clear();
+    
+    viewWidth = portWidth;
+    viewHeight = portHeight;
+}
+
+bool SubSceneRenderer::redraw(float portWidth, float portHeight)
+{
+    GPURenderer::prepareForDraw(portWidth, portHeight);
+    
+    // The buffers already hold the triangles
+    trianglesChanged = false;
+    
+    return true;
+}
+
+bool SubSceneRenderer::redrawGeometry(float portWidth, float portHeight)
+{
+    GPURenderer::prepareForDraw(portWidth, portHeight);
+    
+    // The buffers already hold the triangles, only the text is recorded
+    textItems.clear();
+    keepTriangles = true;
+    
+    return true;
+}
+
+void SubSceneRenderer::postDraw()
+{
+    flushMasks();
+    
+    if (keepTriangles)
+    {
+        trianglesChanged = false;
+        keepTriangles = false;
+        return;
+    }
+    
+    trianglesChanged = vertices.size() != previous.size() ||
+        (!vertices.empty() && memcmp(&vertices[0], &previous[0], vertices.size() * sizeof(Vertex)) != 0);
+}
+
+// corners holds the x and y of the four corners, in order around the quad
+//
+void SubSceneRenderer::addQuad(const float *corners, const float *color)
+{
+    static const int order[6] = { 0, 1, 2, 0, 2, 3 };
+    
+    Vertex v;
+    v.r = color[0];
+    v.g = color[1];
+    v.b = color[2];
+    v.a = color[3];
+    
+    for (int i = 0; i < 6; i++) {
+        v.x = corners[order[i] * 2];
+        v.y = corners[order[i] * 2 + 1];
+        vertices.push_back(v);
+    }
+}
+
+void SubSceneRenderer::drawMaskBatch(const MaskBatch &batch)
+{
+    for (size_t i = 0; i + 3 < batch.size(); i += 4) {
+        const MaskVertex *q = &batch[i];
+        const float corners[8] = { q[0].x, q[0].y, q[1].x, q[1].y, q[2].x, q[2].y, q[3].x, q[3].y };
+        const float color[4] = { q[0].r, q[0].g, q[0].b, q[0].a };
+        addQuad(corners, color);
+    }
+}
+
+// Adds a line as a quad lineWidth pixels wide with the ends extended by half
+// the width, like OpenGLRenderer::addLine. A dashed line is cut into one quad
+// per dash, the first half of every period being drawn.
+//
+void SubSceneRenderer::addLine(double x1, double y1, double x2, double y2,
+                               const MColor &color, float dashPeriod)
+{
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double length = sqrt(dx*dx + dy*dy);
+    
+    if (length < EPSILON)
+        return;
+    
+    const float c[4] = { color.r, color.g, color.b, 1-color.a };
+    double hw = std::max(lineWidth, 1.0f) / 2.0;
+    double ux = dx / length;
+    double uy = dy / length;
+    
+    double start = -hw;
+    double end = length + hw;
+    double step = dashPeriod > 0.0f ? dashPeriod : end - start;
+    double dash = dashPeriod > 0.0f ? dashPeriod * 0.5 : end - start;
+    
+    // The pattern starts at the distance 0, as in the line shader
+    double d = dashPeriod > 0.0f ? floor(start / step) * step : start;
+    for (; d < end; d += step) {
+        double d1 = std::max(d, start);
+        double d2 = std::min(d + dash, end);
+        if (d2 <= d1)
+            continue;
+        
+        double ax = x1 + ux * d1, ay = y1 + uy * d1;
+        double bx = x1 + ux * d2, by = y1 + uy * d2;
+        const float corners[8] = {
+            float(ax + uy * hw), float(ay - ux * hw),
+            float(bx + uy * hw), float(by - ux * hw),
+            float(bx - uy * hw), float(by + ux * hw),
+            float(ax - uy * hw), float(ay + ux * hw) };
+        addQuad(corners, c);
+    }
+}
+
+// This draws a single line between the specified points.
+//
+void SubSceneRenderer::drawLine(double x1, double x2, double y1, double y2,
+                                MColor color, bool stipple)
+{
+    addLine( x1, y1, x2, y2, color, stipple ? WIDE_DASH_PERIOD : 0.0f );
+}
+
+// Given a Geom instance, this will draw a line connecting the points.
+// The argument side determines whether the sides will be drawn (the top
+// will always be drawn). The stipple argument specifies whether the line
+// should be solid or dashed/stippled.
+//
+void SubSceneRenderer::drawLines( Geom g, MColor color, bool sides, bool stipple)
+{
+    float period = stipple ? DASH_PERIOD : 0.0f;
+    
+    addLine( g.x1, g.y1, g.x2, g.y1, color, period );
+    addLine( g.x2, g.y2, g.x1, g.y2, color, period );
+    
+    if (sides)
+    {
+        addLine( g.x2, g.y1, g.x2, g.y2, color, period );
+        addLine( g.x1, g.y2, g.x1, g.y1, color, period );
+    }
+}
+
+// The text is placed like V2Renderer::drawText places it.
+//
+void SubSceneRenderer::drawText(const TextData *td, double tx, double ty)
+{
+    double screenScaleFactor = (td->textScale) ? filmback->filmbackGeom.x/1280.0f : 1.0f;
+    int fontSize = int(td->textSize * screenScaleFactor);
+
+    // Adjust ty for text alignment
+    switch (td->textVAlign) {
+        case 0:
+            ty -= (fontSize * 0.22f);
+            break;
+        case 1:
+            ty -= fontSize / 2.0f;
+            break;
+        case 2:
+            ty -= fontSize;
+            break;
+    }
+    
+    // Adjust text position to account for screen scaling
+    tx += td->textPosX*screenScaleFactor;
+    ty += td->textPosY*screenScaleFactor;
+    
+    TextItem item;
+    item.x = tx;
+    item.y = ty;
+    item.text = td->textStr;
+    item.align = td->textAlign;
+    item.fontSize = fontSize;
+    item.color = MColor(td->textColor.r,td->textColor.g,td->textColor.b,1-td->textColor.a);
+    textItems.push_back(item);
+}
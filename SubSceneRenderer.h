@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  SubSceneRenderer.h
+//  spReticle
+//
+
+#ifndef spReticle_SubSceneRenderer_h
+#define spReticle_SubSceneRenderer_h
+
+#include <vector>
+
+#include "defines.h"
+
+#include "GPURenderer.h"
+
+// Records the reticle as a single list of colored screen space triangles
+// for the Viewport 2.0 sub-scene override, which keeps them in persistent
+// vertex and index buffers: the masks first, then every line as a quad
+// lineWidth pixels wide, dashed lines being cut into one quad per dash.
+// The text is recorded separately and drawn with MUIDrawManager.
+class SubSceneRenderer : public GPURenderer
+{
+    public:
+        // A vertex of the triangles: position in pixels and color
+        class Vertex
+        {
+        public:
+            float x, y;
+            float r, g, b, a;
+        };
+        
+        // A text item, placed like the V2Renderer places it
+        class TextItem
+        {
+        public:
+            double  x, y;
+            MString text;
+            int     align;
+            int     fontSize;
+            MColor  color;
+        };
+        
+        SubSceneRenderer();
+        virtual ~SubSceneRenderer();
+        
+        virtual void prepareForDraw(float portWidth, float portHeight);
+        virtual void postDraw();
+    
+        // Keep the triangles and text of the last frame, unchanged
+        virtual bool redraw(float portWidth, float portHeight);
+    
+        // Keep the triangles of the last frame, the text is recorded again
+        virtual bool redrawGeometry(float portWidth, float portHeight);
+    
+        // This draws a single line between the specified points.
+        virtual void drawLine(double x1, double x2, double y1, double y2,
+                              MColor color, bool stipple);
+        
+        // Given a Geom instance, this will draw a line connecting the points.
+        // The argument side determines whether the sides will be drawn (the top
+        // will always be drawn). The stipple argument specifies whether the line
+        // should be solid or dashed/stippled.
+        virtual void drawLines( Geom g, MColor color, bool sides, bool stipple);
+        
+        // This function is responsible for rendering text.
+        virtual void drawText(const TextData *td, double tx, double ty);
+        
+        // The triangles of the last frame, three vertices each
+        const std::vector<Vertex> &triangles() const { return vertices; }
+        const std::vector<TextItem> &text() const { return textItems; }
+        
+        // Whether the triangles differ from the ones of the previous frame
+        bool changed() const { return trianglesChanged; }
+        
+        float width() const { return viewWidth; }
+        float height() const { return viewHeight; }
+    
+    protected:
+        // Add the mask quads as two triangles each
+        virtual void drawMaskBatch(const MaskBatch &batch);
+    
+    private:
+        void addQuad(const float *corners, const float *color);
+        void addLine(double x1, double y1, double x2, double y2,
+                     const MColor &color, float dashPeriod);
+        
+        std::vector<Vertex>   vertices;
+        std::vector<Vertex>   previous;
+        std::vector<TextItem> textItems;
+        bool                  trianglesChanged;
+        bool                  keepTriangles;
+        float                 viewWidth;
+        float                 viewHeight;
+};
+
+#endif
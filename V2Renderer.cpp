@@ -48,12 +48,20 @@
 #include <maya/MGlobal.h>
 #include <maya/MPoint.h>
 #include <maya/MPointArray.h>
+#include <maya/MColorArray.h>
 #include <maya/MUintArray.h>
 
 #include "V2Renderer.h"
 
-V2Renderer::V2Renderer()
+V2Renderer::V2Renderer() : drawManager(NULL), numTextItems(0)
 {
+    maskPoints.setSizeIncrement(64);
+    maskColors.setSizeIncrement(64);
+    for (int i = 0; i < kNumLineStyles; i++)
+    {
+        lines[i].points.setSizeIncrement(64);
+        lines[i].colors.setSizeIncrement(64);
+    }
 }
 
 V2Renderer::~V2Renderer()
@@ -67,81 +75,163 @@ void V2Renderer::setDrawManager(MHWRender::MUIDrawManager* drawManager)
 
 void V2Renderer::prepareForDraw(float portWidth, float portHeight)
 {
+    GPURenderer::prepareForDraw(portWidth, portHeight);
+    
+    maskPoints.setLength(0);
+    maskColors.setLength(0);
+    for (int i = 0; i < kNumLineStyles; i++)
+    {
+        lines[i].points.setLength(0);
+        lines[i].colors.setLength(0);
+    }
+    numTextItems = 0;
+    
     drawManager->beginDrawable();
+    drawManager->setLineWidth(lineWidth);
 }
 
+// The masks were drawn by flushMasks. All of the lines of a style go out in
+// a single kLines mesh, then the text items.
+//
 void V2Renderer::postDraw()
 {
+    flushMasks();
+    
+    for (int i = 0; i < kNumLineStyles; i++)
+    {
+        const LineBatch &batch = lines[i];
+        if (batch.points.length() == 0)
+            continue;
+        
+        if (i == kDashedLines)
+            drawManager->setLineStyle(2,0x00FF);
+        else
+            drawManager->setLineStyle(MHWRender::MUIDrawManager::kSolid);
+        
+        drawManager->mesh2d(MHWRender::MUIDrawManager::kLines, batch.points, &batch.colors);
+        if (stats)
+            stats->drawCalls++;
+    }
+    
+    // Only set the font size and color when they change
+    int fontSize = -1;
+    MColor color(-1.0f, -1.0f, -1.0f, -1.0f);
+    
+    for (size_t i = 0; i < numTextItems; i++)
+    {
+        const TextItem &item = textItems[i];
+        
+#if (MAYA_API_VERSION >= 201500)
+        if (i == 0)
+            drawManager->setFontName("Bitstream Charter");
+        if (item.fontSize != fontSize)
+            drawManager->setFontSize(item.fontSize);
+#endif
+        fontSize = item.fontSize;
+        
+        if (!(item.color == color))
+            drawManager->setColor(item.color);
+        color = item.color;
+        
+        drawManager->text2d(item.position, item.text, (MHWRender::MUIDrawManager::TextAlignment)item.align);
+        if (stats)
+            stats->drawCalls++;
+    }
+    
     drawManager->endDrawable();
 }
 
-// Given two Geom instances, this calculates the mask area between them.
+// The arrays still hold the last frame, draw them again like prepareForDraw,
+// flushMasks and postDraw would.
 //
-void V2Renderer::drawMask( Geom g1, Geom g2, MColor color, bool sides, bool top=true )
+bool V2Renderer::redraw(float portWidth, float portHeight)
 {
-	drawManager->setColor(MColor(color.r, color.g, color.b, 1 - color.a));
+    GPURenderer::prepareForDraw(portWidth, portHeight);
     
-	MUintArray index;
-	index.append(0);
-	index.append(1);
-	index.append(3);
-	index.append(2);
+    drawManager->beginDrawable();
+    drawManager->setLineWidth(lineWidth);
     
-    if (top)
-    {
-        if ( (g2.y1 - g1.y1) > EPSILON )
-        {
-            // Bottom Mask
-            MPointArray bottomMask;
-            bottomMask.append(MPoint( g1.x1, g1.y1, 0.0));
-            bottomMask.append(MPoint( g1.x2, g1.y1, 0.0));
-            bottomMask.append(MPoint( g2.x2, g2.y1, 0.0));
-            bottomMask.append(MPoint( g2.x1, g2.y1, 0.0));
-            drawManager->mesh2d(MHWRender::MUIDrawManager::kTriStrip,bottomMask,NULL,&index);
-        }
+    drawMasks();
+    postDraw();
+    
+    return true;
+}
 
+// Like redraw, but the text items are recorded again before postDraw adds
+// them with the lines.
+//
+bool V2Renderer::redrawGeometry(float portWidth, float portHeight)
+{
+    GPURenderer::prepareForDraw(portWidth, portHeight);
     
-        if ( (g1.y2 - g2.y2) > EPSILON )
-        {
-            // Top Mask
-            MPointArray topMask;
-            topMask.append(MPoint( g2.x1, g2.y2, 0.0));
-            topMask.append(MPoint( g2.x2, g2.y2, 0.0));
-            topMask.append(MPoint( g1.x2, g1.y2, 0.0));
-            topMask.append(MPoint( g1.x1, g1.y2, 0.0));
-            drawManager->mesh2d(MHWRender::MUIDrawManager::kTriStrip,topMask,NULL,&index);
-        }
-    }
-    else
+    numTextItems = 0;
+    
+    drawManager->beginDrawable();
+    drawManager->setLineWidth(lineWidth);
+    
+    drawMasks();
+    
+    return true;
+}
+
+// Draw the batched masks as a single triangle mesh with per-vertex colors.
+// The index list only changes with the number of quads.
+//
+void V2Renderer::drawMaskBatch(const MaskBatch &batch)
+{
+    unsigned int numVertices = (unsigned int)batch.size();
+    
+    maskPoints.setLength(numVertices);
+    maskColors.setLength(numVertices);
+    
+    for (unsigned int i = 0; i < numVertices; i++)
     {
-        g1.y1 = g2.y1;
-        g1.y2 = g2.y2;
+        const MaskVertex &v = batch[i];
+        maskPoints.set(i, v.x, v.y, 0.0);
+        maskColors.set(i, v.r, v.g, v.b, v.a);
     }
     
-	if (sides)
-	{
-		// Left side mask
-        if ((g2.x1 - g1.x1) > EPSILON)
-        {
-            MPointArray leftMask;
-            leftMask.append(MPoint( g1.x1, g1.y1, 0.0));
-            leftMask.append(MPoint( g2.x1, g2.y1, 0.0));
-            leftMask.append(MPoint( g2.x1, g2.y2, 0.0));
-            leftMask.append(MPoint( g1.x1, g1.y2, 0.0));
-            drawManager->mesh2d(MHWRender::MUIDrawManager::kTriStrip,leftMask,NULL,&index);
-        }
-        
-		// right side mask
-        if ((g1.x2 - g2.x2) > EPSILON)
+    // Two triangles per quad
+    unsigned int numIndices = numVertices / 4 * 6;
+    if (maskIndex.length() != numIndices)
+    {
+        maskIndex.setLength(numIndices);
+        for (unsigned int i = 0, j = 0; j < numIndices; i += 4, j += 6)
         {
-            MPointArray rightMask;
-            rightMask.append(MPoint( g1.x2, g1.y1, 0.0));
-            rightMask.append(MPoint( g2.x2, g2.y1, 0.0));
-            rightMask.append(MPoint( g2.x2, g2.y2, 0.0));
-            rightMask.append(MPoint( g1.x2, g1.y2, 0.0));
-            drawManager->mesh2d(MHWRender::MUIDrawManager::kTriStrip,rightMask,NULL,&index);
+            maskIndex[j]   = i;
+            maskIndex[j+1] = i+1;
+            maskIndex[j+2] = i+2;
+            maskIndex[j+3] = i;
+            maskIndex[j+4] = i+2;
+            maskIndex[j+5] = i+3;
         }
-	}
+    }
+    
+    drawMasks();
+}
+
+void V2Renderer::drawMasks()
+{
+    if (maskPoints.length() == 0)
+        return;
+    
+    drawManager->mesh2d(MHWRender::MUIDrawManager::kTriangles, maskPoints, &maskColors, &maskIndex);
+    if (stats)
+        stats->drawCalls++;
+}
+
+// Add a segment to the line batch of its style
+//
+void V2Renderer::addLine(double x1, double y1, double x2, double y2,
+                         const MColor &color, bool stipple)
+{
+    LineBatch &batch = lines[stipple ? kDashedLines : kSolidLines];
+    MColor c(color.r, color.g, color.b, 1-color.a);
+    
+    batch.points.append(MPoint(x1, y1));
+    batch.points.append(MPoint(x2, y2));
+    batch.colors.append(c);
+    batch.colors.append(c);
 }
 
 // This draws a single line between the specified points.
@@ -149,17 +239,7 @@ void V2Renderer::drawMask( Geom g1, Geom g2, MColor color, bool sides, bool top=
 void V2Renderer::drawLine(double x1, double x2, double y1, double y2,
                             MColor color, bool stipple)
 {
-	//drawManager->beginDrawable();
-    
-	drawManager->setColor(color);
-    
-	if(stipple) {
-		drawManager->setLineStyle(2,0x00FF);
-	}
-    
-	drawManager->line2d(MPoint(x1,y1),MPoint(x2,y2));
-    
-	//drawManager->endDrawable();
+    addLine(x1, y1, x2, y2, color, stipple);
 }
 
 // Given a Geom instance, this will draw a line connecting the points.
@@ -169,36 +249,25 @@ void V2Renderer::drawLine(double x1, double x2, double y1, double y2,
 //
 void V2Renderer::drawLines( Geom g, MColor color, bool sides, bool stipple)
 {
-	//drawManager->beginDrawable();
-    
-	drawManager->setColor(MColor(color.r,color.g,color.b,1-color.a));
+    addLine(g.x1, g.y1, g.x2, g.y1, color, stipple);
+    addLine(g.x2, g.y2, g.x1, g.y2, color, stipple);
     
-	if(stipple) {
-		drawManager->setLineStyle(2,0x00FF);
-	}
-    
-	if(sides) {
-		drawManager->rect2d(MPoint ((g.x1 + g.x2)/2, (g.y1 + g.y2)/2),
-                           MVector(0.0,1.0),
-                           fabs(g.x1-g.x2)/2,fabs(g.y1-g.y2)/2);
-	} else {
-		drawManager->line2d(MPoint(g.x1,g.y1),MPoint(g.x2,g.y1));
-		drawManager->line2d(MPoint(g.x2,g.y2),MPoint(g.x1,g.y2));
-	}
-    
-	//drawManager->endDrawable();
+    if (sides)
+    {
+        addLine(g.x2, g.y1, g.x2, g.y2, color, stipple);
+        addLine(g.x1, g.y2, g.x1, g.y1, color, stipple);
+    }
 }
 
-// This function uses MUIDrawManager to draw text.
+// This function uses MUIDrawManager to draw text. The text is drawn in
+// postDraw, after the lines.
 //
-void V2Renderer::drawText(TextData *td, double tx, double ty)
+void V2Renderer::drawText(const TextData *td, double tx, double ty)
 {
     double screenScaleFactor = (td->textScale) ? filmback->filmbackGeom.x/1280.0f : 1.0f;
 
 #if (MAYA_API_VERSION >= 201500)
     int fontSize = td->textSize * screenScaleFactor;
-    drawManager->setFontName("Bitstream Charter");
-	drawManager->setFontSize(fontSize);
 #else
     int fontSize = 14;
 #endif
@@ -220,13 +289,15 @@ void V2Renderer::drawText(TextData *td, double tx, double ty)
     tx += td->textPosX*screenScaleFactor;
     ty += td->textPosY*screenScaleFactor;
     
-	//drawManager->beginDrawable();
-	
-    //drawManager->setColor(td->textColor);
-	drawManager->setColor(MColor(td->textColor.r,td->textColor.g,td->textColor.b,1-td->textColor.a));
-	drawManager->text2d(MPoint(tx,ty),td->textStr,(MHWRender::MUIDrawManager::TextAlignment)td->textAlign);
+    if (numTextItems == textItems.size())
+        textItems.push_back(TextItem());
     
-	//drawManager->endDrawable();
+    TextItem &item = textItems[numTextItems++];
+    item.position = MPoint(tx, ty);
+    item.text = td->textStr;
+    item.align = td->textAlign;
+    item.fontSize = fontSize;
+    item.color = MColor(td->textColor.r,td->textColor.g,td->textColor.b,1-td->textColor.a);
 }
 
 #endif
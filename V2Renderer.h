@@ -45,7 +45,11 @@
 #if (MAYA_API_VERSION >= 201400)        
 
 #include <iostream>
+#include <vector>
 #include <maya/MViewport2Renderer.h>
+#include <maya/MPointArray.h>
+#include <maya/MColorArray.h>
+#include <maya/MUintArray.h>
 
 #include "defines.h"
 
@@ -64,9 +68,14 @@ class V2Renderer : public GPURenderer
         void prepareForDraw(float portWidth, float portHeight);
         void postDraw();
     
-        // Given two Geom instances, this renders the mask area between them.
-        virtual void drawMask( Geom g1, Geom g2, MColor color, bool sides, bool top );
-        
+        // Add the masks, lines and text of the last frame to the draw
+        // manager again
+        virtual bool redraw(float portWidth, float portHeight);
+    
+        // Add the masks and lines of the last frame again, the text is
+        // recorded again
+        virtual bool redrawGeometry(float portWidth, float portHeight);
+    
         // This draws a single line between the specified points.
         virtual void drawLine(double x1, double x2, double y1, double y2,
                               MColor color, bool stipple);
@@ -78,10 +87,55 @@ class V2Renderer : public GPURenderer
         virtual void drawLines( Geom g, MColor color, bool sides, bool stipple);
         
         // This function is responsible for rendering text.
-        virtual void drawText(TextData *td, double tx, double ty);
+        virtual void drawText(const TextData *td, double tx, double ty);
+    
+    protected:
+        // Draw the batched masks as a single triangle mesh
+        virtual void drawMaskBatch(const MaskBatch &batch);
     
     private:
+        // Line segments of one style, two points per segment
+        class LineBatch
+        {
+        public:
+            MPointArray points;
+            MColorArray colors;
+        };
+        
+        enum LineStyle
+        {
+            kSolidLines = 0,
+            kDashedLines,
+            kNumLineStyles
+        };
+        
+        // A text item, drawn after the lines like the OpenGL renderer does
+        class TextItem
+        {
+        public:
+            MPoint  position;
+            MString text;
+            int     align;
+            int     fontSize;
+            MColor  color;
+        };
+        
+        void addLine(double x1, double y1, double x2, double y2,
+                     const MColor &color, bool stipple);
+        
+        // Draw the mask arrays as a single triangle mesh
+        void drawMasks();
+        
         MHWRender::MUIDrawManager* drawManager;
+        
+        // Reused from frame to frame, so that the arrays are only
+        // reallocated when they grow
+        MPointArray maskPoints;
+        MColorArray maskColors;
+        MUintArray  maskIndex;
+        LineBatch   lines[kNumLineStyles];
+        std::vector<TextItem> textItems;
+        size_t      numTextItems;
 };
 
 #endif
@@ -62,17 +62,71 @@
 #define FRAME_START_ENV_VAR     "FS"
 #define FRAME_END_ENV_VAR       "FE"
 
+// Shot metadata index used by the "Shot Metadata" text type when the node's
+// shotMetadataFile attribute is empty. The file is built with spShotIndex.
+#define SHOT_METADATA_ENV_VAR   "SHOT_METADATA"
+
+// Minimum number of seconds between checks for a modified shot metadata index
+#define SHOT_METADATA_CHECK_INTERVAL 1
+
+// The "MEL Script" and "Python Script" text types run the script stored on the node, so they
+// are disabled unless this environment variable is set to 1 when the plugin is loaded. The
+// results of the last SCRIPT_TEXT_CACHE_FRAMES frames are kept per text item.
+#define SCRIPT_TEXT_ENV_VAR     "SPRETICLE_SCRIPT_TEXT"
+#define SCRIPT_TEXT_CACHE_FRAMES 32
+
 // Font Defines
 #define MINFONT                 4
 #define	MAXFONT                 120
 
+// Binary font atlas, written by spFontAtlas, to use instead of the fonts
+// compiled from font.h
+#define FONT_ATLAS_ENV_VAR      "SPRETICLE_FONT_ATLAS"
+
+// Signed distance field font atlas generated by spFontSDF from font.h. The
+// atlas is SDF_DOWNSAMPLE times smaller than the font.h atlas, and distances
+// up to SDF_SPREAD atlas texels are encoded.
+#define SDF_DOWNSAMPLE          4
+#define SDF_SPREAD              4
+
+// Dash periods in pixels of the dashed lines drawn by the renderers, matching the 0x00FF
+// line stipple pattern with a repeat factor of 1 and 2
+#define DASH_PERIOD             16.0f
+#define WIDE_DASH_PERIOD        32.0f
+
+// The software renderer splits the rows of images of at least
+// SOFTWARE_THREAD_PIXELS pixels across up to SOFTWARE_MAX_THREADS threads
+#define SOFTWARE_THREAD_PIXELS  (1024*1024)
+#define SOFTWARE_MAX_THREADS    16
+
+// GPU timer queries are read back GPU_TIMER_FRAMES frames after they were
+// issued, so that reading them never waits for the GPU
+#define GPU_TIMER_FRAMES        4
+
 // Field Guide
 #define FIELDGUIDE_NUM_LINES    11
 
-// Specifies whether the VP2.0 MUIDrawManager class should be used for rendering vs OpenGL.
-// Currently, it has proper draw-order integration with image planes and support for DX11.
-// Cons are that it is slower, fonts are aliased, and line rendering is sometimes occluded by masks.
-// This only impacts Viewport 2.0.  Viewport 1.0 will use the OpenGLRenderer regardless.
-#define USE_MUIDRAWMANAGER      false 
+// Viewport 2.0 renderer used when SPRETICLE_BACKEND is not set: "openGL", "drawManager"
+// (MUIDrawManager, Maya 2014+) or "auto" (Maya 2016+), see also SUBSCENE_BACKEND. MUIDrawManager
+// has proper draw-order integration with image planes and supports DX11, where it is always
+// used. Cons are that it is slower, fonts are aliased, and line rendering is sometimes occluded
+// by masks. This only impacts Viewport 2.0. Viewport 1.0 will use the OpenGLRenderer regardless.
+#define BACKEND_ENV_VAR         "SPRETICLE_BACKEND"
+#define DEFAULT_BACKEND         "openGL"
+
+// Number of Viewport 2.0 renders each renderer draws the reticles in full in before the auto
+// backend keeps the faster one, and the file the decisions are appended to
+#define AUTO_BACKEND_FRAMES     30
+#define BACKEND_LOG_ENV_VAR     "SPRETICLE_BACKEND_LOG"
+
+// Maximum number of cameras a node keeps Viewport 2.0 renderers for
+#define MAX_VIEW_STATES         8
+
+// SPRETICLE_BACKEND value drawing Viewport 2.0 through a sub-scene override instead of the draw
+// override. Requires Maya 2017, which added the MUIDrawManager text of sub-scene overrides; older
+// versions use the draw override. The masks and lines of each viewport are kept in persistent
+// vertex and index buffers that are only updated when the reticle changes, on both OpenGL core
+// profile and DX11. Only read when the plugin is loaded, the other backends can't be selected.
+#define SUBSCENE_BACKEND        "subScene"
 
 #endif
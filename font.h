@@ -0,0 +1,18 @@
+#pragma once
+#include <map>
+#include <wchar.h>
+#include <GL/gl.h>
+typedef struct { wchar_t charcode; float kerning; } kerning_t;
+typedef struct { wchar_t charcode; int width, height; int offset_x, offset_y; float advance_x, advance_y; float s0,t0,s1,t1; float u0,v0,u1,v1; size_t kerning_count; kerning_t kerning[20]; } TextureGlyph;
+typedef std::map<wchar_t,TextureGlyph*> GlyphMap;
+typedef struct { float size; int bold; size_t glyphs_count; TextureGlyph glyphs[300]; GlyphMap glyphMap; } TextureFont;
+typedef struct { size_t width, height, depth; GLuint id; unsigned char data[16]; } TextureAtlas;
+
+
+#define NUM_FONTS 4
+TextureAtlas fontAtlas = { 4, 4, 1, 0, {0} };
+TextureFont font0 = { 16, 0, 196, { {32,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{66,0.4f},{210,-1.7f},{8221,-1.9f},{48,0.5f},{97,-0.7f},{62,0.3f},{191,-2.0f},{8220,-0.7f},{180,0.2f},{185,-1.3f},{231,0.8f},{162,0.7f}}},{33,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{39,-1.3f},{37,-0.7f},{38,-0.5f},{231,-1.3f},{203,-1.3f},{34,-1.3f},{162,-0.6f},{240,-1.1f},{87,-1.9f},{173,0.5f},{250,-0.3f},{200,-0.1f}}},{34,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{79,0.5f},{226,0.0f},{250,-1.1f},{107,-0.2f},{62,0.6f},{255,0.5f},{117,-0.5f},{249,-0.2f},{247,-1.9f},{193,-1.3f},{173,0.4f},{194,-0.8f}}},{35,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{76,0.3f},{125,-0.4f},{205,-0.8f},{244,-0.5f},{237,-1.9f},{253,-1.9f},{160,0.1f},{54,0.9f},{177,-0.2f},{234,-0.8f},{195,-1.5f},{59,-0.5f}}},{36,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{35,-0.0f},{83,-0.2f},{203,0.2f},{205,-0.8f},{91,0.6f},{168,0.9f},{196,0.8f},{120,-0.5f},{212,-1.6f},{122,0.3f},{182,-1.4f},{100,0.8f}}},{37,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{188,-0.4f},{125,-0.1f},{210,-0.2f},{206,-0.6f},{83,-1.9f},{194,-1.3f},{170,-1.5f},{189,-0.2f},{123,0.6f},{171,0.4f},{120,0.4f},{32,0.4f}}},{38,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{97,-1.7f},{40,-0.1f},{237,-1.0f},{50,-1.8f},{53,-1.5f},{36,-0.4f},{180,-1.5f},{35,-1.2f},{8217,0.1f},{103,-0.6f},{95,-1.0f},{100,-0.6f}}},{39,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{38,0.9f},{111,-0.7f},{163,0.9f},{119,-1.3f},{172,-0.8f},{80,-1.9f},{98,0.9f},{59,-0.7f},{96,-0.5f},{251,-0.7f},{195,0.5f},{85,0.9f}}},{40,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{226,-0.0f},{242,-0.7f},{197,0.2f},{180,-1.6f},{89,-1.4f},{199,-1.9f},{231,-1.8f},{39,-1.8f},{166,0.8f},{237,-1.1f},{212,-1.5f},{114,-0.3f}}},{41,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{65,-1.9f},{34,-1.4f},{208,-1.7f},{41,-0.3f},{216,0.7f},{87,-0.2f},{210,-0.5f},{182,0.8f},{75,-0.8f},{245,-0.5f},{224,-1.9f},{195,-0.2f}}},{42,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{167,0.0f},{104,0.5f},{36,0.8f},{72,-1.0f},{83,0.6f},{115,0.1f},{209,-0.5f},{66,1.0f},{118,-1.3f},{174,0.2f},{86,-1.7f},{100,-1.5f}}},{43,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{202,-1.1f},{86,0.6f},{100,-0.2f},{8220,0.9f},{117,0.7f},{218,-1.6f},{194,-0.3f},{97,-1.7f},{126,-1.9f},{118,-1.8f},{119,0.6f},{61,0.4f}}},{44,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{64,0.9f},{119,-0.9f},{61,-1.1f},{222,-0.4f},{215,-1.7f},{161,0.7f},{51,-1.7f},{211,-1.9f},{205,-1.1f},{89,-0.2f},{209,-2.0f},{52,-0.8f}}},{45,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{42,0.5f},{80,-0.7f},{93,0.9f},{215,0.4f},{172,-0.4f},{73,0.5f},{61,-0.3f},{180,0.1f},{74,-1.1f},{239,-1.4f},{72,-1.0f},{255,-1.9f}}},{46,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{107,-1.2f},{250,0.4f},{217,0.3f},{113,0.7f},{180,0.6f},{165,-0.6f},{112,-0.9f},{167,-1.5f},{48,-1.4f},{218,-1.4f},{181,-0.9f},{60,0.5f}}},{47,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{54,-1.0f},{8212,-1.0f},{179,0.5f},{55,0.7f},{231,-1.1f},{212,-1.0f},{229,-0.4f},{118,-0.3f},{90,-0.2f},{164,-1.3f},{110,-1.9f},{42,-1.3f}}},{48,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{50,-0.6f},{100,0.6f},{206,-1.7f},{251,0.3f},{51,-1.0f},{37,-0.5f},{227,-0.0f},{34,-1.5f},{106,-1.6f},{8212,-1.6f},{123,0.6f},{191,-1.1f}}},{49,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{246,0.4f},{196,0.7f},{219,0.5f},{107,0.2f},{64,0.1f},{84,-1.5f},{68,-0.7f},{204,-1.5f},{249,0.1f},{40,0.0f},{112,-1.2f},{224,-1.8f}}},{50,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{179,-1.2f},{175,-1.9f},{205,-0.1f},{96,-0.7f},{203,-0.3f},{177,-1.8f},{202,-0.9f},{181,-1.6f},{34,-1.6f},{166,-1.2f},{118,0.5f},{75,-0.8f}}},{51,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{167,0.8f},{76,0.8f},{221,-0.1f},{54,-1.3f},{91,-1.1f},{189,0.1f},{33,0.9f},{77,0.1f},{200,-1.0f},{113,-0.2f},{193,0.2f},{231,-0.0f}}},{52,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{230,-1.1f},{88,-0.3f},{44,-1.5f},{50,0.1f},{8221,-0.6f},{195,-1.7f},{126,-1.6f},{72,-0.2f},{84,-0.5f},{111,-0.9f},{108,-1.5f},{242,-0.7f}}},{53,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{210,0.5f},{249,-0.4f},{8217,1.0f},{45,-0.4f},{191,-1.7f},{239,-1.2f},{165,-1.7f},{248,0.2f},{228,-1.7f},{121,0.9f},{163,0.9f},{196,-0.1f}}},{54,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{233,-1.6f},{240,0.7f},{244,0.9f},{52,-1.6f},{178,-0.2f},{93,-0.8f},{162,-1.6f},{175,-1.1f},{166,-1.3f},{74,0.2f},{115,-2.0f},{177,-1.4f}}},{55,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{177,-0.4f},{213,-1.2f},{37,-0.2f},{39,-1.2f},{225,0.1f},{220,0.4f},{94,0.4f},{98,0.9f},{84,-0.4f},{76,-0.5f},{104,0.6f},{69,0.3f}}},{56,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{211,0.9f},{163,0.3f},{84,0.9f},{104,-1.6f},{59,-0.5f},{38,-0.3f},{62,-1.1f},{210,-0.5f},{8364,-0.9f},{35,-0.4f},{204,-2.0f},{107,-0.7f}}},{57,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{180,0.8f},{121,-0.9f},{110,-0.3f},{203,1.0f},{167,-0.1f},{118,0.2f},{252,0.2f},{239,0.2f},{211,-1.4f},{191,0.8f},{60,-0.2f},{230,-0.4f}}},{58,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{255,-2.0f},{247,-0.8f},{110,-0.7f},{244,-0.8f},{75,0.6f},{180,-0.2f},{223,0.2f},{236,0.7f},{200,0.2f},{82,-0.5f},{124,0.2f},{199,-0.1f}}},{59,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{231,0.4f},{106,-0.2f},{226,-1.0f},{37,-1.2f},{169,0.1f},{249,0.6f},{71,-0.4f},{227,-1.5f},{166,0.5f},{101,-0.5f},{77,-0.6f},{50,-1.9f}}},{60,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{195,0.1f},{57,-1.5f},{255,-1.7f},{216,-0.1f},{173,-1.2f},{49,-1.1f},{122,-0.4f},{233,-1.3f},{178,-1.0f},{37,-1.8f},{74,0.1f},{194,0.7f}}},{61,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{233,-0.9f},{126,0.2f},{184,-0.8f},{195,-0.8f},{207,-0.5f},{253,-1.2f},{44,-0.2f},{75,0.1f},{108,-1.2f},{232,-0.2f},{247,-1.3f},{101,-0.0f}}},{62,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{224,0.6f},{168,-0.3f},{113,-0.3f},{175,0.8f},{8220,-1.6f},{95,0.8f},{100,-0.6f},{80,-1.5f},{50,0.3f},{225,0.7f},{252,-0.7f},{74,-1.1f}}},{63,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{167,-0.5f},{93,-1.7f},{61,-1.4f},{248,-1.8f},{84,-0.2f},{239,0.7f},{110,-1.4f},{49,-1.9f},{59,0.1f},{90,0.4f},{166,0.9f},{114,-0.2f}}},{64,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{119,-0.7f},{234,0.3f},{102,0.9f},{62,-1.3f},{221,-1.1f},{242,-0.4f},{76,-0.8f},{56,-0.6f},{88,-1.2f},{167,-0.5f},{91,-1.7f},{191,-1.4f}}},{65,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{52,0.6f},{43,0.3f},{35,-1.5f},{33,0.7f},{187,-2.0f},{113,-1.6f},{163,-0.0f},{213,-1.8f},{105,-0.9f},{82,-1.6f},{167,-0.6f},{72,0.5f}}},{66,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{35,-1.9f},{41,-0.1f},{202,0.2f},{47,0.1f},{199,0.5f},{65,-0.0f},{42,-0.8f},{102,-0.1f},{62,0.9f},{175,-0.1f},{55,-1.3f},{80,-1.8f}}},{67,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{216,-0.8f},{76,-1.4f},{121,0.6f},{174,-0.7f},{219,-0.0f},{243,0.1f},{208,0.2f},{228,0.2f},{198,0.3f},{47,-1.2f},{122,0.9f},{205,-1.5f}}},{68,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{84,-1.9f},{174,-0.4f},{43,-0.7f},{45,-1.6f},{228,-0.8f},{55,0.1f},{196,0.6f},{185,-1.9f},{193,-0.4f},{126,-1.7f},{57,0.4f},{112,-1.7f}}},{69,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{40,-1.7f},{163,0.5f},{46,-0.5f},{252,-1.4f},{98,0.8f},{112,-0.5f},{253,-0.8f},{65,0.7f},{162,-0.6f},{61,-1.6f},{238,0.4f},{109,-0.4f}}},{70,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{208,-0.8f},{249,-1.0f},{213,-0.8f},{244,-1.6f},{198,-1.8f},{202,-1.1f},{39,0.4f},{106,-0.4f},{255,-0.7f},{72,-1.0f},{83,-1.2f},{126,0.2f}}},{71,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{198,0.9f},{193,-0.6f},{34,0.7f},{199,0.8f},{63,0.9f},{70,0.4f},{113,0.8f},{251,0.8f},{115,0.4f},{211,-1.6f},{49,-0.4f},{180,-0.3f}}},{72,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{96,-0.2f},{94,-1.0f},{244,-0.5f},{211,-1.9f},{8364,-1.2f},{118,-1.3f},{124,-1.6f},{229,-1.7f},{126,0.3f},{168,0.8f},{110,-0.1f},{183,0.4f}}},{73,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{204,-1.8f},{239,-1.8f},{100,0.6f},{247,-0.1f},{59,-1.5f},{84,0.6f},{98,-1.9f},{49,-0.9f},{226,0.5f},{211,0.1f},{199,-1.1f},{229,0.7f}}},{74,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{218,0.4f},{191,1.0f},{92,-1.2f},{173,-1.4f},{180,0.2f},{237,0.3f},{125,-0.5f},{204,-0.5f},{80,-0.8f},{188,0.6f},{250,0.4f},{50,-0.2f}}},{75,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{42,-0.5f},{122,1.0f},{182,-1.1f},{33,0.3f},{80,-0.1f},{108,1.0f},{243,-1.2f},{241,-0.8f},{229,0.8f},{203,0.8f},{62,-0.4f},{109,-0.2f}}},{76,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{213,-0.1f},{110,1.0f},{180,0.2f},{109,-0.3f},{65,-0.9f},{194,-0.8f},{178,0.8f},{215,0.7f},{67,0.0f},{205,0.7f},{73,0.8f},{96,0.5f}}},{77,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{163,-0.5f},{100,-1.6f},{183,-1.6f},{101,1.0f},{160,0.4f},{227,-0.9f},{8364,-1.6f},{188,0.4f},{118,0.8f},{164,-0.8f},{181,0.8f},{61,-1.1f}}},{78,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{172,-1.8f},{241,-1.4f},{102,-1.6f},{175,0.2f},{117,-1.7f},{189,-1.5f},{87,0.3f},{248,-1.7f},{190,-0.1f},{167,-1.4f},{173,-2.0f},{55,-0.7f}}},{79,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{45,-0.7f},{205,0.0f},{87,-1.6f},{201,-1.2f},{173,-1.2f},{120,-0.6f},{44,0.4f},{231,0.6f},{58,0.4f},{253,0.0f},{206,-1.7f},{238,-0.8f}}},{80,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{236,-0.8f},{179,0.7f},{107,-1.4f},{239,-0.4f},{195,-0.8f},{192,0.7f},{165,1.0f},{61,-1.1f},{220,-0.5f},{187,0.7f},{59,-0.4f},{70,-1.4f}}},{81,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8220,-1.8f},{224,-0.1f},{118,-1.1f},{189,0.7f},{58,-1.7f},{34,-0.5f},{8217,-1.2f},{251,-1.3f},{233,-1.6f},{120,-1.2f},{246,-0.8f},{100,-0.1f}}},{82,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{46,-0.5f},{201,-0.5f},{220,-0.2f},{195,-1.3f},{70,-1.5f},{170,0.3f},{101,0.2f},{103,-0.3f},{187,-0.6f},{243,-1.6f},{110,-0.5f},{100,-0.4f}}},{83,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{66,0.1f},{230,-1.3f},{8220,-0.1f},{86,0.5f},{112,-1.8f},{224,-1.5f},{191,-1.7f},{187,-0.3f},{116,-0.5f},{62,-0.0f},{64,-1.1f},{67,-1.0f}}},{84,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{37,-0.2f},{110,-0.4f},{222,-1.9f},{88,-1.0f},{53,-1.6f},{255,-1.2f},{89,0.3f},{103,0.0f},{239,-1.9f},{225,-1.8f},{119,0.2f},{100,-1.7f}}},{85,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{113,-0.1f},{95,-1.3f},{100,0.0f},{200,-1.2f},{44,-0.5f},{124,-1.0f},{39,0.8f},{52,-0.9f},{67,0.4f},{167,-0.1f},{160,0.5f},{249,-0.2f}}},{86,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{101,0.8f},{168,-1.1f},{55,-1.3f},{238,-1.1f},{212,-1.6f},{223,-0.2f},{250,-1.7f},{200,-1.3f},{186,0.7f},{209,-1.2f},{172,-1.9f},{202,-0.4f}}},{87,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{200,-0.9f},{99,-0.3f},{186,0.4f},{64,-0.5f},{168,-0.3f},{246,-0.1f},{58,-0.7f},{255,-1.6f},{160,-1.8f},{49,-0.3f},{232,0.0f},{204,0.5f}}},{88,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{188,-1.2f},{117,0.0f},{125,0.4f},{106,-0.2f},{72,-2.0f},{71,0.9f},{162,0.8f},{177,-0.1f},{168,-0.9f},{62,-0.3f},{218,0.6f},{69,-0.6f}}},{89,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{175,-0.6f},{218,-1.9f},{238,0.1f},{173,-2.0f},{102,-1.9f},{126,-1.7f},{169,-1.6f},{168,-0.5f},{220,-0.9f},{183,-1.2f},{45,1.0f},{57,0.7f}}},{90,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{232,0.7f},{123,-1.1f},{186,0.6f},{243,-1.0f},{94,-0.0f},{224,1.0f},{93,0.3f},{59,-1.8f},{208,-0.7f},{72,-0.9f},{61,-1.1f},{42,0.4f}}},{91,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{177,-1.5f},{244,-0.1f},{92,-0.5f},{227,-1.0f},{221,0.1f},{197,0.9f},{68,-1.9f},{46,0.7f},{119,-0.9f},{237,0.5f},{61,-1.5f},{196,0.1f}}},{92,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{57,-0.0f},{95,-0.0f},{117,0.8f},{116,-0.7f},{233,-0.8f},{94,-1.6f},{238,-0.5f},{183,-1.2f},{255,-1.6f},{185,-2.0f},{126,-0.8f},{191,0.4f}}},{93,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{232,-1.9f},{51,-0.8f},{78,-0.1f},{182,0.2f},{161,0.7f},{235,-0.4f},{193,-0.8f},{105,-2.0f},{71,0.4f},{199,0.9f},{59,0.7f},{97,-0.0f}}},{94,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{119,-1.3f},{234,-1.3f},{93,-1.9f},{51,-0.5f},{202,-1.4f},{207,-0.5f},{73,-0.2f},{76,1.0f},{161,-1.8f},{214,-0.8f},{37,-0.6f},{196,-0.3f}}},{95,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{44,0.9f},{164,-1.1f},{54,-1.2f},{208,-0.8f},{56,-0.2f},{229,1.0f},{187,0.1f},{43,-1.0f},{197,-0.4f},{93,-0.7f},{35,-0.5f},{37,-0.7f}}},{96,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{74,0.3f},{243,-0.1f},{166,0.2f},{164,-1.0f},{83,-1.6f},{191,-1.2f},{103,-1.0f},{124,-1.2f},{70,-0.6f},{98,-1.6f},{210,-1.6f},{76,-1.2f}}},{97,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{82,-0.6f},{50,0.1f},{213,-1.8f},{202,0.8f},{223,-1.5f},{204,0.0f},{174,-1.9f},{248,-0.8f},{93,-0.7f},{212,-1.6f},{67,-0.2f},{206,0.0f}}},{98,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{204,0.5f},{50,-1.3f},{93,0.1f},{162,-1.0f},{67,-0.4f},{105,-1.7f},{83,0.5f},{234,-1.4f},{249,-0.6f},{166,-1.1f},{123,0.4f},{8364,-0.2f}}},{99,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{222,0.5f},{160,-1.7f},{8217,-0.7f},{178,-0.2f},{97,0.2f},{223,-0.5f},{46,-0.8f},{45,0.7f},{112,1.0f},{72,-1.4f},{65,0.8f},{226,-0.0f}}},{100,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{197,-0.0f},{66,-0.4f},{248,-1.3f},{213,-1.9f},{97,-1.5f},{250,0.0f},{32,-0.3f},{62,-1.3f},{83,-0.8f},{8221,-1.2f},{209,-0.0f},{161,-0.8f}}},{101,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{191,-0.8f},{57,0.2f},{236,0.5f},{65,-1.0f},{79,-1.3f},{208,-1.8f},{36,0.2f},{181,0.5f},{8212,0.5f},{43,-1.4f},{190,-1.5f},{86,-0.5f}}},{102,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{195,-0.6f},{163,0.5f},{198,-1.5f},{124,-1.6f},{82,0.7f},{91,-1.1f},{233,-1.9f},{215,-0.5f},{8217,1.0f},{48,0.5f},{119,-0.8f},{45,1.0f}}},{103,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{196,-0.7f},{211,-0.2f},{230,-1.0f},{109,-1.6f},{165,-0.2f},{100,0.6f},{122,-1.2f},{185,0.6f},{44,0.4f},{206,0.3f},{187,-0.8f},{36,1.0f}}},{104,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{38,0.3f},{212,-1.9f},{213,-0.9f},{61,-1.8f},{41,0.7f},{211,-1.7f},{200,-0.4f},{35,-1.0f},{57,0.8f},{117,-0.4f},{118,0.8f},{126,0.7f}}},{105,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{124,-0.2f},{86,-1.9f},{69,-1.8f},{213,-0.1f},{215,0.5f},{59,-1.2f},{168,0.9f},{113,-0.3f},{195,-0.3f},{172,-0.1f},{119,-1.8f},{98,-1.5f}}},{106,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{100,-1.2f},{170,-0.6f},{53,0.2f},{64,-1.1f},{104,0.6f},{206,0.9f},{250,0.5f},{229,-1.8f},{99,-1.1f},{92,0.8f},{85,0.6f},{57,-1.6f}}},{107,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,0.1f},{125,-0.1f},{8364,-0.4f},{41,-1.4f},{39,0.7f},{112,-1.3f},{171,-0.2f},{73,0.9f},{207,-0.5f},{42,0.2f},{245,-0.6f},{215,0.3f}}},{108,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{124,-1.5f},{181,0.7f},{117,-1.9f},{222,-1.3f},{250,0.7f},{122,-0.4f},{88,-1.5f},{227,0.8f},{34,-1.4f},{35,-0.7f},{190,-1.3f},{40,-0.5f}}},{109,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{115,-0.7f},{165,-0.6f},{232,-1.9f},{50,-1.9f},{81,-1.7f},{217,-0.1f},{78,-0.0f},{80,0.9f},{240,-0.7f},{224,0.1f},{108,-1.0f},{213,-1.8f}}},{110,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{172,0.0f},{81,-0.3f},{244,0.6f},{196,-0.6f},{191,-0.6f},{220,0.5f},{209,0.0f},{234,-0.4f},{205,-0.3f},{193,0.4f},{187,-0.2f},{218,-1.2f}}},{111,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{111,-0.6f},{35,-1.0f},{219,1.0f},{8217,-1.6f},{43,0.6f},{182,-1.8f},{123,-1.7f},{91,0.6f},{195,0.7f},{178,-1.2f},{85,-0.4f},{244,-1.8f}}},{112,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{161,0.0f},{35,0.5f},{115,-1.8f},{118,0.3f},{111,-1.1f},{215,-0.8f},{44,-1.0f},{85,-1.9f},{248,-0.1f},{52,0.1f},{116,0.3f},{62,0.3f}}},{113,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8364,-0.8f},{211,-1.3f},{229,-1.9f},{125,-1.3f},{109,-1.3f},{107,0.1f},{161,-0.9f},{172,-0.1f},{199,0.2f},{183,-1.1f},{50,0.2f},{82,-0.9f}}},{114,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{247,-0.3f},{245,0.6f},{240,-0.5f},{110,-1.0f},{178,-0.2f},{192,-0.2f},{75,-1.1f},{237,-0.4f},{69,-1.2f},{39,-2.0f},{126,-1.1f},{176,-1.7f}}},{115,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{190,-1.7f},{61,-0.5f},{193,-0.5f},{88,-1.6f},{220,0.8f},{8364,0.9f},{229,-1.8f},{99,-2.0f},{176,-1.8f},{160,0.2f},{91,0.6f},{45,-1.8f}}},{116,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{34,-1.1f},{40,-0.3f},{202,-1.2f},{118,-1.3f},{117,-1.4f},{36,0.7f},{221,-1.3f},{208,-0.3f},{86,-0.6f},{185,-1.0f},{83,-0.8f},{100,-2.0f}}},{117,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{79,0.6f},{194,-1.6f},{228,0.5f},{55,-1.5f},{8220,-1.9f},{87,-1.1f},{89,-1.0f},{77,-0.2f},{109,-0.7f},{57,0.4f},{47,-0.0f},{112,-1.6f}}},{118,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{83,-0.7f},{45,-1.3f},{8364,-1.9f},{251,-1.2f},{61,-1.4f},{54,-1.0f},{255,-0.6f},{88,0.6f},{105,-0.0f},{247,-0.2f},{96,0.6f},{199,-0.8f}}},{119,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{174,-0.4f},{94,0.8f},{190,0.8f},{119,0.3f},{77,-0.9f},{219,-0.6f},{231,-0.9f},{61,-0.8f},{93,-0.6f},{50,-1.9f},{176,-1.6f},{102,-1.5f}}},{120,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{210,-1.8f},{64,-0.2f},{205,-1.3f},{247,-0.1f},{251,-1.5f},{70,0.6f},{74,-1.1f},{182,-0.7f},{230,-0.4f},{225,0.7f},{66,0.7f},{73,0.5f}}},{121,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{240,0.2f},{112,-0.9f},{49,0.8f},{79,-0.9f},{187,0.6f},{201,-0.5f},{40,0.4f},{43,-0.9f},{250,-0.0f},{81,-1.4f},{231,-0.9f},{123,0.9f}}},{122,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{222,-1.3f},{247,-1.1f},{85,-0.3f},{47,-1.4f},{95,0.9f},{109,-1.3f},{115,-0.5f},{209,-1.2f},{168,-1.5f},{94,-1.8f},{124,-0.3f},{44,-0.5f}}},{123,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{203,-1.4f},{218,0.3f},{175,-1.6f},{177,-1.4f},{213,-1.5f},{196,-0.9f},{186,-1.9f},{78,-0.9f},{123,-0.2f},{82,0.0f},{50,0.6f},{102,-1.7f}}},{124,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{229,-1.1f},{232,-0.6f},{82,-1.9f},{219,-1.8f},{119,-0.9f},{74,-0.3f},{212,-1.6f},{241,-1.8f},{236,-1.0f},{245,0.2f},{36,-0.3f},{87,1.0f}}},{125,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{219,0.6f},{113,-1.9f},{211,-1.5f},{54,-1.0f},{188,-1.1f},{118,0.5f},{171,-1.2f},{50,-1.1f},{99,-0.5f},{48,0.9f},{233,-1.1f},{230,-0.1f}}},{126,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{44,-1.2f},{61,-1.2f},{175,-1.5f},{221,-1.6f},{87,-1.7f},{103,-0.9f},{123,0.2f},{232,0.1f},{249,-1.4f},{209,0.9f},{191,-1.5f},{212,-0.6f}}},{160,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{243,-0.3f},{94,0.1f},{41,0.8f},{251,0.4f},{228,-0.3f},{95,-0.5f},{52,-2.0f},{254,-0.3f},{50,-0.3f},{197,0.2f},{194,-1.5f},{185,-0.2f}}},{161,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{45,-0.7f},{250,0.6f},{126,-1.4f},{122,-1.6f},{177,0.8f},{92,-1.9f},{241,-0.9f},{230,-1.0f},{234,0.4f},{204,-0.3f},{109,-0.6f},{54,-0.3f}}},{162,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{221,-1.6f},{47,-1.5f},{178,-1.6f},{232,0.4f},{73,0.2f},{195,-0.4f},{85,-1.3f},{167,0.1f},{184,-0.6f},{63,-0.5f},{112,-1.1f},{99,-0.4f}}},{163,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{194,-0.9f},{111,-0.0f},{216,0.2f},{84,-0.1f},{104,-0.7f},{237,0.4f},{71,-0.7f},{239,0.5f},{33,-1.8f},{119,0.2f},{62,-1.7f},{173,-0.8f}}},{164,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,-0.8f},{166,0.7f},{78,0.3f},{186,-1.5f},{179,-0.2f},{198,-1.5f},{216,0.3f},{41,-0.3f},{215,0.4f},{81,-1.8f},{180,0.8f},{190,-1.3f}}},{165,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{113,-0.5f},{178,-1.5f},{117,-0.4f},{255,-0.7f},{58,0.7f},{164,0.2f},{45,-0.6f},{8364,-1.6f},{184,-1.6f},{103,0.9f},{169,-0.2f},{116,-1.3f}}},{166,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{87,0.8f},{181,-0.8f},{231,-0.8f},{71,0.2f},{58,-1.1f},{243,0.1f},{173,-0.1f},{45,-0.8f},{70,0.5f},{160,-1.1f},{208,-1.7f},{114,-1.5f}}},{167,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{71,0.2f},{182,-1.0f},{59,-0.2f},{202,-0.6f},{63,-0.5f},{113,-0.8f},{112,-0.4f},{191,-1.3f},{238,-1.3f},{208,-1.4f},{227,-0.2f},{119,-1.3f}}},{168,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{114,0.6f},{223,-1.4f},{8220,0.7f},{47,1.0f},{116,0.7f},{172,-1.1f},{39,1.0f},{120,-0.8f},{124,0.3f},{218,-2.0f},{217,-0.0f},{234,0.9f}}},{169,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{121,-1.7f},{219,-2.0f},{222,-0.9f},{88,0.4f},{91,0.9f},{48,-1.7f},{221,0.4f},{113,0.5f},{163,-1.5f},{84,-1.0f},{246,-0.9f},{107,-1.0f}}},{170,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{228,-0.7f},{244,-0.4f},{198,-0.7f},{102,0.5f},{85,-0.2f},{81,0.2f},{72,0.0f},{74,-0.2f},{202,-1.9f},{73,0.3f},{69,-1.3f},{62,0.1f}}},{171,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{216,0.1f},{190,-1.2f},{40,0.2f},{231,0.9f},{54,-0.8f},{66,-1.9f},{201,-0.6f},{185,-1.4f},{209,-1.3f},{68,0.1f},{85,0.4f},{124,0.2f}}},{172,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{109,0.2f},{42,1.0f},{100,-0.4f},{197,-0.0f},{80,0.0f},{50,-1.6f},{59,-0.9f},{60,-1.0f},{167,0.3f},{116,-0.8f},{58,-0.9f},{179,-0.4f}}},{173,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{84,-0.3f},{82,-1.8f},{48,0.4f},{69,0.5f},{92,-2.0f},{93,-0.7f},{37,0.4f},{236,-0.8f},{165,0.6f},{181,0.1f},{222,-0.0f},{177,0.7f}}},{174,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{119,-1.6f},{214,0.6f},{8364,-0.1f},{44,-1.6f},{194,0.9f},{181,0.4f},{65,-0.9f},{241,-1.5f},{198,-1.9f},{125,-0.1f},{47,-0.6f},{121,0.3f}}},{175,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{215,0.8f},{175,-0.1f},{55,-0.4f},{185,-0.8f},{204,0.7f},{219,-0.4f},{193,-0.6f},{56,0.2f},{64,-0.7f},{202,-1.8f},{237,-0.2f},{245,0.6f}}},{176,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{126,-0.5f},{58,0.7f},{56,-1.3f},{122,-1.1f},{59,-0.2f},{82,-0.3f},{60,-0.3f},{241,-0.8f},{232,-1.9f},{216,-0.2f},{54,-1.2f},{32,-0.1f}}},{177,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{177,-0.7f},{88,-1.1f},{100,-0.2f},{114,-1.0f},{187,0.9f},{178,-0.8f},{201,0.9f},{46,0.1f},{196,1.0f},{76,-0.3f},{255,-0.8f},{245,0.3f}}},{178,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{88,-1.6f},{110,-0.5f},{36,-1.6f},{48,-0.6f},{69,-1.9f},{191,-0.6f},{61,-0.3f},{124,-1.0f},{98,-0.9f},{111,0.1f},{203,-2.0f},{109,-1.4f}}},{179,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{100,-0.8f},{224,-1.7f},{48,-1.0f},{183,-0.1f},{104,0.1f},{35,-0.3f},{230,0.7f},{250,-1.7f},{193,-0.5f},{242,-1.0f},{37,0.6f},{209,-1.9f}}},{180,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{75,-0.4f},{46,-1.3f},{222,-1.3f},{61,-0.5f},{42,0.7f},{62,0.5f},{207,-0.7f},{200,-0.2f},{110,-1.1f},{8212,0.4f},{83,-1.8f},{73,-0.2f}}},{181,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{46,-1.9f},{37,-0.1f},{175,0.5f},{221,-0.7f},{104,0.5f},{186,-0.9f},{173,-0.9f},{176,0.7f},{49,1.0f},{79,0.4f},{86,-1.3f},{238,0.8f}}},{182,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{125,-1.7f},{49,0.1f},{179,0.7f},{114,0.3f},{87,-2.0f},{88,-1.1f},{97,0.3f},{71,0.1f},{241,1.0f},{245,0.7f},{198,0.4f},{162,0.1f}}},{183,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{162,0.1f},{234,-0.7f},{40,-0.5f},{182,-1.7f},{202,-1.3f},{38,-0.3f},{65,-1.5f},{91,-0.9f},{191,-0.1f},{230,-0.2f},{57,0.7f},{107,-0.7f}}},{184,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{206,-0.2f},{172,-0.1f},{8217,-1.4f},{38,-1.2f},{225,-0.2f},{167,-1.2f},{68,0.5f},{173,-1.7f},{64,0.3f},{47,-1.5f},{106,0.1f},{164,0.3f}}},{185,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{237,-1.6f},{238,-1.7f},{38,0.1f},{208,-0.9f},{234,-0.6f},{252,0.2f},{56,0.3f},{126,-0.3f},{181,-0.8f},{99,0.4f},{8212,0.3f},{104,-0.5f}}},{186,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{161,0.3f},{47,-1.8f},{170,0.5f},{218,-0.2f},{53,-0.9f},{95,-1.7f},{237,-0.6f},{42,-0.9f},{181,-1.0f},{107,0.3f},{221,0.7f},{120,-0.9f}}},{187,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{199,0.1f},{95,-0.2f},{115,-0.0f},{219,-1.2f},{91,-0.0f},{227,-1.3f},{244,0.9f},{87,0.6f},{111,-1.7f},{110,-0.8f},{202,-1.6f},{114,0.4f}}},{188,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{224,0.1f},{50,-1.1f},{112,-1.3f},{163,-0.1f},{245,-0.5f},{86,0.4f},{72,-0.7f},{41,-1.7f},{179,-1.8f},{87,-1.3f},{167,-0.4f},{60,0.1f}}},{189,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{207,-1.4f},{182,-0.2f},{34,0.7f},{218,-1.2f},{74,-1.0f},{175,-1.1f},{203,-1.9f},{60,-2.0f},{81,0.3f},{35,0.9f},{94,-1.9f},{110,-1.8f}}},{190,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{180,-0.2f},{234,0.7f},{109,0.9f},{61,-0.7f},{95,0.2f},{237,-0.3f},{60,0.5f},{81,-1.5f},{39,-0.4f},{227,0.7f},{66,-1.3f},{224,-1.8f}}},{191,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{67,-0.9f},{114,1.0f},{212,-0.8f},{53,-0.8f},{197,-0.4f},{203,-0.6f},{98,-1.7f},{81,0.3f},{166,-0.3f},{34,-1.6f},{204,-0.1f},{103,-0.4f}}},{192,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{197,0.6f},{45,-1.8f},{113,0.1f},{69,-1.6f},{88,-0.8f},{166,-0.8f},{42,-1.2f},{169,-1.9f},{251,-1.4f},{216,0.1f},{186,0.9f},{193,0.7f}}},{193,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{37,-0.6f},{210,-1.8f},{100,0.5f},{80,0.7f},{202,-2.0f},{198,0.4f},{254,0.5f},{201,-1.9f},{73,-0.2f},{90,-0.6f},{54,-1.5f},{85,0.5f}}},{194,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{209,-0.5f},{184,-0.9f},{234,0.5f},{59,-0.3f},{168,0.5f},{89,-0.7f},{48,0.8f},{64,-0.9f},{118,1.0f},{194,-0.3f},{186,-0.9f},{191,-0.1f}}},{195,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{59,0.9f},{78,-0.6f},{240,-1.7f},{218,-0.1f},{226,0.8f},{120,-1.3f},{51,-0.9f},{38,-1.7f},{172,-1.0f},{215,-1.9f},{191,0.5f},{47,-0.4f}}},{196,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{222,-0.5f},{117,-0.8f},{65,0.9f},{211,-1.2f},{74,-1.1f},{175,-1.9f},{240,-1.7f},{111,-0.1f},{248,-0.0f},{178,-1.3f},{251,0.2f},{94,-1.5f}}},{197,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{160,0.8f},{167,-1.9f},{228,-1.9f},{180,-1.9f},{238,-1.1f},{185,-0.4f},{235,-0.1f},{234,0.0f},{58,-1.9f},{209,0.6f},{190,-1.3f},{53,0.9f}}},{198,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{120,-1.8f},{253,-1.9f},{247,-1.0f},{46,-0.6f},{37,0.4f},{177,-0.4f},{196,-1.9f},{82,-0.7f},{165,0.4f},{71,-1.2f},{77,-0.4f},{91,0.9f}}},{199,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{80,-0.3f},{42,-1.9f},{219,-0.6f},{248,0.2f},{161,-0.7f},{170,0.7f},{167,-1.5f},{195,-0.4f},{174,0.3f},{101,0.2f},{178,-0.1f},{118,-1.2f}}},{200,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{170,-0.4f},{8364,0.4f},{188,0.1f},{105,-0.4f},{120,-1.2f},{246,0.6f},{181,-1.8f},{166,0.1f},{206,-0.8f},{161,-1.2f},{93,0.3f},{123,-0.2f}}},{201,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{190,-0.6f},{36,0.2f},{72,-0.6f},{188,-1.9f},{60,-1.2f},{88,-0.4f},{70,0.7f},{163,-0.1f},{46,-0.9f},{76,-0.7f},{49,-1.0f},{56,-1.0f}}},{202,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{162,0.1f},{232,0.2f},{164,-0.7f},{106,-1.2f},{53,-1.5f},{90,-1.8f},{250,0.9f},{177,0.9f},{208,-1.8f},{121,-0.2f},{174,0.9f},{175,-0.3f}}},{203,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{77,-0.2f},{69,0.7f},{8221,0.1f},{249,0.3f},{225,-1.1f},{61,0.5f},{201,-1.6f},{84,-0.8f},{187,-0.5f},{245,0.1f},{91,-1.9f},{123,-1.8f}}},{204,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{126,0.8f},{95,0.7f},{71,-1.8f},{86,-0.2f},{166,0.3f},{178,0.8f},{195,-0.3f},{215,-0.6f},{101,-1.5f},{174,-2.0f},{217,-1.9f},{118,-1.2f}}},{205,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{249,0.6f},{182,0.1f},{167,-0.6f},{247,-1.8f},{203,0.2f},{195,-1.6f},{101,-0.2f},{243,-0.1f},{239,-0.9f},{99,-1.8f},{207,-1.0f},{163,-0.0f}}},{206,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{36,0.1f},{242,0.3f},{223,-1.8f},{177,0.4f},{113,-0.7f},{214,0.1f},{34,-0.0f},{8221,-0.7f},{201,0.2f},{112,0.6f},{251,1.0f},{165,-1.9f}}},{207,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{207,0.1f},{217,-0.8f},{169,-0.1f},{8221,0.4f},{121,-0.6f},{76,-1.1f},{168,0.4f},{253,-0.2f},{42,0.2f},{68,-1.9f},{105,0.6f},{197,-0.4f}}},{208,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{216,0.7f},{170,-1.8f},{69,-0.2f},{114,-0.2f},{75,-1.2f},{181,-0.5f},{165,-1.9f},{212,-0.1f},{207,-1.1f},{234,0.5f},{64,0.8f},{193,-0.8f}}},{209,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{63,-1.8f},{97,0.4f},{34,-1.7f},{62,-1.9f},{236,-0.0f},{59,-1.9f},{184,-0.8f},{70,0.4f},{93,-1.7f},{92,0.5f},{42,0.7f},{89,0.9f}}},{210,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{222,0.4f},{224,-0.3f},{89,-1.5f},{72,-0.4f},{202,-1.8f},{211,-0.1f},{190,0.3f},{75,0.9f},{122,0.4f},{219,-1.1f},{166,-0.6f},{196,-2.0f}}},{211,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{234,-1.6f},{44,0.9f},{254,-1.3f},{103,-0.1f},{205,0.3f},{110,-0.5f},{216,0.7f},{224,0.8f},{8220,-0.9f},{97,0.1f},{182,-1.7f},{163,-0.7f}}},{212,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{237,-1.3f},{71,-0.2f},{102,-1.3f},{61,0.5f},{160,-0.9f},{96,-1.6f},{8220,0.0f},{86,-0.7f},{116,-0.1f},{223,-1.7f},{68,-1.8f},{207,-1.1f}}},{213,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{196,0.3f},{113,-1.6f},{82,0.3f},{85,-1.7f},{90,0.4f},{253,-1.2f},{93,-1.3f},{161,-0.7f},{120,-1.6f},{97,0.0f},{32,0.5f},{190,-0.0f}}},{214,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{87,-1.9f},{73,-1.2f},{101,-0.6f},{125,0.3f},{245,-0.4f},{115,-1.0f},{120,0.7f},{8364,0.5f},{96,-1.5f},{210,-1.4f},{8217,-0.1f},{70,-1.3f}}},{215,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{174,0.4f},{241,-1.0f},{126,-0.2f},{8212,0.1f},{80,0.8f},{59,0.3f},{33,-1.2f},{165,-0.9f},{118,-1.8f},{211,0.4f},{116,0.5f},{240,-1.3f}}},{216,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{185,-1.3f},{120,0.6f},{104,-0.7f},{248,-1.1f},{39,-0.8f},{59,-2.0f},{217,-0.8f},{200,0.2f},{45,-1.4f},{75,0.7f},{224,0.0f},{8217,-0.8f}}},{217,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{57,0.6f},{169,-1.1f},{230,-1.6f},{74,0.5f},{247,-0.5f},{233,-0.6f},{191,-0.7f},{87,-0.4f},{232,-1.4f},{111,-1.9f},{207,-0.5f},{41,0.6f}}},{218,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{107,0.8f},{192,0.5f},{108,-0.5f},{99,-1.5f},{72,0.7f},{106,-1.9f},{117,-0.3f},{70,0.9f},{98,-1.0f},{164,-0.4f},{237,-1.1f},{178,-0.8f}}},{219,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{59,-0.7f},{223,0.1f},{225,-0.4f},{244,-1.9f},{114,-1.9f},{65,-0.7f},{34,-1.5f},{120,0.4f},{93,0.2f},{224,0.4f},{122,-0.1f},{197,-1.4f}}},{220,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{174,-0.9f},{106,-0.7f},{226,0.7f},{74,1.0f},{43,-1.0f},{41,-0.2f},{192,-0.5f},{164,-1.4f},{203,-0.5f},{240,-1.7f},{233,0.4f},{60,-0.8f}}},{221,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{232,0.3f},{77,-1.2f},{92,-1.2f},{197,-1.7f},{189,-0.1f},{50,0.3f},{228,0.1f},{172,-1.1f},{238,-1.1f},{166,-1.8f},{87,-1.5f},{97,-1.2f}}},{222,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{85,-0.9f},{64,-1.7f},{42,-1.5f},{237,0.1f},{167,-1.8f},{206,0.3f},{34,0.0f},{210,-0.1f},{193,-0.4f},{108,0.2f},{32,-1.3f},{251,-0.8f}}},{223,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{36,-0.8f},{236,-1.5f},{33,-1.7f},{200,-0.6f},{171,-0.4f},{8221,0.6f},{222,-0.0f},{76,-1.4f},{45,-0.2f},{254,0.5f},{166,-1.3f},{232,-1.1f}}},{224,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{97,0.3f},{247,-1.4f},{69,-0.0f},{226,-1.7f},{100,-1.2f},{124,0.2f},{213,-1.3f},{250,-0.0f},{102,-1.9f},{193,-1.3f},{229,-1.2f},{88,-1.4f}}},{225,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{98,-0.1f},{161,-1.1f},{42,-1.2f},{40,0.6f},{71,-0.6f},{249,-1.5f},{192,-0.3f},{176,-1.6f},{109,-1.8f},{125,-1.2f},{168,0.3f},{123,-1.4f}}},{226,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{110,-0.9f},{42,-0.2f},{100,-0.5f},{118,-1.4f},{33,-0.7f},{241,-0.8f},{238,0.7f},{222,-1.8f},{191,0.2f},{175,0.1f},{173,0.7f},{8217,-0.3f}}},{227,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{245,-0.8f},{162,0.1f},{63,-1.3f},{161,-1.7f},{45,-1.0f},{176,-0.5f},{220,0.4f},{83,0.6f},{60,-0.9f},{90,0.8f},{241,-0.3f},{187,-1.4f}}},{228,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{193,-1.1f},{82,0.5f},{239,-1.8f},{95,-1.1f},{8221,0.0f},{65,-1.6f},{62,0.2f},{102,-0.2f},{207,-1.2f},{35,0.4f},{33,-1.8f},{160,-1.4f}}},{229,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8221,-1.4f},{73,0.0f},{219,-1.3f},{171,-1.4f},{87,-0.2f},{165,0.9f},{203,-0.4f},{190,0.9f},{76,1.0f},{48,0.3f},{192,-0.3f},{94,-0.9f}}},{230,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{52,-0.3f},{123,0.8f},{200,-0.3f},{103,-1.6f},{77,0.7f},{233,0.2f},{210,-0.9f},{185,-0.7f},{175,-0.3f},{207,-0.8f},{212,0.0f},{246,1.0f}}},{231,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{45,-1.5f},{44,-1.4f},{126,-0.6f},{223,-1.2f},{183,-1.4f},{73,-0.2f},{234,-1.2f},{249,0.5f},{184,-1.7f},{211,-1.3f},{160,-0.7f},{122,-1.4f}}},{232,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{108,-1.4f},{191,-2.0f},{248,0.3f},{47,-1.0f},{161,-1.3f},{84,-1.7f},{227,-0.5f},{243,0.2f},{45,0.8f},{111,0.8f},{8364,-1.9f},{224,-0.5f}}},{233,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{189,1.0f},{126,-0.3f},{205,-1.9f},{174,0.5f},{39,0.7f},{230,-0.1f},{217,-1.1f},{235,0.9f},{176,0.7f},{164,-0.7f},{92,0.1f},{197,-0.6f}}},{234,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{68,-0.9f},{96,-1.9f},{194,-0.8f},{162,0.9f},{242,0.9f},{55,-1.5f},{196,-1.4f},{63,0.9f},{50,-1.0f},{243,0.1f},{163,0.8f},{188,0.5f}}},{235,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{221,-1.1f},{212,0.4f},{194,-0.0f},{92,-0.6f},{8220,-1.8f},{86,0.2f},{104,0.5f},{63,-1.9f},{210,0.8f},{34,0.7f},{41,-1.0f},{224,0.0f}}},{236,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{255,-1.4f},{123,-0.9f},{180,0.5f},{8364,-0.1f},{80,-1.7f},{167,0.4f},{183,0.3f},{53,-1.1f},{165,-1.5f},{125,0.2f},{34,0.8f},{104,-1.3f}}},{237,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{116,-1.9f},{117,0.4f},{86,-0.4f},{42,0.7f},{45,0.9f},{36,0.2f},{246,-1.3f},{78,0.7f},{218,-2.0f},{183,1.0f},{115,-0.8f},{247,-1.2f}}},{238,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{192,-0.7f},{41,-1.2f},{163,-2.0f},{60,-1.5f},{110,0.3f},{242,0.1f},{172,0.8f},{8212,-1.6f},{95,0.8f},{90,0.7f},{197,-0.9f},{214,0.9f}}},{239,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{95,-1.4f},{207,-1.6f},{229,0.7f},{205,0.6f},{71,-1.6f},{65,-1.9f},{167,-1.2f},{67,-1.2f},{221,-2.0f},{242,-1.6f},{252,0.5f},{116,-1.8f}}},{240,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{181,0.4f},{248,-1.0f},{175,0.7f},{247,-1.4f},{166,-1.2f},{111,-1.1f},{240,0.1f},{66,-1.8f},{165,-1.8f},{174,-2.0f},{8217,-0.2f},{124,-0.6f}}},{241,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{228,-1.4f},{94,-1.3f},{65,-1.7f},{247,0.7f},{165,-1.0f},{253,-1.0f},{222,-1.6f},{164,0.4f},{88,-0.3f},{216,-1.4f},{223,0.4f},{102,-0.4f}}},{242,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{245,0.6f},{53,-0.5f},{175,-1.8f},{211,-0.6f},{123,-1.3f},{74,-1.8f},{78,-0.1f},{223,-1.0f},{58,0.5f},{122,-0.3f},{79,-0.7f},{240,-0.1f}}},{243,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{231,-2.0f},{50,0.9f},{80,-0.8f},{170,0.9f},{120,-1.6f},{199,-1.2f},{253,-0.5f},{192,-1.9f},{242,0.5f},{62,-1.1f},{179,1.0f},{116,-1.7f}}},{244,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{228,-1.6f},{215,0.4f},{60,-0.9f},{78,-1.1f},{245,-0.9f},{207,-1.7f},{180,-0.7f},{210,0.1f},{95,0.1f},{184,-1.3f},{175,-0.5f},{45,-0.2f}}},{245,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{124,0.1f},{201,-0.4f},{198,-0.8f},{79,-0.8f},{47,0.4f},{245,-2.0f},{84,0.8f},{80,-0.4f},{36,-1.8f},{120,-1.5f},{92,-0.4f},{93,0.4f}}},{246,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{68,-0.2f},{204,-1.9f},{100,-1.8f},{90,0.0f},{124,-1.9f},{117,-0.1f},{252,-1.1f},{67,-1.1f},{56,0.9f},{97,0.6f},{170,-1.1f},{123,-0.8f}}},{247,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{107,-1.6f},{237,-2.0f},{62,-0.6f},{214,-1.8f},{240,-1.4f},{231,-1.0f},{34,0.7f},{247,-1.1f},{59,-0.6f},{173,0.1f},{50,-0.3f},{85,-0.5f}}},{248,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{243,0.2f},{183,0.4f},{161,-0.8f},{53,-1.4f},{252,-0.2f},{39,-0.0f},{50,-0.9f},{109,0.6f},{249,-0.6f},{224,-1.3f},{180,-0.5f},{84,-1.1f}}},{249,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{186,0.1f},{191,-0.8f},{122,-0.7f},{8217,0.8f},{60,0.5f},{216,0.9f},{249,0.1f},{242,-0.8f},{236,-0.9f},{8212,-1.6f},{62,-1.8f},{86,-0.5f}}},{250,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{72,-0.6f},{43,-1.9f},{214,-0.6f},{86,1.0f},{8220,0.0f},{193,-1.0f},{204,0.1f},{249,0.6f},{184,0.3f},{232,-1.2f},{111,0.0f},{109,-0.3f}}},{251,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{186,0.7f},{101,0.0f},{240,-1.1f},{224,1.0f},{171,0.7f},{104,-1.3f},{102,0.7f},{178,-1.0f},{48,-1.5f},{60,-1.2f},{115,0.7f},{179,-1.3f}}},{252,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{39,-0.9f},{237,0.4f},{174,-1.3f},{166,-0.2f},{89,-1.2f},{66,-1.1f},{50,-1.6f},{53,0.2f},{74,-1.2f},{184,0.0f},{219,0.1f},{251,-0.3f}}},{253,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{234,-0.1f},{255,-1.1f},{239,1.0f},{70,-1.1f},{56,-0.6f},{74,-1.0f},{197,-0.3f},{189,-1.4f},{175,0.9f},{60,-1.2f},{46,0.8f},{123,1.0f}}},{254,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{118,-1.9f},{207,0.9f},{54,-1.9f},{243,-0.1f},{41,-0.3f},{64,-0.7f},{65,0.5f},{163,0.4f},{114,-1.9f},{185,-0.1f},{74,0.6f},{106,-0.8f}}},{255,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{63,-0.6f},{212,-0.4f},{210,-1.4f},{36,-2.0f},{163,-0.6f},{54,-1.2f},{192,-0.1f},{86,-1.7f},{122,-0.6f},{214,-0.5f},{40,0.4f},{169,-1.8f}}},{8364,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{173,-1.7f},{71,0.8f},{121,-0.2f},{82,-1.5f},{53,-1.5f},{181,0.3f},{124,-1.4f},{60,0.4f},{216,-0.3f},{220,0.9f},{116,-0.5f},{234,-0.6f}}},{8212,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{193,-1.5f},{178,-1.5f},{163,-0.1f},{125,-1.4f},{198,0.3f},{228,0.1f},{199,0.8f},{186,0.4f},{76,-1.7f},{238,-0.5f},{68,-0.4f},{32,-0.8f}}},{8217,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{228,-1.6f},{8364,-0.0f},{173,-0.9f},{204,0.9f},{230,-1.2f},{194,0.3f},{239,-0.7f},{240,-1.5f},{176,-0.8f},{185,-0.1f},{103,0.0f},{187,-1.0f}}},{8220,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{89,0.6f},{235,-0.0f},{71,-0.1f},{105,0.7f},{216,0.5f},{239,-1.8f},{210,0.6f},{190,-0.0f},{116,0.5f},{218,0.6f},{227,-1.6f},{250,-1.2f}}},{8221,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{85,-0.9f},{175,-0.7f},{118,0.5f},{239,-0.5f},{103,-1.7f},{234,-2.0f},{122,-0.0f},{83,-1.6f},{240,0.3f},{72,-0.2f},{169,-1.4f},{52,-1.8f}}} } };
+TextureFont font1 = { 24, 1, 196, { {32,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{236,-0.6f},{73,-1.9f},{181,-1.5f},{196,1.0f},{38,-0.1f},{115,-1.9f},{244,-1.6f},{223,-1.7f},{107,-1.2f},{233,-0.0f},{111,0.8f},{71,-0.3f}}},{33,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{192,-0.2f},{81,-0.6f},{51,-1.7f},{65,0.8f},{105,-1.4f},{39,-0.9f},{229,-0.1f},{92,-1.2f},{72,-1.7f},{238,-1.1f},{76,-0.9f},{94,0.4f}}},{34,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{204,-0.8f},{66,0.3f},{109,-1.9f},{67,0.4f},{108,-0.6f},{201,-0.1f},{62,0.6f},{198,0.1f},{57,-0.6f},{8221,-1.5f},{85,-0.6f},{177,0.6f}}},{35,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{83,-0.9f},{197,-1.3f},{253,-1.3f},{201,-1.7f},{229,-0.9f},{89,0.1f},{67,-1.4f},{175,-1.0f},{243,-0.8f},{8364,-0.7f},{82,-0.6f},{248,-0.0f}}},{36,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{255,0.3f},{222,-1.7f},{232,0.3f},{229,-0.8f},{179,-1.4f},{160,-1.7f},{42,-2.0f},{84,0.2f},{239,-1.3f},{98,0.8f},{65,0.2f},{197,0.5f}}},{37,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{81,-1.5f},{109,-0.0f},{111,-1.7f},{233,-2.0f},{160,0.2f},{91,-1.5f},{39,-0.3f},{238,-0.8f},{95,-0.5f},{217,0.3f},{103,0.1f},{110,-1.7f}}},{38,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{89,-0.8f},{218,-0.9f},{121,0.7f},{47,-1.9f},{53,0.6f},{93,-0.6f},{75,0.6f},{82,-0.3f},{174,-1.1f},{67,-0.9f},{8364,0.3f},{161,0.9f}}},{39,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{160,-1.8f},{34,-1.0f},{61,0.1f},{164,0.2f},{109,-0.3f},{101,-0.3f},{46,-0.5f},{236,-1.5f},{8220,-1.9f},{195,-1.2f},{187,-1.1f},{102,0.2f}}},{40,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{221,0.9f},{74,-0.3f},{172,-1.4f},{209,0.5f},{96,-1.9f},{220,-1.1f},{250,-1.6f},{65,-0.8f},{55,-0.6f},{98,0.7f},{93,-0.5f},{244,0.7f}}},{41,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{250,0.4f},{43,-0.8f},{164,0.6f},{59,-0.2f},{241,-1.1f},{252,-1.0f},{107,-0.5f},{170,-1.6f},{183,-1.8f},{232,-1.1f},{201,-1.7f},{174,-1.1f}}},{42,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{170,-0.8f},{198,-1.0f},{68,-1.2f},{52,0.9f},{199,-1.8f},{191,-1.6f},{48,-0.1f},{174,0.7f},{125,0.9f},{225,-0.2f},{70,0.6f},{182,-0.9f}}},{43,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{196,0.1f},{69,-1.1f},{76,-1.2f},{244,-0.9f},{65,0.8f},{173,-0.8f},{8220,-0.6f},{43,-0.9f},{51,0.9f},{123,-0.1f},{228,-0.8f},{254,0.4f}}},{44,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{244,0.4f},{187,-1.0f},{96,-1.6f},{228,-1.6f},{242,-0.1f},{174,-0.6f},{212,0.5f},{185,0.6f},{219,-1.3f},{44,0.3f},{107,0.0f},{200,-0.3f}}},{45,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{125,-0.9f},{75,0.5f},{172,-0.5f},{225,-0.8f},{169,0.5f},{109,-0.7f},{101,-0.5f},{88,-1.6f},{222,-1.6f},{34,0.2f},{232,-1.6f},{187,0.4f}}},{46,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{114,-0.8f},{68,-0.1f},{185,-1.2f},{225,-1.1f},{198,-0.7f},{179,-1.4f},{199,0.8f},{71,-1.0f},{191,0.4f},{47,-1.3f},{80,0.5f},{245,-1.0f}}},{47,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,-0.2f},{115,-0.2f},{239,0.2f},{255,-1.9f},{103,0.9f},{62,-1.0f},{237,-0.8f},{160,-0.6f},{40,-0.4f},{105,-0.9f},{84,-0.5f},{250,-1.7f}}},{48,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,-1.0f},{112,-0.1f},{33,0.1f},{184,0.7f},{226,-0.2f},{92,-1.8f},{66,-0.6f},{70,-1.2f},{84,0.0f},{189,-0.6f},{75,-0.9f},{104,-0.7f}}},{49,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{89,-1.6f},{120,-1.4f},{46,0.4f},{115,-0.5f},{58,-0.5f},{236,-1.0f},{163,-0.4f},{204,-0.5f},{248,-1.2f},{242,-0.4f},{192,-0.1f},{116,0.1f}}},{50,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{65,-0.3f},{171,-0.1f},{55,0.8f},{255,-1.7f},{69,-0.1f},{162,-1.6f},{56,-0.3f},{173,-0.1f},{252,-0.7f},{207,-0.8f},{87,-0.8f},{32,0.5f}}},{51,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{230,-0.2f},{180,-0.8f},{108,-1.7f},{255,-1.2f},{176,0.5f},{177,-1.2f},{166,-0.0f},{224,-1.7f},{204,0.9f},{220,0.2f},{66,-1.9f},{182,0.6f}}},{52,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{118,0.6f},{42,-0.8f},{73,-1.9f},{172,-1.3f},{177,0.6f},{223,-0.5f},{36,-0.8f},{175,-1.1f},{205,-1.1f},{209,-1.6f},{167,-0.3f},{63,-1.6f}}},{53,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{68,0.4f},{8220,-0.6f},{69,-0.7f},{215,-2.0f},{92,-0.7f},{250,-1.3f},{82,-0.9f},{39,0.6f},{86,-0.1f},{190,0.8f},{208,0.3f},{182,0.6f}}},{54,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{59,-1.2f},{196,-1.6f},{94,0.2f},{174,0.9f},{97,0.8f},{65,0.8f},{198,0.1f},{184,-0.8f},{210,-0.9f},{8221,0.8f},{205,-0.5f},{126,-0.5f}}},{55,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{202,-1.5f},{39,-0.6f},{44,-1.3f},{189,-0.6f},{114,0.2f},{8221,-1.8f},{91,-0.1f},{58,0.3f},{37,0.7f},{121,1.0f},{51,-1.4f},{248,-1.9f}}},{56,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{231,-1.4f},{178,-1.5f},{204,-1.8f},{206,0.8f},{181,-0.8f},{217,0.4f},{104,0.3f},{94,0.4f},{34,-1.1f},{109,0.3f},{185,-0.6f},{70,0.8f}}},{57,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{239,0.8f},{55,0.8f},{123,1.0f},{219,-1.0f},{91,-1.2f},{32,-2.0f},{203,-1.6f},{223,-1.2f},{74,-0.1f},{181,-2.0f},{224,0.8f},{64,-0.1f}}},{58,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{182,0.8f},{104,0.7f},{88,-0.7f},{199,-1.5f},{8212,0.9f},{229,-1.8f},{60,-0.1f},{8364,-0.9f},{51,-1.1f},{219,-1.6f},{70,-0.4f},{83,0.6f}}},{59,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{222,-1.1f},{198,0.5f},{45,-1.2f},{94,-0.7f},{61,-1.7f},{180,0.9f},{190,0.7f},{90,-0.5f},{196,-1.8f},{113,-1.5f},{60,-1.9f},{236,-1.2f}}},{60,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{39,-1.5f},{250,0.2f},{106,-1.7f},{188,-0.9f},{249,-0.9f},{218,0.7f},{230,-0.9f},{192,-1.0f},{118,-0.2f},{215,-1.8f},{54,-1.3f},{83,-1.3f}}},{61,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{252,0.3f},{111,0.7f},{198,-1.1f},{126,0.7f},{52,0.7f},{63,0.1f},{215,-1.4f},{217,0.8f},{124,0.3f},{95,0.5f},{207,-0.7f},{104,-0.9f}}},{62,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{211,-0.9f},{94,-0.6f},{109,0.7f},{97,0.7f},{219,-0.2f},{195,0.9f},{250,-0.1f},{187,-1.0f},{163,-0.1f},{62,0.7f},{59,-1.9f},{233,-0.0f}}},{63,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{100,0.1f},{114,-1.6f},{59,-0.5f},{226,0.3f},{65,0.4f},{84,0.6f},{160,-1.2f},{185,-1.5f},{115,-1.6f},{209,-1.0f},{43,-1.0f},{46,-1.4f}}},{64,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{63,-0.8f},{171,-0.1f},{86,-0.5f},{172,-0.2f},{66,0.2f},{196,-1.7f},{201,0.9f},{54,-0.4f},{164,0.3f},{39,-1.4f},{163,-0.6f},{67,0.3f}}},{65,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{113,0.9f},{96,0.2f},{207,-0.8f},{34,-1.5f},{200,-1.2f},{8217,-0.8f},{199,0.1f},{243,-0.8f},{253,-1.8f},{252,-1.8f},{98,0.8f},{38,-1.8f}}},{66,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{118,1.0f},{163,-1.6f},{221,-1.3f},{238,0.8f},{233,-0.1f},{119,0.2f},{123,-1.3f},{247,-0.3f},{235,-0.3f},{8217,-1.4f},{96,-1.7f},{93,0.7f}}},{67,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{85,-0.7f},{172,-1.3f},{45,0.8f},{196,-0.9f},{117,-1.3f},{202,0.5f},{8217,-1.6f},{248,-0.1f},{124,-0.9f},{121,-0.6f},{233,0.4f},{246,-0.7f}}},{68,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{99,0.8f},{50,0.6f},{182,0.1f},{184,0.4f},{235,-0.7f},{70,0.3f},{245,-1.6f},{242,0.2f},{35,-1.3f},{200,0.1f},{124,-1.3f},{173,-0.9f}}},{69,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{209,-0.9f},{79,-0.0f},{178,0.5f},{123,0.8f},{126,-0.8f},{243,-0.5f},{41,-0.6f},{244,-1.8f},{236,-0.3f},{78,0.2f},{164,0.8f},{201,-1.4f}}},{70,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{207,0.9f},{214,-0.5f},{83,0.9f},{94,0.4f},{103,-1.7f},{55,-1.3f},{171,-1.4f},{165,-1.6f},{239,0.9f},{194,0.5f},{105,-0.3f},{106,0.6f}}},{71,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{53,-1.8f},{40,0.6f},{52,-1.6f},{114,-1.6f},{94,-0.5f},{178,-0.6f},{55,-2.0f},{81,-1.2f},{177,-0.1f},{65,-0.2f},{240,-1.7f},{185,-0.1f}}},{72,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{208,-1.6f},{223,0.0f},{125,-0.3f},{40,0.5f},{91,-0.2f},{203,-0.6f},{235,-1.0f},{70,1.0f},{37,0.9f},{8212,-1.8f},{162,1.0f},{42,0.3f}}},{73,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{96,-2.0f},{33,-0.8f},{231,-0.0f},{234,-1.7f},{225,-1.3f},{58,-0.7f},{109,0.6f},{252,-0.7f},{88,0.6f},{210,-0.5f},{212,-1.9f},{161,-0.5f}}},{74,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{224,-0.2f},{126,-1.6f},{70,-1.1f},{205,-0.7f},{61,0.5f},{84,1.0f},{100,-0.2f},{203,0.4f},{35,-0.9f},{192,0.7f},{225,0.8f},{234,1.0f}}},{75,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{223,-0.3f},{212,0.9f},{53,-1.8f},{37,0.3f},{87,0.6f},{205,-1.0f},{89,0.2f},{95,-1.4f},{221,-1.5f},{237,-1.7f},{120,-1.5f},{175,-1.1f}}},{76,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{96,-0.5f},{215,-1.6f},{246,-0.9f},{239,-1.5f},{117,-1.2f},{121,0.7f},{173,0.3f},{160,-0.8f},{84,-1.4f},{32,1.0f},{221,-0.7f},{213,-0.0f}}},{77,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{83,-1.1f},{171,-0.4f},{211,-0.2f},{162,-1.4f},{43,-0.2f},{75,-0.0f},{214,-1.5f},{32,-0.5f},{225,0.5f},{85,-1.6f},{57,0.6f},{46,-1.7f}}},{78,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{179,-0.0f},{78,0.6f},{105,0.6f},{100,0.4f},{121,-1.3f},{178,0.2f},{94,0.5f},{211,0.5f},{245,0.6f},{43,0.1f},{252,0.1f},{90,-1.3f}}},{79,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{190,-1.5f},{170,-1.6f},{83,-1.8f},{182,-0.7f},{196,-0.7f},{238,-0.9f},{200,-0.6f},{112,0.4f},{43,-1.8f},{91,-1.4f},{88,0.1f},{203,-0.7f}}},{80,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{255,-0.1f},{195,0.0f},{248,-1.1f},{222,0.4f},{196,-0.9f},{219,0.6f},{185,0.6f},{8212,-0.7f},{160,0.4f},{228,-1.3f},{58,-1.4f},{161,0.6f}}},{81,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{53,0.8f},{97,-0.7f},{239,-1.8f},{172,0.8f},{254,-1.5f},{89,0.8f},{191,-0.0f},{229,-0.0f},{40,0.2f},{165,0.7f},{120,-1.1f},{167,0.9f}}},{82,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{180,-1.0f},{173,-0.3f},{237,-1.4f},{109,0.3f},{160,-1.7f},{253,-0.1f},{112,-1.3f},{98,0.6f},{90,0.1f},{181,0.6f},{165,0.3f},{255,-1.2f}}},{83,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{35,-0.3f},{171,0.0f},{112,-0.6f},{68,-1.4f},{113,-1.6f},{49,0.8f},{84,0.8f},{163,-0.8f},{85,-0.4f},{167,-0.2f},{222,0.5f},{195,0.6f}}},{84,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8220,-0.6f},{94,0.3f},{184,-0.8f},{188,0.5f},{204,-1.4f},{52,-1.8f},{73,-1.4f},{8217,-1.2f},{33,-1.5f},{122,-0.5f},{46,0.2f},{209,-0.4f}}},{85,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{44,-1.1f},{71,0.7f},{81,-1.1f},{34,-1.5f},{110,-1.1f},{172,-0.5f},{242,0.4f},{50,0.0f},{79,0.6f},{230,-0.7f},{38,-1.4f},{161,-1.4f}}},{86,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{45,-1.5f},{84,-1.5f},{220,0.7f},{161,-1.5f},{115,0.1f},{123,-0.6f},{233,-1.0f},{163,0.9f},{43,-0.5f},{237,0.8f},{166,-1.3f},{54,-0.4f}}},{87,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{93,-0.5f},{171,-0.5f},{236,-1.6f},{48,-0.7f},{97,-1.4f},{108,-0.3f},{201,-0.9f},{183,0.6f},{117,0.0f},{226,0.4f},{178,0.1f},{36,-1.3f}}},{88,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{188,-0.9f},{119,-1.3f},{124,0.7f},{178,0.8f},{111,0.1f},{52,0.5f},{46,-2.0f},{197,0.9f},{112,0.7f},{72,0.5f},{66,0.3f},{45,-1.3f}}},{89,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{77,0.7f},{58,0.3f},{94,0.4f},{104,-1.1f},{109,-0.1f},{90,-1.6f},{38,-1.1f},{59,-1.1f},{84,-0.2f},{174,1.0f},{235,-1.9f},{105,-1.4f}}},{90,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{183,-0.9f},{193,-1.9f},{250,0.1f},{200,-0.1f},{89,-1.1f},{8217,0.3f},{32,-0.8f},{112,-1.5f},{181,0.3f},{60,-0.6f},{48,-1.0f},{174,-0.2f}}},{91,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{187,0.9f},{73,1.0f},{224,-0.2f},{174,-0.7f},{204,-0.1f},{166,0.2f},{60,-1.9f},{111,0.1f},{8220,-0.6f},{55,-0.2f},{221,-1.6f},{182,-1.9f}}},{92,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{202,-0.9f},{109,-1.9f},{170,-0.7f},{240,-0.5f},{211,0.9f},{183,-0.9f},{97,-1.2f},{210,0.9f},{121,0.3f},{206,-1.8f},{117,-1.2f},{197,-1.1f}}},{93,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{40,-1.8f},{107,-0.3f},{187,-1.0f},{188,-1.8f},{245,-0.2f},{73,-0.2f},{55,-1.5f},{237,0.0f},{215,-0.7f},{200,-0.2f},{205,-1.1f},{82,0.8f}}},{94,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{83,0.7f},{220,-1.4f},{184,0.5f},{235,-2.0f},{79,-0.7f},{32,-1.3f},{8221,0.7f},{44,-1.7f},{36,-0.9f},{51,0.5f},{164,-0.2f},{124,0.6f}}},{95,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{198,-1.8f},{228,0.5f},{56,-0.2f},{255,-1.9f},{113,-0.5f},{190,-1.3f},{226,-0.5f},{32,-0.8f},{184,-1.9f},{92,-1.8f},{168,-0.2f},{208,-0.2f}}},{96,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{72,-0.9f},{241,-0.9f},{69,-1.8f},{116,0.3f},{80,-1.6f},{68,-0.1f},{190,-1.9f},{170,-1.6f},{112,0.2f},{8217,-1.2f},{33,-1.9f},{125,-1.6f}}},{97,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{93,-1.4f},{113,-1.9f},{85,-1.5f},{8217,0.8f},{72,-1.6f},{178,0.2f},{82,-0.8f},{169,-1.1f},{160,0.3f},{65,-1.8f},{111,-1.8f},{216,0.9f}}},{98,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{196,-0.3f},{203,0.7f},{246,-0.3f},{173,-1.7f},{252,-1.1f},{100,0.3f},{242,-1.3f},{185,-1.4f},{208,-1.5f},{177,0.3f},{184,0.3f},{230,0.7f}}},{99,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{227,0.9f},{64,-0.1f},{209,-1.7f},{91,-0.7f},{208,0.0f},{229,0.9f},{84,0.4f},{189,-0.1f},{241,0.3f},{215,-1.3f},{71,0.7f},{240,-1.5f}}},{100,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{220,-0.4f},{185,-0.1f},{49,-1.1f},{8364,-1.6f},{113,-0.5f},{54,0.1f},{98,-1.5f},{243,0.3f},{198,-0.2f},{109,-2.0f},{237,-1.8f},{65,-0.4f}}},{101,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{187,-1.2f},{44,-0.7f},{240,-1.0f},{199,-1.5f},{230,0.3f},{237,-2.0f},{201,-0.8f},{51,-0.3f},{182,-1.3f},{181,-1.5f},{210,-1.6f},{36,-0.4f}}},{102,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{237,0.9f},{190,-1.7f},{217,0.8f},{58,-1.7f},{249,-1.0f},{224,-0.7f},{203,0.2f},{239,-1.1f},{77,-1.1f},{193,-0.5f},{111,0.4f},{56,0.7f}}},{103,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{183,0.1f},{215,-0.5f},{70,0.8f},{109,0.5f},{214,0.2f},{101,0.2f},{51,-0.0f},{235,0.9f},{105,-0.3f},{40,-0.7f},{210,-1.3f},{166,-0.4f}}},{104,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{50,-1.7f},{167,-1.3f},{237,-0.5f},{64,-0.6f},{96,0.3f},{42,-0.5f},{239,-0.6f},{92,-1.9f},{118,-1.4f},{52,-0.3f},{98,0.0f},{162,-1.2f}}},{105,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{223,-0.5f},{8217,-0.7f},{64,0.9f},{66,-1.4f},{161,-0.0f},{46,-1.4f},{36,-0.7f},{229,1.0f},{45,-0.0f},{177,0.8f},{32,-1.0f},{120,0.8f}}},{106,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,-0.1f},{103,-0.3f},{102,-0.4f},{73,-1.3f},{108,-0.5f},{236,-0.7f},{54,-0.4f},{224,-1.7f},{220,0.9f},{205,-1.0f},{50,0.1f},{200,-0.9f}}},{107,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{89,0.8f},{198,0.5f},{56,-1.0f},{180,0.4f},{90,0.4f},{60,-1.3f},{8221,-1.5f},{54,-0.3f},{186,-1.8f},{96,0.7f},{212,-0.8f},{196,0.5f}}},{108,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{203,-0.4f},{212,-1.8f},{207,0.9f},{49,-0.6f},{245,-0.6f},{63,0.0f},{163,0.8f},{62,-1.5f},{100,-1.9f},{161,-0.8f},{40,-0.8f},{55,-0.6f}}},{109,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{247,-0.6f},{238,-0.8f},{94,-0.8f},{202,-1.9f},{65,-1.2f},{50,0.3f},{192,-0.5f},{168,-0.7f},{85,0.3f},{59,-1.5f},{241,-1.4f},{248,-0.9f}}},{110,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{104,-1.1f},{52,-0.2f},{205,-1.0f},{42,-1.9f},{170,-1.7f},{246,-1.5f},{69,-0.1f},{184,0.0f},{72,-0.2f},{108,0.8f},{231,-0.1f},{214,-1.2f}}},{111,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{179,0.8f},{37,0.5f},{172,-1.7f},{40,-1.5f},{107,-1.1f},{44,-0.2f},{120,1.0f},{83,-0.6f},{119,-0.8f},{78,-0.4f},{94,-1.3f},{67,-0.4f}}},{112,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{205,-0.8f},{58,-0.8f},{171,-0.3f},{206,0.8f},{163,-0.0f},{89,-1.6f},{207,0.5f},{34,-1.7f},{217,-1.7f},{211,0.4f},{208,-1.5f},{112,-0.9f}}},{113,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{192,-1.0f},{199,-0.0f},{73,-0.2f},{215,-1.3f},{100,0.3f},{228,-1.5f},{244,0.5f},{93,-1.8f},{99,-0.9f},{50,0.6f},{248,-0.1f},{195,-1.1f}}},{114,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{42,-0.0f},{173,-1.1f},{179,-1.2f},{191,-0.9f},{8364,0.5f},{45,0.2f},{76,-0.9f},{208,-1.7f},{161,0.6f},{235,0.4f},{239,0.9f},{192,0.1f}}},{115,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{56,-1.9f},{122,-0.3f},{94,0.8f},{247,-0.4f},{48,-0.8f},{125,-1.7f},{238,-2.0f},{201,-2.0f},{234,-1.5f},{233,-1.7f},{240,-0.9f},{111,-0.5f}}},{116,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{167,-1.5f},{79,-1.6f},{177,-1.6f},{220,-0.1f},{56,-0.8f},{196,-1.5f},{101,0.4f},{245,0.4f},{187,0.6f},{78,-1.7f},{160,0.8f},{233,-1.3f}}},{117,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{217,0.5f},{243,-0.9f},{87,-0.9f},{35,0.7f},{227,-0.2f},{178,-1.4f},{242,-2.0f},{81,-0.7f},{222,-1.4f},{161,-1.9f},{108,-1.2f},{70,-1.3f}}},{118,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{53,-0.4f},{48,-0.3f},{87,-1.4f},{218,-1.9f},{250,-1.7f},{67,-0.8f},{95,0.6f},{93,0.4f},{248,-0.5f},{204,-1.3f},{124,-1.8f},{198,-1.5f}}},{119,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{205,-0.4f},{235,-1.1f},{73,-1.3f},{175,-0.4f},{202,-1.0f},{94,-0.3f},{100,0.2f},{120,-0.8f},{8212,-0.4f},{8221,-0.2f},{227,0.7f},{218,0.3f}}},{120,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{201,0.4f},{95,-0.8f},{39,-0.4f},{113,-1.4f},{187,0.3f},{44,-1.7f},{84,-0.1f},{167,0.3f},{57,0.5f},{177,-1.5f},{246,-1.2f},{226,0.1f}}},{121,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{99,-1.4f},{33,-0.6f},{49,-1.6f},{235,-1.9f},{163,-0.5f},{36,-0.8f},{80,-0.1f},{194,-1.1f},{117,-1.3f},{102,-1.4f},{228,-0.3f},{209,-0.6f}}},{122,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{205,0.6f},{80,-1.2f},{62,-1.2f},{114,-0.4f},{247,-0.2f},{108,0.9f},{174,-0.0f},{252,-0.9f},{95,-0.5f},{244,-0.6f},{254,-0.6f},{72,-1.7f}}},{123,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{197,-0.0f},{217,-0.5f},{180,0.0f},{223,0.0f},{184,0.9f},{46,-0.9f},{58,-0.5f},{53,-1.7f},{167,-2.0f},{8212,-0.5f},{100,-1.2f},{80,0.5f}}},{124,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{53,-1.3f},{73,0.6f},{165,0.3f},{57,-0.7f},{45,-1.5f},{86,0.5f},{120,-1.6f},{78,-1.0f},{76,-1.4f},{106,-1.0f},{209,-0.5f},{61,-1.1f}}},{125,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{244,-1.7f},{42,-0.3f},{248,0.7f},{219,-1.2f},{80,-2.0f},{77,-0.1f},{116,0.1f},{233,0.6f},{194,-1.1f},{81,-0.4f},{231,-0.8f},{173,-1.0f}}},{126,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{66,0.1f},{98,-0.3f},{100,-1.2f},{220,-1.1f},{177,-0.8f},{72,-1.1f},{183,0.4f},{81,-1.4f},{163,-0.0f},{185,-1.6f},{55,0.6f},{178,-0.2f}}},{160,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{87,-0.0f},{203,0.4f},{229,-0.0f},{58,0.4f},{175,-1.8f},{99,0.3f},{8217,0.8f},{201,0.6f},{235,0.1f},{226,-1.8f},{92,-0.0f},{65,-1.8f}}},{161,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{94,-1.9f},{41,-0.2f},{255,-0.2f},{122,-0.1f},{55,0.6f},{75,0.0f},{236,-0.5f},{78,-0.1f},{81,-0.4f},{80,-1.3f},{230,0.9f},{221,-1.3f}}},{162,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{59,-1.0f},{115,-0.7f},{174,-0.6f},{77,0.2f},{40,-1.5f},{196,-1.8f},{223,0.1f},{163,-1.0f},{110,-0.3f},{122,-1.9f},{39,-1.5f},{182,-1.4f}}},{163,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{204,0.2f},{221,-0.1f},{251,0.2f},{184,-1.4f},{77,-0.3f},{89,-0.8f},{196,0.8f},{47,-0.4f},{222,-2.0f},{74,-1.6f},{170,-1.3f},{181,0.6f}}},{164,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{167,0.9f},{118,1.0f},{85,0.1f},{58,-0.1f},{232,-0.2f},{164,-1.1f},{113,-1.1f},{40,-0.5f},{218,-1.5f},{51,-1.5f},{83,0.7f},{121,-0.3f}}},{165,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{233,-0.4f},{241,-0.5f},{35,-0.6f},{210,0.2f},{32,-0.0f},{176,0.4f},{87,-0.3f},{88,-1.4f},{177,0.9f},{56,0.1f},{33,0.6f},{72,-1.0f}}},{166,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{230,-1.8f},{62,-1.0f},{208,-0.7f},{188,0.5f},{45,-0.6f},{207,-1.6f},{163,-0.4f},{123,-1.7f},{46,-0.2f},{59,0.8f},{183,-1.8f},{100,-0.7f}}},{167,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{195,-0.1f},{53,0.5f},{173,-0.5f},{123,0.3f},{208,0.8f},{215,0.3f},{75,-0.6f},{244,-1.4f},{212,0.4f},{191,-1.4f},{192,-1.8f},{248,-1.2f}}},{168,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{35,0.7f},{8221,-1.4f},{178,-1.7f},{179,-1.5f},{235,-0.8f},{76,0.5f},{85,0.3f},{106,0.4f},{204,-1.0f},{109,-0.0f},{69,0.5f},{53,-1.3f}}},{169,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{171,-1.8f},{116,-1.3f},{255,0.0f},{8221,-0.7f},{34,-2.0f},{8212,-1.9f},{8364,0.1f},{250,-0.2f},{91,0.4f},{75,-0.7f},{226,0.2f},{106,0.8f}}},{170,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{69,-1.6f},{125,0.2f},{167,-1.9f},{89,-0.1f},{8217,0.3f},{237,-1.1f},{209,-1.7f},{191,-0.9f},{248,0.0f},{207,-0.6f},{227,0.9f},{103,-1.9f}}},{171,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{206,-0.8f},{101,-0.6f},{118,0.5f},{121,-0.8f},{94,-0.7f},{103,-0.6f},{190,-0.5f},{99,-1.8f},{8220,-0.5f},{8217,-0.9f},{49,-1.4f},{90,-0.1f}}},{172,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{41,-1.9f},{225,0.0f},{68,-0.7f},{181,-1.2f},{121,-1.0f},{122,0.2f},{239,-1.8f},{56,0.2f},{96,-1.2f},{93,-0.7f},{113,0.8f},{111,1.0f}}},{173,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{217,0.0f},{160,0.9f},{223,0.9f},{163,0.6f},{8221,-1.4f},{33,-0.1f},{92,-1.3f},{204,-0.8f},{246,0.2f},{250,-1.6f},{76,0.0f},{88,-0.6f}}},{174,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{217,-0.9f},{87,-0.2f},{47,0.0f},{223,0.9f},{40,-1.1f},{247,-0.2f},{8220,-1.1f},{57,-0.3f},{41,-0.9f},{80,-1.3f},{122,0.2f},{48,-0.9f}}},{175,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{124,0.5f},{104,-0.9f},{122,-1.3f},{217,-1.1f},{199,0.6f},{216,-0.8f},{123,-0.4f},{45,-1.5f},{46,-0.4f},{55,0.7f},{176,-0.2f},{118,-0.0f}}},{176,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{243,-0.7f},{109,-1.8f},{176,-0.3f},{173,-2.0f},{99,0.8f},{193,-1.1f},{225,-0.5f},{224,-0.1f},{235,-1.7f},{229,-0.9f},{125,-0.9f},{111,0.9f}}},{177,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{70,-1.9f},{103,1.0f},{236,-1.4f},{58,-0.6f},{251,-0.5f},{65,-0.8f},{239,-0.3f},{190,-1.6f},{116,-1.1f},{205,-0.1f},{91,-0.6f},{122,-1.3f}}},{178,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{253,0.0f},{91,0.5f},{87,-1.8f},{248,-1.9f},{65,0.8f},{206,-0.0f},{213,-0.6f},{168,-1.9f},{242,0.1f},{70,0.4f},{72,-0.9f},{122,-0.1f}}},{179,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{47,-1.4f},{41,-0.2f},{199,-0.6f},{79,0.3f},{88,-1.2f},{222,0.6f},{249,-0.3f},{104,0.4f},{62,0.0f},{8220,-1.6f},{212,-1.3f},{110,-1.0f}}},{180,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{177,0.5f},{121,-2.0f},{209,-0.4f},{247,0.3f},{236,0.7f},{34,-1.1f},{210,0.9f},{48,-0.1f},{252,1.0f},{101,-0.3f},{211,0.7f},{205,-0.3f}}},{181,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{194,-1.8f},{125,0.4f},{241,-1.3f},{8221,-1.0f},{206,-1.9f},{174,0.4f},{192,0.7f},{185,0.1f},{120,-0.2f},{169,-0.9f},{57,0.3f},{238,0.3f}}},{182,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{221,0.6f},{171,-0.3f},{161,0.1f},{45,-1.7f},{236,0.6f},{175,-1.0f},{8221,-0.6f},{250,0.2f},{215,-0.7f},{8212,0.1f},{103,0.7f},{234,0.8f}}},{183,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{38,-0.1f},{193,-1.7f},{8364,-0.6f},{72,-1.2f},{82,0.4f},{235,0.8f},{229,0.5f},{78,1.0f},{52,0.2f},{217,-1.3f},{254,-1.6f},{221,-1.4f}}},{184,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{87,-1.7f},{39,0.1f},{76,-0.9f},{170,0.8f},{226,0.0f},{190,-0.4f},{177,-0.3f},{116,-2.0f},{77,-1.2f},{237,-0.9f},{81,-1.9f},{172,1.0f}}},{185,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{173,-0.3f},{115,-1.9f},{126,-0.1f},{237,0.3f},{220,-1.8f},{177,-1.2f},{183,0.0f},{247,-1.3f},{255,-1.1f},{249,0.6f},{60,-0.3f},{252,-1.6f}}},{186,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{175,-0.4f},{124,-1.4f},{197,0.9f},{53,-1.0f},{110,-0.2f},{50,-0.3f},{178,-0.8f},{187,1.0f},{73,-0.0f},{93,-0.9f},{211,-0.3f},{32,-0.9f}}},{187,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{104,0.9f},{196,1.0f},{123,0.2f},{80,-1.4f},{67,-1.9f},{202,-0.5f},{226,0.8f},{108,0.1f},{203,-0.8f},{56,0.9f},{251,0.2f},{189,-1.6f}}},{188,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{196,0.8f},{49,-0.2f},{254,-1.2f},{165,0.3f},{208,-0.2f},{81,0.6f},{198,-0.4f},{122,0.3f},{243,0.3f},{215,-1.1f},{171,-0.5f},{76,0.4f}}},{189,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{69,-0.1f},{84,-0.5f},{8221,-0.5f},{184,-0.2f},{41,-1.3f},{101,0.0f},{61,-0.8f},{249,-1.8f},{237,0.9f},{54,0.8f},{45,-1.9f},{228,-0.5f}}},{190,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{232,-0.8f},{231,-0.9f},{80,-1.0f},{85,-1.5f},{225,-1.0f},{244,0.1f},{73,-0.1f},{86,-1.0f},{64,-0.6f},{36,0.6f},{161,-1.5f},{8212,0.8f}}},{191,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{250,-1.2f},{38,-0.7f},{189,0.4f},{240,-0.6f},{58,-1.9f},{80,-2.0f},{164,0.2f},{224,-1.1f},{199,-1.8f},{170,-1.0f},{220,0.6f},{60,-0.2f}}},{192,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{47,0.5f},{220,-0.8f},{233,-1.7f},{100,0.6f},{65,-0.4f},{84,0.1f},{35,-0.0f},{73,-0.1f},{179,-1.8f},{45,0.6f},{221,-2.0f},{210,-1.6f}}},{193,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{32,-1.7f},{201,-0.9f},{40,-1.5f},{195,-0.0f},{229,0.6f},{216,-1.7f},{240,0.7f},{92,-1.3f},{217,0.1f},{245,-1.7f},{176,0.1f},{247,-1.6f}}},{194,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{255,-1.8f},{51,-0.4f},{180,-1.5f},{8212,-1.8f},{98,-0.4f},{124,-1.9f},{95,1.0f},{68,-0.3f},{76,-0.2f},{214,-0.6f},{93,-0.8f},{173,-0.2f}}},{195,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{60,-1.5f},{122,-0.3f},{246,0.6f},{117,0.7f},{193,-0.5f},{216,-1.0f},{255,-0.1f},{219,-0.7f},{8212,-1.9f},{234,0.6f},{8220,-1.8f},{98,-0.2f}}},{196,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{172,-0.7f},{229,-0.7f},{163,-0.3f},{160,0.4f},{116,0.2f},{212,-1.0f},{54,-1.1f},{245,-1.9f},{69,0.8f},{207,-1.7f},{210,-1.6f},{255,-0.6f}}},{197,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{244,0.2f},{121,-0.5f},{102,-1.7f},{62,-1.0f},{112,-1.6f},{162,0.9f},{63,0.3f},{74,-0.3f},{198,-0.5f},{253,-0.5f},{201,-1.0f},{179,-1.5f}}},{198,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{47,0.1f},{35,0.3f},{174,0.6f},{240,0.3f},{116,-0.1f},{110,-1.4f},{206,-1.9f},{224,0.5f},{253,0.3f},{94,-0.9f},{122,0.9f},{69,0.9f}}},{199,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{85,0.8f},{73,-0.2f},{168,-1.2f},{8217,-1.0f},{199,0.0f},{79,0.8f},{76,0.8f},{93,-0.3f},{183,-1.2f},{68,0.5f},{222,-1.4f},{223,0.7f}}},{200,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{104,-1.4f},{40,-1.5f},{68,-0.4f},{65,0.2f},{38,0.2f},{176,0.2f},{45,-0.9f},{121,-1.9f},{248,-0.4f},{179,0.1f},{69,0.8f},{174,0.2f}}},{201,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{188,0.3f},{230,-0.9f},{45,0.7f},{184,-1.9f},{226,-1.9f},{171,0.7f},{221,-1.4f},{54,0.3f},{36,-1.4f},{34,-0.3f},{43,-1.4f},{39,-0.4f}}},{202,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{251,-1.9f},{66,-0.6f},{210,-2.0f},{246,-1.0f},{57,0.7f},{112,-0.9f},{73,-0.8f},{204,0.8f},{225,0.1f},{183,-1.7f},{234,1.0f},{192,-0.0f}}},{203,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{115,-1.6f},{74,0.4f},{230,-1.1f},{49,-0.6f},{163,-1.8f},{37,-1.6f},{194,-2.0f},{178,-0.2f},{32,-1.9f},{235,-1.7f},{8217,-0.8f},{220,0.9f}}},{204,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{199,-0.1f},{39,0.2f},{214,-2.0f},{110,-0.2f},{33,0.2f},{37,-1.4f},{93,-0.6f},{200,0.3f},{248,0.6f},{227,0.6f},{163,-0.4f},{103,-1.2f}}},{205,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{40,-1.8f},{56,-0.4f},{166,-1.8f},{44,0.8f},{191,0.9f},{218,0.3f},{190,-1.5f},{70,-0.5f},{60,-0.9f},{244,0.7f},{96,0.3f},{78,-1.1f}}},{206,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{188,-1.6f},{76,0.4f},{234,0.1f},{109,-1.2f},{198,-0.0f},{39,-1.5f},{77,0.1f},{94,-1.7f},{58,-1.7f},{254,-0.4f},{164,-1.8f},{51,-0.3f}}},{207,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{54,-1.0f},{199,-0.1f},{218,-2.0f},{60,-1.5f},{184,0.8f},{185,-0.7f},{97,-1.9f},{162,0.2f},{186,0.1f},{163,-0.2f},{56,-1.9f},{161,1.0f}}},{208,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{38,-0.5f},{194,-0.2f},{232,-1.4f},{32,-1.0f},{180,0.3f},{8364,-0.1f},{200,-0.0f},{76,-1.9f},{109,0.1f},{247,-0.4f},{169,-0.3f},{51,-1.5f}}},{209,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{168,-0.1f},{204,-1.7f},{71,-0.2f},{97,-0.1f},{87,-0.5f},{191,0.8f},{255,-1.9f},{67,-0.0f},{119,-1.7f},{250,-0.5f},{251,-1.5f},{205,0.6f}}},{210,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{122,-0.2f},{107,-1.2f},{114,-1.4f},{96,0.1f},{79,-1.6f},{199,0.3f},{216,0.9f},{86,0.7f},{224,0.3f},{223,-0.1f},{203,0.2f},{59,-0.6f}}},{211,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{229,-1.9f},{207,0.1f},{61,-2.0f},{203,-1.0f},{208,0.1f},{8220,-1.6f},{95,0.5f},{77,-1.3f},{171,0.6f},{172,-0.3f},{218,-1.9f},{74,0.1f}}},{212,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{251,-0.2f},{172,-0.4f},{232,0.1f},{72,0.8f},{115,0.7f},{215,0.7f},{86,-1.3f},{225,0.6f},{94,0.6f},{188,0.9f},{104,-1.5f},{101,-1.8f}}},{213,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{209,0.7f},{95,-0.3f},{181,-1.8f},{67,-0.5f},{161,-0.6f},{75,-1.9f},{37,-0.5f},{243,-1.1f},{56,0.2f},{253,-0.6f},{46,0.5f},{40,-1.1f}}},{214,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{226,-1.4f},{161,0.8f},{176,-1.0f},{82,-1.2f},{92,-1.3f},{199,-0.9f},{71,1.0f},{49,0.3f},{242,-1.7f},{248,0.2f},{250,0.9f},{106,-1.1f}}},{215,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{227,-1.8f},{48,-0.6f},{42,-1.0f},{117,-1.1f},{219,0.0f},{252,-0.4f},{161,0.7f},{86,-1.7f},{125,-1.5f},{221,0.8f},{240,-1.9f},{245,-1.4f}}},{216,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{244,-1.4f},{239,-1.3f},{251,-1.1f},{175,0.3f},{111,0.2f},{228,0.4f},{79,-1.2f},{59,-0.8f},{161,-1.0f},{199,0.5f},{34,-1.4f},{221,0.0f}}},{217,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{183,0.9f},{71,-2.0f},{164,-0.6f},{161,-0.1f},{85,-0.1f},{112,-0.6f},{118,-1.8f},{92,-0.8f},{191,-0.2f},{184,-0.3f},{167,-0.6f},{251,0.1f}}},{218,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{105,-1.2f},{47,-0.4f},{193,0.2f},{183,0.5f},{91,-2.0f},{55,-0.3f},{229,-0.6f},{109,-1.1f},{230,0.7f},{73,0.3f},{180,0.4f},{86,-1.2f}}},{219,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8217,-1.0f},{164,-0.5f},{43,-0.5f},{210,0.1f},{206,-1.2f},{243,-1.5f},{41,-0.8f},{82,0.6f},{186,0.6f},{8221,0.4f},{87,-1.3f},{166,-0.8f}}},{220,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{179,0.1f},{51,0.6f},{248,0.5f},{8221,-1.8f},{164,-1.5f},{46,-1.9f},{32,0.5f},{241,-1.2f},{80,-1.4f},{122,-0.8f},{82,0.9f},{59,-1.8f}}},{221,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{77,-1.5f},{97,-1.6f},{43,-1.5f},{69,-0.8f},{35,-0.3f},{248,-2.0f},{8217,-0.3f},{47,0.5f},{216,0.4f},{206,0.8f},{87,0.3f},{8364,-1.4f}}},{222,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{52,-0.3f},{254,-1.4f},{188,-1.0f},{183,0.2f},{50,-1.1f},{75,0.9f},{101,-1.1f},{197,-0.3f},{36,-1.7f},{170,-1.2f},{106,-1.4f},{214,-1.4f}}},{223,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{92,-0.6f},{203,-0.6f},{82,-1.8f},{192,-1.0f},{113,0.1f},{167,-1.3f},{219,-1.6f},{188,-0.8f},{250,-1.3f},{58,-1.1f},{160,-0.9f},{51,0.7f}}},{224,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{102,0.1f},{103,-2.0f},{249,-0.1f},{71,-1.1f},{92,-1.8f},{202,-0.7f},{255,-0.7f},{220,-1.9f},{187,-1.2f},{46,-1.3f},{170,-1.6f},{177,0.1f}}},{225,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{166,-0.2f},{203,-0.8f},{214,-1.7f},{245,-1.8f},{111,-1.5f},{8217,-2.0f},{200,0.9f},{8221,-1.8f},{114,-0.4f},{125,-0.3f},{189,-1.4f},{68,-0.4f}}},{226,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{207,-0.9f},{226,0.2f},{76,-0.2f},{78,-1.6f},{253,-1.3f},{171,-1.0f},{51,0.9f},{183,0.7f},{59,-0.4f},{32,-0.1f},{188,-0.4f},{230,0.8f}}},{227,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{177,0.7f},{84,-0.4f},{213,-1.9f},{240,-0.1f},{181,-0.6f},{70,0.6f},{97,0.5f},{45,-0.8f},{73,0.6f},{82,0.3f},{243,-1.8f},{190,0.5f}}},{228,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{191,-1.5f},{219,0.1f},{248,-1.1f},{87,0.8f},{192,0.3f},{100,-0.1f},{165,-1.3f},{63,-0.8f},{194,-1.9f},{49,0.2f},{57,-0.9f},{120,-1.0f}}},{229,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{169,-0.9f},{102,0.6f},{180,0.3f},{246,-0.5f},{165,-1.9f},{76,0.3f},{64,-1.0f},{243,1.0f},{175,0.2f},{121,0.8f},{245,-1.5f},{238,0.3f}}},{230,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{251,-0.9f},{105,0.1f},{192,-0.6f},{208,-0.1f},{76,0.1f},{173,-1.4f},{126,-1.0f},{160,0.5f},{39,0.2f},{74,-0.7f},{78,0.7f},{221,-0.7f}}},{231,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{172,0.3f},{102,0.7f},{52,-1.3f},{207,-0.2f},{82,0.0f},{180,-1.4f},{60,0.5f},{228,-1.9f},{41,0.3f},{242,-0.1f},{33,0.1f},{201,-1.6f}}},{232,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{180,-0.3f},{173,-0.2f},{116,-0.4f},{8212,0.3f},{248,-0.0f},{47,-0.6f},{195,0.0f},{109,-1.7f},{53,-0.0f},{183,-1.2f},{88,1.0f},{72,-1.5f}}},{233,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8364,-1.0f},{217,0.8f},{74,0.3f},{174,-1.1f},{242,0.0f},{109,-0.1f},{166,-1.8f},{91,-1.3f},{170,-0.1f},{75,0.3f},{208,-1.6f},{203,-0.8f}}},{234,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{227,-1.3f},{46,-0.2f},{63,-0.2f},{219,-1.2f},{45,0.3f},{65,0.4f},{184,-0.3f},{166,0.1f},{106,-1.6f},{93,-0.0f},{72,0.6f},{185,-1.6f}}},{235,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{40,0.2f},{65,-1.0f},{227,-0.6f},{201,0.4f},{71,-1.4f},{214,-1.3f},{34,-0.1f},{197,0.3f},{96,-1.4f},{204,-1.4f},{205,0.0f},{76,0.6f}}},{236,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{209,0.2f},{191,0.6f},{234,-1.5f},{253,-1.9f},{95,-1.9f},{64,-0.5f},{85,-1.6f},{43,-1.1f},{196,0.6f},{117,-0.2f},{168,0.4f},{182,-1.0f}}},{237,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{86,-1.4f},{97,-1.5f},{80,-0.1f},{73,-1.4f},{118,-2.0f},{103,-0.8f},{233,0.9f},{253,0.1f},{114,0.7f},{124,0.5f},{41,-0.2f},{51,-0.1f}}},{238,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8364,-1.4f},{51,-0.2f},{234,0.6f},{46,-1.9f},{168,-1.9f},{169,-0.6f},{160,-0.8f},{245,-0.4f},{167,0.5f},{79,0.4f},{109,0.5f},{228,-0.2f}}},{239,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{255,-1.2f},{85,-1.9f},{89,-1.1f},{240,-0.1f},{232,-1.9f},{67,-0.7f},{8221,-1.7f},{218,-1.5f},{244,-0.0f},{116,-1.9f},{93,0.8f},{226,1.0f}}},{240,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,-1.8f},{71,0.4f},{51,-1.4f},{86,-1.6f},{80,0.8f},{8220,-1.2f},{171,0.9f},{209,0.1f},{212,0.2f},{242,-1.0f},{123,-1.2f},{126,-0.9f}}},{241,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{90,0.8f},{51,0.8f},{181,-0.3f},{88,-1.1f},{226,0.1f},{102,-0.0f},{227,-0.9f},{34,0.7f},{195,-0.4f},{218,-1.2f},{113,-0.8f},{80,-0.9f}}},{242,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{253,-1.6f},{179,-0.8f},{251,-1.1f},{212,-0.3f},{82,-1.0f},{87,0.6f},{115,-0.6f},{187,-0.1f},{177,-0.3f},{33,0.4f},{44,-1.3f},{108,-0.9f}}},{243,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{210,-0.1f},{126,-2.0f},{222,-0.6f},{223,0.3f},{202,-1.9f},{8364,1.0f},{44,-0.0f},{109,0.8f},{183,0.2f},{194,0.5f},{243,-1.4f},{120,0.1f}}},{244,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{249,0.9f},{160,-1.7f},{175,-0.7f},{180,-0.9f},{163,-1.5f},{173,0.9f},{48,-0.2f},{192,0.1f},{78,-0.9f},{196,-0.4f},{240,-1.5f},{86,0.4f}}},{245,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{91,0.8f},{97,-1.9f},{205,-1.3f},{95,-1.8f},{231,1.0f},{50,-1.0f},{52,0.4f},{83,-0.6f},{209,0.9f},{176,0.2f},{190,-0.2f},{8221,0.9f}}},{246,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{82,-1.1f},{104,-1.7f},{74,0.7f},{180,-1.4f},{249,-0.6f},{8212,-1.3f},{60,-1.9f},{239,0.3f},{39,0.5f},{58,-0.6f},{96,-0.6f},{201,-0.1f}}},{247,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{175,0.5f},{102,0.3f},{162,-0.9f},{218,-0.8f},{54,-0.5f},{212,0.8f},{167,-0.1f},{234,0.5f},{166,-1.6f},{57,-1.4f},{58,0.2f},{125,-2.0f}}},{248,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{248,0.4f},{79,-1.2f},{189,0.1f},{119,-1.7f},{96,0.3f},{111,0.9f},{54,-0.8f},{85,0.5f},{243,-0.3f},{224,-1.5f},{205,-0.6f},{68,-1.3f}}},{249,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{112,-1.9f},{85,0.5f},{206,-0.8f},{255,0.5f},{116,0.6f},{64,-0.5f},{204,-0.3f},{67,0.1f},{166,-0.1f},{248,-1.1f},{104,-0.8f},{41,0.0f}}},{250,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{116,-0.1f},{96,-1.0f},{189,-1.4f},{52,-0.7f},{37,-1.3f},{70,-1.1f},{112,-2.0f},{48,-1.4f},{232,-0.8f},{124,-1.1f},{45,-0.8f},{47,-0.5f}}},{251,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{217,-0.1f},{184,-1.5f},{99,-1.5f},{36,-0.3f},{179,-0.6f},{181,-0.9f},{200,-0.4f},{174,0.6f},{8364,0.9f},{224,-1.7f},{87,0.2f},{125,-0.0f}}},{252,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{179,-1.3f},{48,-1.3f},{115,-1.3f},{225,-0.8f},{56,-1.9f},{55,-1.2f},{197,0.2f},{125,-0.5f},{90,-0.5f},{244,-0.8f},{117,-1.7f},{65,-1.8f}}},{253,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{120,0.3f},{189,-0.0f},{126,-0.9f},{202,-0.3f},{218,-0.7f},{99,-0.6f},{83,0.2f},{174,-0.9f},{250,-1.0f},{162,0.5f},{75,0.5f},{210,-1.5f}}},{254,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,-2.0f},{124,-1.6f},{96,-1.4f},{204,-0.3f},{249,-1.9f},{64,0.3f},{88,-1.6f},{255,-0.6f},{72,-1.7f},{117,-0.8f},{235,-0.9f},{248,0.2f}}},{255,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{219,0.1f},{66,-0.3f},{53,-1.7f},{195,0.3f},{98,-0.0f},{107,0.7f},{70,-1.4f},{212,0.3f},{251,0.8f},{254,-0.7f},{117,0.9f},{240,-1.9f}}},{8364,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{38,0.5f},{240,-0.2f},{207,-1.2f},{58,0.7f},{110,0.5f},{226,-1.9f},{238,-1.4f},{37,-1.5f},{171,0.8f},{232,-1.6f},{205,-0.9f},{76,-0.0f}}},{8212,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{234,-1.3f},{111,-1.6f},{60,-2.0f},{217,-0.6f},{74,-0.5f},{87,0.8f},{32,-1.6f},{44,0.7f},{91,-0.6f},{75,0.3f},{172,0.1f},{211,-0.2f}}},{8217,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{220,-1.0f},{234,-1.7f},{183,-1.0f},{171,-1.9f},{92,0.6f},{255,0.7f},{160,-1.4f},{184,0.0f},{187,-1.3f},{191,0.2f},{33,-1.6f},{80,1.0f}}},{8220,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{216,0.7f},{42,-0.4f},{195,0.9f},{210,0.9f},{112,-0.4f},{188,-1.3f},{254,0.6f},{236,-1.2f},{244,-1.0f},{108,-0.9f},{206,-1.3f},{97,-0.2f}}},{8221,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{232,0.8f},{191,-0.6f},{74,0.8f},{8221,-1.0f},{160,0.5f},{205,-0.4f},{236,-1.3f},{212,0.7f},{72,0.7f},{203,-0.9f},{218,-0.4f},{52,-0.5f}}} } };
+TextureFont font2 = { 48, 0, 196, { {32,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{75,0.9f},{74,-0.8f},{227,0.0f},{8220,-1.9f},{81,0.5f},{215,-1.6f},{84,0.7f},{203,-0.3f},{40,-1.5f},{210,-1.6f},{171,0.5f},{80,-1.7f}}},{33,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{223,-1.0f},{184,0.7f},{77,-0.7f},{53,-0.1f},{204,-0.5f},{54,-0.6f},{67,-0.5f},{243,-0.1f},{35,-0.3f},{169,-1.7f},{103,-1.0f},{80,-0.6f}}},{34,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{239,-1.6f},{164,-1.4f},{103,-0.9f},{165,-1.6f},{116,-1.3f},{49,-1.5f},{109,-1.1f},{67,-0.1f},{98,-1.6f},{231,0.7f},{236,0.8f},{37,-0.9f}}},{35,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{90,-0.8f},{35,-1.6f},{58,0.3f},{86,-1.3f},{241,-0.6f},{8217,-1.3f},{162,-1.5f},{52,-1.2f},{39,-1.3f},{210,0.8f},{125,-2.0f},{122,1.0f}}},{36,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{44,-0.9f},{91,-1.4f},{113,-1.0f},{112,1.0f},{59,-1.2f},{171,-1.1f},{185,-1.9f},{67,-0.9f},{228,-0.5f},{42,0.3f},{101,-0.2f},{212,-1.3f}}},{37,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{44,0.7f},{208,-2.0f},{234,-1.6f},{204,0.7f},{107,-1.6f},{78,-1.8f},{189,-1.5f},{205,-1.3f},{49,-1.5f},{81,-0.0f},{63,-0.4f},{79,0.7f}}},{38,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{95,-0.9f},{248,-0.0f},{254,0.2f},{211,0.3f},{105,0.8f},{197,-1.5f},{222,-0.8f},{173,-1.5f},{91,0.8f},{249,-1.7f},{209,-0.4f},{70,-0.4f}}},{39,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{234,-0.5f},{74,0.5f},{188,-0.4f},{91,0.5f},{185,-1.7f},{48,0.4f},{114,0.9f},{47,-1.9f},{192,0.6f},{64,-0.2f},{179,-1.3f},{68,-0.1f}}},{40,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{103,0.5f},{42,-1.9f},{41,-1.2f},{188,-1.9f},{179,-1.5f},{229,0.6f},{52,0.0f},{8220,-0.3f},{175,-0.1f},{65,-0.5f},{176,-1.4f},{86,-0.9f}}},{41,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{223,-0.6f},{36,-0.9f},{161,-1.3f},{50,0.7f},{204,0.6f},{253,-0.2f},{176,0.9f},{107,-0.8f},{32,-0.3f},{108,-1.5f},{62,0.6f},{82,0.7f}}},{42,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{226,-1.3f},{96,-0.2f},{187,-1.5f},{219,0.8f},{249,-0.7f},{165,0.9f},{66,-0.1f},{57,-1.4f},{124,0.6f},{8364,-0.7f},{179,-0.7f},{221,-1.8f}}},{43,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{234,0.7f},{71,-0.8f},{68,0.1f},{175,-0.7f},{80,-1.9f},{219,-1.0f},{165,-0.9f},{199,-1.1f},{57,-1.0f},{114,0.3f},{176,-0.3f},{8217,-1.8f}}},{44,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{46,-1.4f},{78,-1.5f},{190,-1.3f},{118,0.6f},{173,-0.8f},{253,0.1f},{42,0.1f},{178,-0.2f},{63,-0.8f},{252,0.4f},{189,0.2f},{97,0.6f}}},{45,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{228,0.2f},{239,0.9f},{90,-1.8f},{46,-0.1f},{51,-1.8f},{99,-2.0f},{253,0.0f},{211,0.4f},{86,0.3f},{175,0.4f},{205,-0.6f},{224,-1.9f}}},{46,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{43,-1.6f},{232,-1.8f},{93,-0.4f},{89,-0.7f},{82,-1.9f},{205,0.7f},{39,0.2f},{180,-1.3f},{94,-0.3f},{173,0.9f},{90,0.1f},{230,-1.2f}}},{47,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{126,-0.3f},{231,-0.2f},{106,0.6f},{59,-1.6f},{33,-1.5f},{214,-0.1f},{199,-0.9f},{204,0.3f},{167,-1.1f},{207,-0.8f},{165,0.6f},{217,0.7f}}},{48,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{51,-1.3f},{182,-1.6f},{44,-1.2f},{71,1.0f},{239,-1.5f},{67,-1.8f},{181,0.7f},{76,0.1f},{70,-1.9f},{210,-1.6f},{112,-2.0f},{212,-0.0f}}},{49,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{182,-0.7f},{40,-1.2f},{175,-0.6f},{35,0.5f},{63,0.7f},{78,0.4f},{52,-0.3f},{42,-0.2f},{43,-1.3f},{118,0.3f},{187,-0.8f},{220,-1.9f}}},{50,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{212,-1.0f},{248,-1.3f},{188,0.1f},{177,-1.7f},{83,0.2f},{250,0.7f},{235,-1.9f},{165,0.8f},{69,-1.0f},{77,0.0f},{76,0.4f},{48,-1.6f}}},{51,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{222,-0.8f},{199,-0.9f},{121,-1.1f},{85,-1.4f},{252,0.7f},{117,0.4f},{72,-1.7f},{8220,-0.2f},{171,0.1f},{178,0.2f},{242,-1.6f},{75,0.4f}}},{52,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{200,0.0f},{199,-0.0f},{99,0.0f},{210,-1.1f},{94,-1.5f},{89,-0.9f},{226,-2.0f},{184,-2.0f},{84,-0.2f},{232,0.3f},{237,1.0f},{96,0.1f}}},{53,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{122,0.4f},{69,-1.3f},{64,0.5f},{239,-1.8f},{211,0.9f},{61,-0.8f},{53,0.3f},{212,-1.2f},{224,-0.8f},{54,-0.0f},{8221,-2.0f},{58,0.2f}}},{54,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{236,0.7f},{245,-1.7f},{120,-0.7f},{8212,-1.7f},{8220,0.3f},{182,0.4f},{246,-0.6f},{211,-0.6f},{163,-1.4f},{50,0.5f},{123,-0.9f},{213,0.2f}}},{55,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{167,0.7f},{67,-2.0f},{197,-0.5f},{113,-1.1f},{40,0.5f},{75,0.6f},{199,-1.5f},{59,-1.0f},{51,-1.3f},{227,-1.9f},{224,-1.1f},{244,0.8f}}},{56,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{38,-1.7f},{40,-1.1f},{33,-1.2f},{237,-0.1f},{255,0.4f},{179,-1.8f},{88,-0.8f},{224,1.0f},{113,-0.6f},{112,-1.0f},{219,-0.3f},{114,-1.1f}}},{57,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{104,-0.3f},{173,0.3f},{36,0.8f},{203,-1.7f},{206,-0.9f},{218,0.2f},{86,-0.7f},{67,-0.8f},{234,1.0f},{56,0.9f},{250,0.6f},{202,1.0f}}},{58,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{118,-0.8f},{33,-0.6f},{61,0.9f},{80,0.4f},{164,0.6f},{92,-0.6f},{245,-0.5f},{107,-1.5f},{187,-1.7f},{176,0.9f},{239,-0.0f},{124,0.5f}}},{59,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{166,-1.5f},{8221,0.4f},{77,0.5f},{160,-1.9f},{78,0.6f},{49,-1.0f},{174,-1.6f},{198,-0.1f},{36,-2.0f},{90,-0.5f},{176,-0.5f},{210,-1.2f}}},{60,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{210,-0.9f},{98,-0.5f},{221,-1.9f},{209,0.8f},{181,0.1f},{43,0.4f},{108,-1.8f},{115,-1.8f},{51,-1.1f},{188,-0.8f},{178,-1.1f},{44,0.1f}}},{61,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{197,0.6f},{235,-0.4f},{101,-1.3f},{63,-1.7f},{163,0.3f},{89,-0.7f},{253,0.3f},{53,-0.7f},{186,-0.8f},{67,-1.1f},{77,-2.0f},{208,-0.0f}}},{62,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8212,0.7f},{104,1.0f},{220,0.0f},{162,0.2f},{106,0.9f},{84,-1.4f},{108,-1.4f},{244,-1.1f},{8220,-1.9f},{123,-2.0f},{242,-0.1f},{190,-0.9f}}},{63,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{120,-0.9f},{89,-0.8f},{236,-1.0f},{49,-1.0f},{253,-0.4f},{40,-1.8f},{90,-1.2f},{227,-0.6f},{199,-0.9f},{228,-0.3f},{207,0.3f},{251,-0.3f}}},{64,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{221,-1.0f},{237,-0.6f},{103,1.0f},{41,0.3f},{199,-0.9f},{239,-1.7f},{92,-0.4f},{97,0.8f},{47,0.0f},{251,0.3f},{162,0.4f},{87,0.8f}}},{65,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{197,-1.4f},{178,0.4f},{98,0.3f},{36,-0.6f},{8217,-0.6f},{173,-0.0f},{208,-0.0f},{40,0.3f},{117,0.1f},{73,-1.5f},{113,-0.2f},{45,0.0f}}},{66,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{121,0.4f},{59,-0.6f},{116,-1.1f},{49,-2.0f},{86,0.3f},{44,-1.6f},{63,-0.6f},{66,-0.6f},{62,-0.6f},{84,0.7f},{207,-0.7f},{223,0.5f}}},{67,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{249,-1.0f},{52,-1.8f},{41,-0.9f},{207,-1.4f},{205,-1.8f},{122,-0.1f},{230,-1.1f},{65,-0.4f},{115,-0.8f},{189,0.8f},{170,-1.9f},{32,-1.9f}}},{68,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8221,-0.9f},{85,0.4f},{248,-1.6f},{89,0.6f},{216,0.4f},{163,-1.8f},{254,-1.8f},{223,-1.9f},{114,-1.7f},{120,0.9f},{180,-0.8f},{219,0.7f}}},{69,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{215,-2.0f},{235,0.3f},{94,0.4f},{205,-1.4f},{199,0.1f},{92,0.6f},{82,-1.0f},{183,-1.2f},{180,0.6f},{223,-0.0f},{177,1.0f},{167,0.1f}}},{70,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{50,-2.0f},{99,-0.9f},{202,-1.8f},{83,-0.7f},{171,-0.1f},{72,-1.6f},{213,-0.5f},{175,-0.6f},{69,0.7f},{209,-1.5f},{88,-0.3f},{164,0.6f}}},{71,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{99,-1.2f},{210,0.1f},{112,-0.8f},{120,-0.4f},{248,-0.6f},{239,0.5f},{90,-0.3f},{207,-1.4f},{8221,0.6f},{218,0.9f},{163,0.5f},{60,-1.4f}}},{72,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{111,-0.1f},{225,0.9f},{51,-0.6f},{48,-1.8f},{8364,-0.2f},{99,-1.4f},{91,-0.6f},{85,-1.6f},{213,0.7f},{125,-1.8f},{82,0.4f},{70,-1.4f}}},{73,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{246,-0.6f},{70,-1.4f},{85,-0.8f},{233,-1.7f},{216,-0.9f},{8220,0.1f},{65,-1.0f},{220,-0.6f},{182,-1.2f},{43,-0.6f},{214,0.6f},{112,-0.9f}}},{74,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{87,-1.4f},{171,-0.3f},{55,-1.2f},{249,-0.9f},{8217,-2.0f},{106,-0.1f},{90,-1.0f},{253,0.8f},{169,0.1f},{8220,-0.3f},{103,-1.8f},{60,-1.7f}}},{75,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{170,-0.6f},{110,0.1f},{45,-0.5f},{210,-0.1f},{223,0.3f},{122,-0.8f},{78,0.4f},{117,-0.0f},{179,0.1f},{115,1.0f},{34,0.4f},{229,-1.7f}}},{76,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{121,0.2f},{163,0.7f},{175,-0.9f},{58,-0.4f},{69,-0.8f},{108,0.6f},{89,-1.6f},{162,0.2f},{180,-1.8f},{222,-1.6f},{229,-0.6f},{236,-1.5f}}},{77,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{90,0.4f},{215,0.2f},{232,0.7f},{231,-1.2f},{189,-1.5f},{216,-0.2f},{242,0.7f},{46,-0.6f},{8220,0.6f},{171,-1.6f},{184,-1.5f},{160,0.2f}}},{78,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{76,-1.3f},{45,-0.8f},{56,-0.7f},{248,-0.7f},{176,0.0f},{196,0.7f},{59,-0.2f},{234,0.4f},{80,1.0f},{222,-0.7f},{217,0.8f},{168,0.8f}}},{79,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{233,-0.1f},{175,-0.5f},{41,0.8f},{47,-0.7f},{168,0.2f},{238,0.1f},{46,-1.5f},{231,-0.3f},{180,-1.7f},{173,0.8f},{119,0.8f},{216,-1.8f}}},{80,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{166,0.0f},{93,-1.4f},{44,-1.4f},{95,-1.7f},{119,-0.7f},{222,0.6f},{109,-0.1f},{234,-1.1f},{86,0.9f},{126,-1.6f},{178,-1.2f},{251,0.7f}}},{81,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{35,-0.2f},{62,-0.3f},{240,-1.8f},{43,0.6f},{235,0.6f},{117,-1.1f},{198,-0.8f},{66,-1.1f},{56,0.5f},{224,-1.4f},{249,-0.0f},{181,-1.3f}}},{82,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{68,-0.9f},{89,-1.3f},{184,0.3f},{236,-1.9f},{187,-0.9f},{126,-1.8f},{234,0.6f},{34,0.4f},{212,0.3f},{119,0.6f},{166,-0.7f},{44,-1.7f}}},{83,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{243,0.6f},{99,-0.5f},{93,-1.0f},{71,0.4f},{97,-0.8f},{197,-1.2f},{252,-0.8f},{230,-0.3f},{124,-1.7f},{166,-1.4f},{190,-0.9f},{232,-1.7f}}},{84,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{78,-1.9f},{219,0.3f},{190,-0.1f},{191,-1.5f},{164,-1.4f},{229,-1.3f},{90,-1.6f},{173,-0.8f},{124,-0.4f},{254,0.1f},{178,-1.0f},{92,0.7f}}},{85,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{245,0.9f},{83,0.7f},{238,-0.5f},{253,-0.4f},{68,-0.3f},{210,0.1f},{164,1.0f},{51,0.4f},{8212,-1.2f},{69,0.4f},{178,-0.5f},{239,0.4f}}},{86,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{114,0.4f},{49,0.1f},{198,-1.6f},{191,-1.0f},{69,-0.2f},{94,-1.6f},{92,-1.2f},{87,-0.7f},{253,0.3f},{122,0.7f},{90,0.7f},{218,-1.9f}}},{87,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{255,0.8f},{195,-1.3f},{99,-1.9f},{176,0.2f},{224,-1.9f},{114,0.0f},{40,-0.1f},{236,-1.2f},{8220,0.7f},{228,-0.9f},{124,-0.3f},{108,-1.7f}}},{88,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{208,-0.6f},{36,-1.3f},{83,-0.2f},{80,-2.0f},{121,-1.9f},{168,-1.9f},{63,-1.7f},{86,0.4f},{92,-0.4f},{221,-1.9f},{78,-0.0f},{56,-1.9f}}},{89,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{90,-0.1f},{74,0.3f},{196,-1.7f},{67,0.3f},{170,-0.2f},{120,-1.8f},{211,-1.7f},{79,-1.4f},{225,-0.6f},{189,0.1f},{179,-0.7f},{116,-1.4f}}},{90,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{47,-1.4f},{214,-1.9f},{166,-0.7f},{68,-1.1f},{91,0.5f},{123,-0.5f},{232,-1.8f},{46,1.0f},{254,-0.9f},{125,-0.3f},{116,0.8f},{110,-0.7f}}},{91,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{176,0.2f},{199,0.5f},{240,0.2f},{102,-1.1f},{43,-0.8f},{164,-0.6f},{225,0.8f},{85,0.3f},{41,0.9f},{251,-0.0f},{59,-1.8f},{57,-0.2f}}},{92,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8221,0.2f},{33,-1.2f},{242,0.9f},{126,-0.8f},{207,-2.0f},{122,-0.3f},{239,-0.7f},{8220,-1.1f},{41,0.5f},{64,-0.7f},{175,0.3f},{77,0.1f}}},{93,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{244,-1.1f},{224,0.1f},{63,-1.5f},{68,-1.3f},{44,-1.5f},{43,0.1f},{179,-0.4f},{48,-1.7f},{243,-0.3f},{197,-1.5f},{208,-1.9f},{98,0.4f}}},{94,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{202,-1.9f},{48,0.6f},{218,-0.7f},{224,0.3f},{215,-2.0f},{216,-0.8f},{223,-1.8f},{33,-2.0f},{123,0.5f},{198,0.5f},{69,-0.5f},{195,-1.1f}}},{95,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{74,-0.2f},{247,-1.9f},{95,-0.2f},{32,-1.4f},{180,-1.1f},{35,0.5f},{227,-0.5f},{81,-1.8f},{89,-1.9f},{193,0.6f},{239,-0.3f},{71,-0.7f}}},{96,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{34,0.2f},{77,-1.5f},{229,-1.1f},{71,-0.4f},{204,0.3f},{205,0.3f},{63,-0.1f},{104,-1.2f},{161,-1.1f},{68,0.6f},{75,0.3f},{110,-1.1f}}},{97,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{33,1.0f},{122,-0.7f},{101,-1.8f},{72,-1.6f},{167,-0.6f},{169,0.5f},{186,-0.7f},{189,-0.1f},{196,-0.9f},{44,0.0f},{202,0.7f},{95,-0.4f}}},{98,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{117,-1.9f},{162,0.8f},{229,0.4f},{166,-1.8f},{35,-0.0f},{212,-0.4f},{192,-0.8f},{44,0.2f},{67,0.2f},{214,1.0f},{119,-1.8f},{111,-1.9f}}},{99,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{198,0.7f},{248,-1.4f},{43,-0.4f},{8364,0.5f},{107,-1.9f},{114,-0.4f},{48,-1.8f},{239,-0.3f},{99,-1.5f},{52,-1.4f},{62,-1.2f},{228,-0.8f}}},{100,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{249,-0.5f},{168,-0.0f},{171,0.6f},{85,-1.3f},{221,0.5f},{74,0.9f},{192,-0.2f},{77,0.3f},{54,0.8f},{82,-1.3f},{209,-0.5f},{89,-1.8f}}},{101,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{76,0.3f},{124,-0.9f},{117,-1.1f},{183,-1.0f},{80,-1.3f},{50,0.3f},{213,-1.7f},{58,-1.4f},{42,0.0f},{237,-0.9f},{217,0.5f},{43,-0.0f}}},{102,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{61,-0.4f},{93,-0.9f},{248,-0.8f},{185,-1.0f},{8217,-1.0f},{181,-0.9f},{73,-1.0f},{187,-1.9f},{227,-1.5f},{60,-1.6f},{49,-1.5f},{58,-0.1f}}},{103,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{121,-1.5f},{92,-1.8f},{235,-0.9f},{227,-0.1f},{91,-0.4f},{219,0.8f},{120,-0.6f},{39,0.4f},{214,0.3f},{116,-1.7f},{8212,-0.6f},{213,0.2f}}},{104,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{47,0.6f},{163,0.6f},{82,-0.5f},{8364,-1.1f},{208,-1.4f},{107,-0.1f},{41,0.9f},{115,-1.2f},{88,-1.6f},{233,-2.0f},{166,0.6f},{251,-0.5f}}},{105,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{112,-1.8f},{53,0.4f},{110,-1.7f},{234,-1.0f},{68,-1.2f},{76,-0.1f},{32,0.3f},{196,0.8f},{83,-0.4f},{194,-1.4f},{253,-0.6f},{195,-0.4f}}},{106,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8212,-1.1f},{242,-1.6f},{235,-1.8f},{100,-0.1f},{161,0.6f},{67,-2.0f},{205,-0.1f},{68,0.1f},{56,-1.5f},{118,-1.7f},{230,-1.2f},{62,-1.6f}}},{107,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{186,0.5f},{77,-1.1f},{173,-0.0f},{160,0.4f},{108,-0.9f},{37,-1.5f},{161,-1.2f},{53,-1.6f},{101,0.0f},{67,0.5f},{211,-0.9f},{188,-0.5f}}},{108,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{232,-1.4f},{235,0.4f},{71,-0.5f},{60,-1.7f},{8220,-0.8f},{83,-0.2f},{179,-0.3f},{102,0.0f},{234,-1.5f},{225,0.6f},{84,-0.3f},{8212,-1.2f}}},{109,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{83,-1.4f},{109,0.0f},{56,-0.8f},{225,-0.4f},{160,-1.3f},{111,-0.7f},{120,-1.6f},{55,-1.2f},{33,-0.9f},{86,0.8f},{113,0.8f},{222,0.2f}}},{110,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{229,-1.1f},{162,0.2f},{245,0.9f},{160,-0.7f},{190,-0.3f},{211,0.1f},{79,0.9f},{113,-0.1f},{52,-0.4f},{219,-0.8f},{181,-1.6f},{94,-1.3f}}},{111,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{36,0.1f},{8212,-0.5f},{72,-1.4f},{120,0.9f},{66,-1.3f},{108,0.8f},{114,0.3f},{52,-0.9f},{234,0.4f},{38,-1.1f},{44,-1.3f},{47,0.9f}}},{112,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{98,0.7f},{249,0.3f},{160,-2.0f},{209,-0.8f},{203,-1.7f},{64,0.5f},{100,0.6f},{54,-0.3f},{82,-1.9f},{234,1.0f},{8220,0.3f},{242,0.8f}}},{113,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{92,-1.6f},{193,-0.6f},{8220,-0.5f},{36,-0.1f},{164,-0.1f},{181,-0.4f},{76,-1.9f},{177,-0.6f},{251,-1.4f},{202,1.0f},{40,-0.7f},{34,0.5f}}},{114,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{33,0.8f},{46,-1.4f},{202,-0.6f},{101,0.5f},{114,-0.0f},{49,-0.1f},{88,0.9f},{32,-0.4f},{203,-1.5f},{66,-0.8f},{56,-0.2f},{121,-1.1f}}},{115,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{217,0.2f},{237,-1.5f},{234,0.3f},{97,-1.2f},{182,1.0f},{177,1.0f},{66,-0.1f},{79,-0.0f},{76,-1.9f},{72,-0.8f},{192,-0.4f},{169,-0.0f}}},{116,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{76,-1.9f},{204,-1.8f},{122,-0.1f},{252,-0.3f},{8364,-2.0f},{59,-0.4f},{201,-0.7f},{96,-0.2f},{43,-1.6f},{227,-1.5f},{242,-2.0f},{173,0.2f}}},{117,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{215,0.2f},{231,0.8f},{245,0.0f},{53,-1.8f},{46,-0.8f},{63,1.0f},{69,0.2f},{71,-0.8f},{37,-1.4f},{97,0.2f},{88,-1.4f},{211,-0.8f}}},{118,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{93,-1.4f},{162,-1.0f},{87,-0.1f},{57,-1.7f},{114,-1.4f},{75,0.3f},{168,0.9f},{238,-0.9f},{113,-1.5f},{203,0.3f},{160,-1.7f},{40,-0.9f}}},{119,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{175,0.6f},{111,-1.0f},{84,-0.3f},{48,0.5f},{104,0.8f},{192,-1.0f},{193,0.9f},{183,-1.0f},{90,-1.5f},{223,-1.7f},{250,-0.6f},{44,-1.5f}}},{120,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{32,0.3f},{163,-1.3f},{75,-0.8f},{65,-1.0f},{59,-1.7f},{207,-1.3f},{228,0.2f},{84,-1.7f},{226,-1.2f},{60,-0.3f},{46,-1.5f},{212,0.1f}}},{121,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{114,-1.1f},{161,-0.8f},{103,0.1f},{205,-0.0f},{168,-1.1f},{85,0.7f},{171,0.2f},{121,-1.3f},{50,0.7f},{244,-0.5f},{201,0.1f},{179,-1.0f}}},{122,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{218,-0.1f},{43,-1.1f},{121,-1.0f},{74,0.5f},{214,-1.0f},{96,0.2f},{200,0.2f},{229,-1.9f},{167,0.5f},{247,0.8f},{47,0.5f},{250,-1.7f}}},{123,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{214,0.9f},{104,0.5f},{59,-1.2f},{42,0.5f},{101,-0.5f},{45,-1.0f},{220,-0.5f},{187,0.8f},{192,-0.2f},{84,0.4f},{81,-1.6f},{253,-1.4f}}},{124,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{92,1.0f},{247,0.3f},{45,-0.9f},{54,-1.3f},{40,-1.9f},{80,-1.0f},{8217,0.7f},{123,-0.1f},{170,-1.6f},{249,-0.0f},{72,1.0f},{81,0.5f}}},{125,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{56,0.9f},{180,-0.2f},{8217,0.1f},{105,-0.8f},{252,-0.6f},{167,-1.1f},{217,-0.6f},{57,-0.5f},{85,0.9f},{246,-1.7f},{227,0.8f},{113,0.4f}}},{126,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{113,-0.2f},{169,0.9f},{69,0.7f},{211,-0.2f},{76,-0.2f},{242,0.2f},{78,-0.1f},{250,0.2f},{220,0.2f},{124,-0.5f},{168,-0.9f},{54,0.2f}}},{160,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{110,0.3f},{188,-0.7f},{40,-1.7f},{163,-0.6f},{66,-1.0f},{223,0.8f},{182,-0.2f},{119,0.8f},{221,-1.7f},{210,1.0f},{63,1.0f},{120,0.3f}}},{161,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{201,-1.9f},{108,-0.7f},{170,-1.5f},{84,-0.0f},{112,-1.9f},{173,-0.6f},{226,-0.7f},{217,-1.4f},{81,0.5f},{74,-1.8f},{254,0.9f},{76,0.4f}}},{162,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{55,-0.3f},{125,-1.6f},{78,-0.5f},{162,-0.7f},{93,-1.0f},{245,-1.3f},{52,-1.7f},{198,-0.9f},{98,-0.5f},{206,-1.5f},{216,0.5f},{40,-0.9f}}},{163,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{60,0.5f},{91,-1.9f},{255,-1.8f},{167,0.7f},{174,-1.8f},{183,0.7f},{166,0.7f},{223,-1.8f},{105,-0.2f},{243,-0.4f},{64,-2.0f},{86,0.6f}}},{164,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{237,0.1f},{94,-0.4f},{185,0.1f},{236,1.0f},{224,-0.4f},{106,-1.6f},{162,-1.7f},{121,0.8f},{98,0.3f},{204,0.4f},{85,0.9f},{246,-1.5f}}},{165,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{106,1.0f},{169,-1.4f},{47,-1.5f},{53,0.2f},{61,-0.9f},{81,0.3f},{219,-1.9f},{69,-1.9f},{180,0.9f},{34,-1.6f},{79,0.4f},{82,0.5f}}},{166,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{92,-1.9f},{169,0.4f},{69,-1.9f},{85,-0.4f},{231,0.4f},{120,-0.5f},{45,-1.7f},{50,-1.7f},{238,1.0f},{160,-1.9f},{104,-0.8f},{110,0.5f}}},{167,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,-1.5f},{61,-0.9f},{43,-1.7f},{36,-1.0f},{205,-1.5f},{32,-0.3f},{217,-1.7f},{97,-1.2f},{57,-0.2f},{237,0.5f},{96,-1.7f},{110,-1.8f}}},{168,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{44,0.3f},{50,-1.3f},{228,-0.1f},{41,-0.4f},{68,-0.1f},{83,-0.5f},{171,0.3f},{239,0.3f},{109,-0.2f},{225,-0.7f},{201,-0.7f},{208,0.5f}}},{169,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{125,-1.5f},{59,-2.0f},{255,-2.0f},{75,-0.9f},{238,-0.5f},{236,-0.6f},{223,-0.2f},{246,-1.1f},{70,0.2f},{193,-2.0f},{242,0.2f},{181,1.0f}}},{170,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{95,-1.6f},{244,-1.6f},{189,-1.6f},{83,0.8f},{58,-1.7f},{53,0.1f},{102,-0.6f},{57,-1.3f},{81,0.4f},{254,-0.6f},{65,-0.4f},{109,0.6f}}},{171,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{241,-0.1f},{194,0.9f},{186,0.8f},{212,0.2f},{87,-1.5f},{250,0.3f},{108,-0.3f},{85,0.0f},{126,0.1f},{106,0.9f},{39,0.0f},{227,-0.7f}}},{172,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{75,-0.8f},{216,0.2f},{224,-0.2f},{39,-0.9f},{179,-1.4f},{108,-0.1f},{174,0.0f},{169,-0.4f},{210,-1.0f},{172,0.2f},{8221,0.3f},{175,0.3f}}},{173,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{104,0.8f},{58,0.8f},{63,-1.3f},{164,-1.7f},{37,-1.1f},{85,-0.0f},{221,0.5f},{168,0.6f},{207,-0.4f},{181,-1.3f},{165,-1.0f},{96,-1.3f}}},{174,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{234,-1.8f},{37,-1.2f},{96,-0.8f},{227,-1.5f},{194,0.7f},{62,-1.0f},{8217,-1.2f},{188,-1.0f},{8220,-1.1f},{236,0.6f},{114,-0.5f},{108,0.7f}}},{175,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{180,-0.8f},{236,0.9f},{193,-1.0f},{126,-1.9f},{116,-1.0f},{100,-0.6f},{187,0.1f},{87,-0.1f},{229,0.5f},{122,-1.7f},{45,-1.6f},{168,-2.0f}}},{176,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{236,-1.9f},{239,-0.2f},{8364,-0.1f},{178,-0.5f},{203,0.2f},{33,-0.9f},{50,-1.9f},{64,0.9f},{38,-1.9f},{250,0.3f},{207,-0.2f},{237,-1.4f}}},{177,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{83,-0.5f},{92,-1.4f},{34,-0.8f},{186,0.5f},{113,-0.4f},{93,0.5f},{215,0.3f},{64,0.8f},{169,0.4f},{164,-1.9f},{199,-1.2f},{235,-0.9f}}},{178,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{244,-1.9f},{120,-1.2f},{77,-1.0f},{254,0.3f},{169,-0.1f},{52,-1.4f},{50,0.0f},{89,-0.6f},{91,-0.2f},{232,-1.7f},{230,0.3f},{8364,-1.9f}}},{179,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{201,-0.8f},{243,-0.2f},{101,0.5f},{35,-0.9f},{52,-1.0f},{187,0.3f},{41,0.8f},{196,-1.2f},{167,-1.6f},{60,0.8f},{228,1.0f},{175,0.3f}}},{180,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{73,0.1f},{62,-1.1f},{173,-0.0f},{66,-1.8f},{253,-1.5f},{243,-1.4f},{49,-1.0f},{83,-1.2f},{245,0.6f},{166,0.4f},{8221,-0.4f},{171,-1.3f}}},{181,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{254,0.8f},{245,0.5f},{8364,-1.1f},{119,0.2f},{213,0.1f},{247,-1.4f},{84,-1.0f},{94,-1.2f},{161,0.2f},{242,-1.9f},{32,-0.5f},{187,-1.3f}}},{182,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{212,0.9f},{249,-1.0f},{79,0.6f},{197,-1.8f},{216,-0.1f},{208,0.5f},{41,-0.1f},{200,-0.7f},{82,0.8f},{231,-1.0f},{94,0.2f},{93,0.4f}}},{183,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{33,-0.8f},{165,-0.7f},{43,-0.1f},{104,0.1f},{206,-1.4f},{176,-1.6f},{35,-0.1f},{105,-0.7f},{69,0.3f},{249,-1.1f},{66,-1.4f},{225,1.0f}}},{184,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{87,-0.6f},{224,-0.1f},{172,-0.2f},{63,-0.7f},{211,1.0f},{169,0.5f},{206,0.0f},{66,-1.9f},{193,-1.0f},{163,-1.2f},{175,-0.8f},{182,-1.1f}}},{185,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{74,-1.3f},{120,0.6f},{92,0.9f},{81,0.3f},{216,1.0f},{243,-1.0f},{64,0.4f},{190,-0.9f},{72,0.2f},{75,0.9f},{68,-1.3f},{239,-0.8f}}},{186,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{183,-1.0f},{92,-0.6f},{197,-0.7f},{57,-1.7f},{238,-1.4f},{69,-0.6f},{82,-0.8f},{70,-1.4f},{219,-0.2f},{213,-0.6f},{89,-1.8f},{64,-1.5f}}},{187,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{108,-1.1f},{44,-1.9f},{161,-0.6f},{8212,-0.9f},{219,-0.6f},{241,-1.7f},{104,-0.6f},{76,-0.3f},{75,-0.6f},{177,-0.7f},{110,0.2f},{240,0.3f}}},{188,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{116,-0.4f},{103,0.1f},{249,-0.7f},{241,-1.0f},{66,0.7f},{99,-0.5f},{163,0.9f},{118,-0.8f},{34,-1.7f},{223,0.1f},{53,-1.9f},{178,0.5f}}},{189,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{99,-0.5f},{72,-1.4f},{42,-0.2f},{190,-0.3f},{8217,0.8f},{246,-1.9f},{244,-0.1f},{176,-0.5f},{214,0.0f},{170,-1.3f},{113,-1.4f},{166,-1.6f}}},{190,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{80,0.1f},{228,0.0f},{209,-0.2f},{118,-1.4f},{41,-1.4f},{78,0.5f},{52,-1.9f},{77,0.9f},{234,0.4f},{33,0.6f},{175,-0.2f},{111,0.1f}}},{191,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{110,-1.3f},{238,-1.5f},{8220,0.3f},{229,0.6f},{218,-0.4f},{90,-0.6f},{56,0.5f},{116,-1.3f},{34,0.6f},{191,-0.1f},{172,1.0f},{85,-0.7f}}},{192,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{236,0.8f},{33,0.4f},{168,0.2f},{69,-0.3f},{176,-1.7f},{199,0.8f},{96,-1.7f},{164,-1.5f},{222,0.4f},{125,-0.0f},{109,-0.4f},{251,0.1f}}},{193,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{78,0.3f},{54,-0.3f},{8220,-0.9f},{180,-1.1f},{192,-0.6f},{169,0.2f},{219,-0.6f},{57,-1.2f},{197,0.3f},{202,-1.0f},{228,0.7f},{187,-0.4f}}},{194,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{207,-1.6f},{174,0.9f},{109,-1.0f},{61,-0.8f},{205,-0.9f},{43,-0.5f},{116,-1.8f},{163,-0.6f},{236,1.0f},{185,0.3f},{59,-0.0f},{50,0.5f}}},{195,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8212,0.6f},{163,-1.7f},{46,-1.5f},{87,-1.8f},{8221,-1.9f},{239,-1.7f},{183,0.1f},{250,-1.7f},{186,0.7f},{62,0.4f},{105,-1.2f},{123,-1.9f}}},{196,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{224,-1.4f},{196,0.2f},{203,-0.1f},{193,-1.4f},{53,1.0f},{106,-0.8f},{222,-0.6f},{74,1.0f},{252,0.0f},{244,-1.8f},{183,-1.6f},{66,0.8f}}},{197,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{98,-0.3f},{40,-0.7f},{80,-0.8f},{223,-0.3f},{199,0.7f},{77,-2.0f},{198,-0.3f},{208,-1.9f},{195,-1.8f},{73,-0.8f},{183,-1.6f},{72,0.8f}}},{198,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{224,-1.1f},{87,0.4f},{251,0.8f},{206,0.0f},{184,-0.9f},{82,-1.1f},{58,0.2f},{64,0.6f},{205,0.7f},{59,-0.4f},{234,0.8f},{97,-1.9f}}},{199,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{163,-1.4f},{182,0.0f},{76,-0.5f},{238,-0.1f},{223,-0.9f},{219,-0.8f},{162,0.9f},{87,0.3f},{210,-1.5f},{33,-0.4f},{249,0.8f},{8217,0.5f}}},{200,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{183,1.0f},{245,0.7f},{61,-1.1f},{223,0.4f},{206,-0.3f},{228,-0.7f},{86,-0.1f},{37,-1.8f},{210,0.3f},{98,-1.2f},{39,0.0f},{125,0.3f}}},{201,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{196,-0.1f},{215,-0.8f},{219,1.0f},{240,-1.7f},{214,-0.5f},{229,0.4f},{182,-1.9f},{91,-1.1f},{184,-0.0f},{109,1.0f},{107,0.2f},{65,-0.1f}}},{202,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{92,0.9f},{231,-0.2f},{124,-1.7f},{212,-0.2f},{160,-1.5f},{210,-0.3f},{63,0.5f},{240,-1.3f},{96,-0.9f},{118,-1.7f},{249,-1.4f},{172,-1.4f}}},{203,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{217,-1.6f},{195,-0.7f},{220,-1.7f},{229,-0.6f},{190,-0.7f},{64,-2.0f},{170,-0.9f},{207,-1.2f},{38,-1.0f},{160,-1.5f},{173,-1.0f},{59,0.4f}}},{204,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{244,-1.6f},{55,-1.3f},{116,0.4f},{198,0.2f},{161,-1.7f},{45,-1.0f},{202,-1.4f},{35,-1.6f},{194,0.8f},{181,0.1f},{191,-1.2f},{234,-0.1f}}},{205,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{46,0.8f},{169,-1.8f},{111,0.2f},{106,-1.4f},{103,-0.1f},{171,-1.9f},{52,-0.6f},{199,-2.0f},{249,0.8f},{37,-2.0f},{102,0.9f},{58,-0.6f}}},{206,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{212,-1.6f},{187,-1.2f},{250,0.9f},{251,-0.2f},{253,0.6f},{68,0.3f},{8217,-1.8f},{120,-0.6f},{197,0.8f},{43,0.7f},{234,-1.6f},{71,-2.0f}}},{207,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{73,0.5f},{245,-1.1f},{178,-1.1f},{242,-0.9f},{224,-1.8f},{66,-1.3f},{37,1.0f},{45,-2.0f},{167,-1.8f},{55,-1.2f},{110,-0.9f},{166,-0.1f}}},{208,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{97,-1.2f},{74,-0.9f},{81,0.1f},{202,-1.2f},{41,-0.9f},{82,0.1f},{201,-1.2f},{218,-0.6f},{219,-0.8f},{195,-0.9f},{212,-0.9f},{175,-0.6f}}},{209,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{240,-1.6f},{100,-0.9f},{172,-1.4f},{92,0.7f},{200,0.7f},{126,0.1f},{212,0.6f},{223,-1.7f},{215,0.8f},{78,-1.4f},{75,0.9f},{245,0.7f}}},{210,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{162,0.4f},{76,-0.7f},{196,-0.8f},{232,-0.3f},{96,0.9f},{161,-0.4f},{215,-1.8f},{126,0.2f},{89,-1.8f},{72,0.9f},{175,-1.5f},{61,-1.2f}}},{211,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{204,0.1f},{68,-1.5f},{208,0.8f},{119,-1.5f},{117,-1.4f},{8220,-0.4f},{223,-0.4f},{99,0.8f},{241,0.7f},{70,0.7f},{63,0.2f},{120,-1.1f}}},{212,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{83,-1.9f},{252,-1.3f},{199,-0.9f},{118,0.1f},{78,-1.2f},{190,0.9f},{219,-0.9f},{171,-1.7f},{8220,-1.8f},{84,0.6f},{193,0.0f},{232,-1.1f}}},{213,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{45,0.2f},{188,-1.9f},{203,-1.1f},{239,-0.4f},{166,-0.7f},{247,-2.0f},{161,0.4f},{231,-0.3f},{200,0.9f},{162,0.6f},{204,-0.3f},{199,-1.1f}}},{214,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{251,-0.3f},{124,-1.6f},{229,-1.0f},{108,-1.1f},{238,-1.0f},{226,0.4f},{213,0.6f},{203,-1.3f},{179,0.9f},{104,0.8f},{197,0.2f},{198,-1.4f}}},{215,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{54,-0.7f},{59,-1.4f},{201,0.7f},{8212,-0.1f},{255,-1.0f},{206,-0.6f},{8220,-0.6f},{210,-0.9f},{220,-0.0f},{180,-1.5f},{245,0.3f},{73,-1.4f}}},{216,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{112,0.8f},{99,-0.9f},{165,-1.0f},{118,-1.6f},{84,-1.9f},{211,-0.9f},{199,-1.2f},{163,-1.1f},{85,-0.6f},{214,-0.1f},{175,-0.0f},{210,0.7f}}},{217,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{107,0.6f},{194,0.9f},{79,-0.7f},{70,0.1f},{192,-1.5f},{116,-0.1f},{43,0.4f},{114,-0.2f},{8221,-1.7f},{183,-1.5f},{92,0.7f},{169,-0.0f}}},{218,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{120,-0.8f},{37,-0.3f},{175,-2.0f},{8364,0.1f},{184,0.6f},{178,0.9f},{200,-1.8f},{67,-0.1f},{185,0.3f},{208,0.2f},{77,0.7f},{38,-1.6f}}},{219,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{207,0.8f},{244,-0.3f},{229,-1.1f},{94,-2.0f},{73,-1.4f},{36,1.0f},{77,-0.4f},{172,-1.3f},{116,-1.3f},{69,-0.0f},{99,0.8f},{39,-1.0f}}},{220,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{43,-1.0f},{56,-0.1f},{160,0.3f},{105,-1.5f},{189,0.5f},{49,-1.8f},{186,-0.3f},{8217,-0.5f},{185,-1.5f},{94,-1.7f},{77,-0.8f},{240,-1.9f}}},{221,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{44,-0.9f},{180,0.0f},{74,0.1f},{205,0.5f},{225,-0.2f},{212,-0.3f},{194,0.7f},{45,0.2f},{95,-1.6f},{42,-1.3f},{216,0.4f},{193,-1.9f}}},{222,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{64,-1.2f},{193,-0.5f},{61,-0.5f},{89,1.0f},{195,0.7f},{93,-0.2f},{211,-1.1f},{49,0.5f},{120,0.4f},{255,0.9f},{69,-0.1f},{88,0.8f}}},{223,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{171,0.0f},{219,-0.7f},{117,-0.9f},{224,-1.7f},{59,-0.7f},{71,-0.1f},{84,-0.2f},{196,0.4f},{126,0.9f},{211,-2.0f},{233,-0.9f},{242,-1.4f}}},{224,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{79,-1.3f},{42,1.0f},{58,-1.5f},{210,-0.8f},{36,-1.7f},{229,-1.9f},{200,-1.6f},{8212,-1.1f},{186,-0.5f},{8221,0.8f},{235,0.5f},{203,-1.6f}}},{225,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{45,0.9f},{175,-1.9f},{60,0.8f},{88,0.3f},{58,-1.7f},{248,-1.5f},{112,0.5f},{64,-0.1f},{163,-0.4f},{230,-1.4f},{252,-1.8f},{245,-0.7f}}},{226,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{242,0.2f},{206,-1.8f},{201,0.4f},{181,-0.6f},{90,-1.1f},{214,-0.3f},{229,-1.1f},{48,-1.2f},{39,-0.6f},{111,-0.4f},{40,-1.2f},{227,-0.4f}}},{227,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{234,-1.6f},{120,-0.7f},{113,0.4f},{254,0.6f},{225,-1.7f},{165,0.7f},{48,-1.6f},{215,-0.1f},{35,-1.0f},{77,-1.3f},{40,0.1f},{51,-0.8f}}},{228,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{176,-0.7f},{114,0.4f},{46,-0.3f},{97,0.4f},{198,-0.3f},{61,-0.4f},{81,-0.9f},{71,-0.6f},{41,-1.5f},{168,-0.8f},{96,0.7f},{239,-1.2f}}},{229,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{114,-1.6f},{232,0.1f},{184,-2.0f},{85,0.8f},{245,0.2f},{55,0.9f},{122,0.2f},{185,0.4f},{242,-0.0f},{160,1.0f},{104,0.7f},{220,-0.3f}}},{230,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{180,-1.6f},{83,-0.4f},{101,-1.0f},{195,-1.2f},{102,0.5f},{8212,1.0f},{177,0.3f},{82,0.7f},{98,-0.1f},{185,-0.3f},{237,-0.7f},{55,-1.9f}}},{231,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{65,0.2f},{237,0.3f},{33,0.4f},{119,-1.3f},{86,-1.8f},{114,0.3f},{182,-0.2f},{118,-1.1f},{216,-0.2f},{187,0.4f},{53,-1.3f},{213,-0.8f}}},{232,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{109,-2.0f},{205,0.3f},{230,-1.2f},{164,-0.9f},{59,-0.2f},{170,-0.7f},{32,-0.9f},{197,-1.7f},{217,-1.7f},{106,-1.4f},{204,-0.2f},{238,0.9f}}},{233,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{122,-1.7f},{108,-0.2f},{197,-0.9f},{176,-0.6f},{124,0.9f},{173,0.5f},{34,-1.9f},{221,-0.5f},{174,-1.0f},{204,0.4f},{218,-1.0f},{46,0.3f}}},{234,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{255,-1.4f},{42,-0.6f},{206,0.3f},{119,-1.0f},{85,-0.5f},{63,-1.0f},{245,-0.4f},{66,-0.1f},{223,-1.1f},{205,-1.6f},{90,0.9f},{124,0.4f}}},{235,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{196,-1.8f},{96,-0.8f},{234,-0.8f},{112,-1.1f},{113,-1.9f},{203,-1.1f},{100,-0.7f},{52,-1.0f},{193,-0.5f},{92,-0.5f},{46,-1.7f},{53,-1.3f}}},{236,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{50,0.3f},{238,-1.2f},{197,0.6f},{160,-0.5f},{97,0.6f},{8217,0.3f},{66,-0.9f},{167,0.9f},{49,-0.9f},{227,0.1f},{245,-1.5f},{166,-0.5f}}},{237,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{38,0.1f},{8364,-0.6f},{116,-0.5f},{238,-0.8f},{114,0.7f},{110,-0.1f},{230,0.5f},{162,0.4f},{55,-0.5f},{82,-0.2f},{198,-1.4f},{254,-1.4f}}},{238,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{82,-0.1f},{114,0.6f},{48,-1.5f},{46,0.9f},{84,0.0f},{233,-1.3f},{108,-0.4f},{75,-1.7f},{77,-0.2f},{223,0.9f},{104,0.1f},{39,-1.3f}}},{239,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{66,-1.1f},{253,-1.2f},{177,0.5f},{251,0.8f},{164,0.8f},{58,0.3f},{63,-1.0f},{48,0.4f},{227,-0.6f},{38,0.1f},{36,-1.6f},{199,-1.8f}}},{240,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{90,-0.4f},{189,0.8f},{186,0.4f},{254,-0.2f},{86,-1.5f},{163,-0.4f},{211,-0.5f},{185,-1.1f},{126,-2.0f},{39,-1.2f},{193,-0.4f},{96,-1.6f}}},{241,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{175,-0.0f},{70,0.7f},{93,-0.7f},{124,-0.6f},{83,-0.1f},{180,-0.7f},{110,-0.5f},{210,0.8f},{69,-1.0f},{218,0.3f},{208,0.1f},{232,-0.8f}}},{242,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{214,0.5f},{235,-0.2f},{198,0.2f},{65,0.5f},{90,-0.8f},{221,0.3f},{203,0.5f},{50,0.5f},{109,-0.9f},{201,-0.1f},{236,0.5f},{54,-0.2f}}},{243,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{190,-1.6f},{8212,0.4f},{244,-0.4f},{55,0.5f},{67,-1.5f},{8217,-0.5f},{238,-0.3f},{117,-1.5f},{49,-0.1f},{237,0.2f},{118,-0.1f},{199,0.2f}}},{244,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{65,-1.0f},{223,-1.7f},{103,-1.5f},{249,-0.9f},{175,0.6f},{95,-0.7f},{227,-1.2f},{33,0.3f},{120,1.0f},{204,-0.9f},{124,-1.3f},{66,-1.6f}}},{245,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{47,-1.5f},{188,0.0f},{101,0.2f},{187,-0.6f},{215,-1.5f},{174,0.1f},{245,-1.1f},{80,-0.4f},{88,-0.7f},{76,-0.6f},{86,-1.2f},{226,0.2f}}},{246,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{124,0.7f},{90,-1.0f},{167,0.6f},{35,-1.4f},{65,-1.8f},{253,0.3f},{205,-1.8f},{186,-1.6f},{223,-0.1f},{47,-1.5f},{116,-1.4f},{8364,-1.6f}}},{247,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8212,-0.8f},{206,-0.9f},{8220,-1.6f},{164,-0.1f},{166,-1.3f},{117,-1.1f},{236,-0.6f},{200,-0.4f},{176,-1.0f},{50,0.8f},{215,-1.3f},{232,-1.6f}}},{248,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{77,-0.1f},{100,0.1f},{107,-0.2f},{92,-1.1f},{90,-1.8f},{248,-1.2f},{186,-1.1f},{71,-1.3f},{8220,0.2f},{74,-1.0f},{121,0.2f},{69,-1.8f}}},{249,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8221,0.1f},{104,-1.1f},{223,-0.8f},{102,-0.7f},{254,-0.4f},{191,0.1f},{116,-0.1f},{117,-0.5f},{172,-0.8f},{179,-1.6f},{33,-1.7f},{41,0.6f}}},{250,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{240,0.2f},{49,-1.2f},{211,-1.6f},{171,0.5f},{180,0.3f},{110,-0.6f},{246,-0.1f},{229,0.1f},{92,-0.7f},{206,-0.7f},{221,0.1f},{100,0.7f}}},{251,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{100,-0.8f},{84,-1.1f},{74,-1.3f},{239,-1.6f},{92,-1.5f},{62,-0.8f},{165,-0.9f},{36,-0.4f},{190,1.0f},{212,0.6f},{70,-0.8f},{231,0.4f}}},{252,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{179,-1.3f},{174,-0.9f},{119,0.2f},{68,-2.0f},{220,0.7f},{126,-1.1f},{38,0.2f},{193,-0.2f},{218,-1.6f},{105,-1.4f},{60,0.4f},{114,-0.5f}}},{253,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{62,-0.9f},{243,-0.6f},{179,-0.3f},{81,-1.1f},{8217,-0.6f},{229,-0.7f},{230,-1.5f},{252,-0.9f},{186,-1.8f},{49,-0.4f},{54,0.6f},{219,-0.4f}}},{254,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8217,0.8f},{34,-1.2f},{114,0.4f},{240,-0.8f},{171,-0.3f},{54,-1.1f},{246,1.0f},{122,-0.4f},{227,0.3f},{160,-1.6f},{242,-1.8f},{64,-0.9f}}},{255,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{186,-0.5f},{250,-0.5f},{234,0.6f},{56,0.6f},{243,0.9f},{44,0.9f},{221,-0.0f},{46,0.5f},{235,0.8f},{161,0.4f},{76,0.6f},{96,-0.7f}}},{8364,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{45,0.5f},{51,0.2f},{8364,-0.7f},{183,-0.2f},{67,-0.5f},{87,-1.8f},{204,-0.5f},{75,-1.0f},{55,-0.1f},{78,-1.2f},{111,-0.7f},{96,-1.0f}}},{8212,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{231,0.2f},{165,0.7f},{110,-1.3f},{104,-1.3f},{197,0.0f},{211,0.8f},{118,-1.4f},{190,0.7f},{90,0.4f},{179,-1.2f},{86,0.1f},{98,-1.6f}}},{8217,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{124,-1.0f},{197,-0.7f},{214,0.1f},{76,0.1f},{107,-1.2f},{195,-0.2f},{227,-1.1f},{237,-1.8f},{172,0.9f},{38,-0.2f},{173,0.1f},{119,-1.7f}}},{8220,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{51,-1.6f},{118,-0.0f},{245,-1.6f},{191,-0.2f},{194,-1.9f},{74,0.7f},{123,0.1f},{69,0.6f},{216,-2.0f},{180,-0.3f},{199,-0.2f},{243,-1.9f}}},{8221,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{204,-1.0f},{47,0.0f},{75,-0.3f},{85,0.2f},{253,0.8f},{208,-0.2f},{230,-0.5f},{95,0.8f},{228,-1.7f},{100,-1.0f},{161,0.4f},{69,-0.4f}}} } };
+TextureFont font3 = { 120, 1, 196, { {32,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{217,-1.9f},{56,-1.5f},{168,-1.8f},{112,-0.1f},{124,0.5f},{49,1.0f},{8221,-0.8f},{231,0.6f},{64,-1.5f},{76,0.6f},{50,0.1f},{160,-0.6f}}},{33,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{79,0.0f},{166,-0.1f},{161,-0.3f},{84,-1.6f},{63,-1.4f},{66,0.2f},{119,-0.5f},{230,-0.9f},{8221,0.1f},{204,0.2f},{197,1.0f},{33,-1.9f}}},{34,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{200,-1.0f},{216,-0.0f},{168,0.3f},{166,-1.1f},{162,0.2f},{194,0.8f},{183,0.5f},{71,-0.8f},{8221,0.7f},{206,0.6f},{87,-0.5f},{99,-0.5f}}},{35,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{255,-1.2f},{59,-2.0f},{92,0.8f},{253,-1.7f},{84,-1.8f},{68,0.6f},{38,-0.9f},{78,-0.4f},{32,0.1f},{175,-0.8f},{211,-1.5f},{101,1.0f}}},{36,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{242,-0.6f},{240,-1.9f},{74,0.4f},{250,-1.0f},{192,-0.5f},{123,-1.4f},{94,-0.7f},{97,-1.5f},{247,0.6f},{89,0.5f},{119,-1.9f},{87,-0.6f}}},{37,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{206,-0.1f},{241,0.7f},{176,-1.4f},{98,-1.8f},{83,-1.4f},{119,0.9f},{77,0.8f},{178,-0.9f},{212,0.7f},{110,-1.3f},{78,0.1f},{246,-2.0f}}},{38,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{124,0.4f},{195,-0.5f},{211,-0.1f},{41,0.4f},{106,0.8f},{194,-0.7f},{220,-0.3f},{198,0.6f},{241,-0.4f},{71,-1.1f},{61,-0.7f},{89,-0.5f}}},{39,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{209,0.2f},{225,0.6f},{96,-0.6f},{71,-0.2f},{164,-0.8f},{237,-1.5f},{78,0.8f},{160,0.4f},{114,-0.8f},{66,-0.1f},{64,0.4f},{202,-1.6f}}},{40,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{50,0.2f},{217,-2.0f},{68,-2.0f},{37,-1.8f},{59,-0.7f},{195,-1.8f},{91,-1.6f},{100,-0.4f},{235,-1.7f},{104,0.0f},{83,0.2f},{250,0.7f}}},{41,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{199,0.2f},{230,0.7f},{61,-1.0f},{243,-1.6f},{59,-1.9f},{70,-1.9f},{198,-0.5f},{250,-0.3f},{33,-0.2f},{192,-0.5f},{210,0.7f},{57,0.7f}}},{42,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{72,0.6f},{118,0.3f},{231,-0.4f},{122,0.5f},{90,-0.4f},{194,1.0f},{56,-1.1f},{32,-1.1f},{187,-0.9f},{74,0.9f},{98,0.9f},{46,-1.5f}}},{43,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{217,0.8f},{251,0.6f},{218,-1.9f},{161,-0.0f},{166,-1.8f},{245,-0.8f},{82,-0.1f},{226,-1.2f},{120,-0.6f},{250,1.0f},{48,-0.0f},{225,0.5f}}},{44,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{33,-0.9f},{174,0.6f},{107,-1.1f},{231,0.0f},{103,-1.2f},{47,-1.2f},{41,-0.0f},{86,-1.6f},{101,-1.5f},{93,-0.6f},{239,-0.1f},{178,-1.1f}}},{45,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{166,-1.3f},{224,-0.4f},{115,-0.2f},{62,-1.1f},{55,0.3f},{215,-0.2f},{228,-0.2f},{61,0.7f},{71,-1.9f},{124,-1.4f},{50,-1.0f},{57,-1.6f}}},{46,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{48,0.5f},{64,-1.7f},{194,0.2f},{61,-2.0f},{92,0.2f},{67,0.4f},{82,-1.2f},{187,-1.5f},{98,0.8f},{166,0.4f},{123,-0.6f},{227,-1.9f}}},{47,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{69,-1.9f},{237,0.1f},{168,-0.2f},{250,0.7f},{106,-1.9f},{100,-0.6f},{233,-1.4f},{217,-0.0f},{47,-0.1f},{60,0.0f},{91,-0.7f},{107,-0.6f}}},{48,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,0.3f},{65,-0.8f},{121,0.7f},{61,-1.0f},{43,0.5f},{228,-0.9f},{44,-1.9f},{237,0.6f},{220,-0.4f},{70,-1.2f},{210,-0.4f},{124,-1.8f}}},{49,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{119,-1.2f},{66,0.7f},{90,-0.3f},{177,0.1f},{228,-1.3f},{174,-1.9f},{247,0.1f},{215,-0.8f},{221,-1.0f},{202,1.0f},{55,-1.7f},{95,-2.0f}}},{50,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{164,-1.4f},{60,0.0f},{124,-1.8f},{82,0.6f},{169,-0.4f},{49,-0.4f},{193,-0.9f},{185,-0.6f},{222,0.2f},{223,0.7f},{66,0.9f},{248,0.7f}}},{51,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,-1.3f},{37,0.2f},{79,-0.1f},{32,-1.8f},{47,-0.4f},{209,-0.5f},{246,0.1f},{207,-0.2f},{204,0.9f},{216,0.2f},{239,-1.9f},{100,-0.8f}}},{52,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{165,-1.9f},{59,-0.9f},{236,1.0f},{197,0.3f},{44,0.5f},{239,-0.9f},{222,0.9f},{240,-0.8f},{217,-1.0f},{173,-0.1f},{126,-1.4f},{215,-1.1f}}},{53,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{177,0.3f},{70,-0.6f},{33,-0.2f},{207,-1.3f},{205,-1.5f},{235,-1.1f},{183,-0.1f},{226,-1.6f},{54,-1.3f},{72,0.5f},{162,-1.0f},{227,0.5f}}},{54,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{186,0.5f},{107,-0.2f},{61,-0.2f},{162,0.7f},{176,0.3f},{90,-1.6f},{95,-0.3f},{89,0.9f},{184,-0.9f},{88,-1.5f},{117,-0.3f},{253,-1.7f}}},{55,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{237,-1.4f},{232,0.8f},{236,-0.9f},{89,-0.1f},{40,-0.3f},{177,-1.0f},{117,-0.4f},{250,-1.7f},{198,-0.7f},{107,-1.9f},{83,0.8f},{39,-1.7f}}},{56,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{208,0.1f},{184,-1.5f},{176,-1.6f},{61,-1.3f},{226,-0.3f},{84,0.7f},{246,-0.3f},{49,0.5f},{97,0.9f},{56,0.4f},{236,-1.1f},{213,-0.2f}}},{57,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{174,-1.9f},{239,-1.3f},{217,0.4f},{98,0.5f},{76,-1.1f},{167,0.2f},{112,-1.6f},{32,-0.5f},{126,-1.6f},{166,-0.6f},{62,1.0f},{8212,-0.9f}}},{58,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{185,-0.2f},{225,-0.8f},{248,-1.5f},{90,-0.4f},{226,-1.0f},{237,0.3f},{97,-2.0f},{77,0.5f},{112,-0.2f},{191,-0.8f},{37,-0.1f},{241,0.3f}}},{59,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{33,0.0f},{46,-1.2f},{57,-1.4f},{64,0.5f},{59,-0.1f},{95,0.4f},{79,-0.5f},{201,-1.5f},{170,-0.6f},{221,-1.0f},{97,-0.1f},{45,-1.8f}}},{60,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{51,-1.6f},{234,-0.6f},{125,-1.2f},{215,-1.1f},{106,0.5f},{185,-0.3f},{107,-0.1f},{180,-0.5f},{87,-1.4f},{48,-1.1f},{223,0.2f},{217,-2.0f}}},{61,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{211,0.2f},{166,-1.2f},{176,-1.9f},{120,-0.3f},{179,-1.4f},{163,-0.6f},{64,-0.4f},{244,-1.3f},{164,0.5f},{83,-0.3f},{180,0.9f},{46,0.7f}}},{62,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{34,-0.4f},{190,-0.1f},{62,-0.2f},{70,-1.4f},{68,0.5f},{40,0.6f},{225,-1.7f},{194,-0.9f},{103,-0.7f},{254,-1.6f},{109,-1.8f},{33,-1.7f}}},{63,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{179,-1.5f},{221,0.4f},{177,-1.2f},{51,-0.2f},{197,-0.2f},{36,-0.7f},{195,0.1f},{87,-1.1f},{59,0.7f},{41,0.9f},{233,1.0f},{33,-0.3f}}},{64,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{125,0.8f},{190,-0.9f},{97,-0.6f},{89,-0.8f},{194,0.9f},{113,0.8f},{121,0.2f},{76,0.1f},{242,-0.7f},{246,-1.7f},{36,-0.3f},{55,0.8f}}},{65,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{177,-0.2f},{77,-1.5f},{64,-1.1f},{37,-0.1f},{233,0.7f},{116,0.0f},{81,-0.6f},{34,-0.9f},{108,0.7f},{48,0.9f},{86,-0.9f},{208,-0.5f}}},{66,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{77,-0.3f},{114,-1.4f},{43,-0.0f},{92,0.1f},{49,-1.5f},{108,-0.6f},{207,-1.4f},{59,0.5f},{190,0.1f},{189,-0.1f},{122,0.5f},{82,-0.2f}}},{67,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{94,-1.8f},{82,0.1f},{244,0.1f},{193,-0.3f},{68,-0.4f},{80,-2.0f},{212,0.9f},{237,0.3f},{252,0.3f},{8220,-1.2f},{38,-0.4f},{101,-0.7f}}},{68,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{106,-0.5f},{165,0.1f},{195,0.2f},{111,0.8f},{241,-1.2f},{219,-1.8f},{43,0.9f},{169,-1.3f},{171,-0.8f},{77,-1.7f},{184,-1.5f},{220,-1.0f}}},{69,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{37,1.0f},{79,-1.4f},{210,0.2f},{51,-0.5f},{91,-0.8f},{62,-1.2f},{244,-0.6f},{104,0.1f},{126,-0.2f},{61,-0.6f},{52,-0.6f},{112,-0.4f}}},{70,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{61,-0.1f},{195,1.0f},{237,-1.0f},{103,-1.1f},{181,0.5f},{69,-0.7f},{78,-1.5f},{186,0.6f},{89,0.4f},{62,-0.6f},{213,0.7f},{64,-1.3f}}},{71,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{38,0.5f},{163,0.2f},{39,0.3f},{251,-1.1f},{85,-0.7f},{74,0.4f},{237,-1.4f},{65,-1.4f},{179,0.3f},{227,0.8f},{216,0.3f},{197,-0.5f}}},{72,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{50,-0.3f},{37,-1.8f},{197,-1.8f},{164,0.5f},{99,-0.0f},{38,-0.7f},{79,1.0f},{107,-0.1f},{199,-0.6f},{103,-1.0f},{224,-0.8f},{172,-1.8f}}},{73,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{230,-2.0f},{42,-0.3f},{116,0.2f},{228,0.2f},{209,-1.9f},{245,0.6f},{72,0.9f},{104,-0.7f},{88,-0.5f},{247,-0.2f},{64,0.8f},{71,0.4f}}},{74,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{162,0.3f},{86,-0.4f},{240,-0.3f},{181,-1.6f},{51,0.7f},{172,0.6f},{173,-1.3f},{105,-1.4f},{186,-0.9f},{183,1.0f},{225,-1.7f},{212,0.5f}}},{75,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{80,-0.1f},{251,0.8f},{78,-0.5f},{45,0.9f},{48,0.8f},{8364,-1.5f},{174,-1.5f},{43,-0.1f},{160,0.1f},{168,-0.6f},{74,-0.3f},{52,0.5f}}},{76,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{45,0.1f},{186,-1.9f},{162,0.1f},{163,-1.7f},{227,-1.2f},{161,0.1f},{193,-1.9f},{230,0.6f},{58,-0.6f},{226,0.9f},{50,0.3f},{188,0.1f}}},{77,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{39,-0.8f},{202,0.5f},{191,-0.3f},{118,-1.2f},{190,-0.5f},{107,1.0f},{183,-1.4f},{193,-1.9f},{125,0.8f},{75,-0.8f},{112,0.1f},{117,-0.3f}}},{78,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{66,-0.6f},{239,1.0f},{202,0.5f},{198,-0.3f},{69,-0.4f},{125,-0.1f},{52,-0.4f},{229,-0.3f},{215,-2.0f},{208,-1.4f},{45,-1.7f},{173,-0.9f}}},{79,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{231,0.8f},{217,0.6f},{195,-0.6f},{122,0.7f},{107,-1.2f},{255,-0.2f},{50,-1.5f},{254,-1.3f},{160,0.5f},{71,0.4f},{234,-0.7f},{199,0.5f}}},{80,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{113,-0.2f},{252,-1.4f},{234,0.1f},{162,-0.1f},{172,-0.8f},{248,-1.9f},{54,-1.8f},{177,-1.6f},{169,0.1f},{200,-0.8f},{44,0.9f},{8217,-0.7f}}},{81,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{180,-1.1f},{46,-1.2f},{167,0.8f},{52,-1.6f},{212,-0.7f},{50,-1.1f},{207,0.6f},{216,-1.0f},{174,0.9f},{112,0.2f},{71,-1.9f},{56,-0.6f}}},{82,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{168,-1.0f},{244,-0.9f},{245,-0.2f},{82,-1.2f},{210,0.5f},{187,-0.6f},{67,-0.8f},{37,-1.1f},{77,-1.3f},{118,-0.2f},{236,-0.2f},{163,0.6f}}},{83,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{97,0.0f},{55,-0.9f},{70,0.1f},{198,0.1f},{194,-1.4f},{95,-0.3f},{125,-2.0f},{254,-1.6f},{199,-0.6f},{102,0.7f},{189,0.1f},{160,-0.2f}}},{84,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{218,-0.4f},{57,-1.0f},{221,-1.3f},{8212,-0.2f},{97,-1.4f},{163,-0.2f},{121,0.0f},{212,0.5f},{96,0.0f},{120,-2.0f},{227,-1.8f},{248,-1.4f}}},{85,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{33,-1.5f},{255,0.2f},{96,-1.1f},{228,-0.7f},{69,-0.3f},{182,-1.2f},{205,-1.3f},{50,0.2f},{70,-1.7f},{89,-1.3f},{210,-1.8f},{102,-1.3f}}},{86,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{240,-0.7f},{255,0.1f},{59,-0.7f},{94,-1.6f},{190,0.1f},{229,0.0f},{55,0.3f},{104,-1.7f},{179,-1.6f},{218,0.2f},{202,0.1f},{184,0.1f}}},{87,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{106,-1.8f},{196,-1.8f},{89,-0.7f},{174,-1.7f},{233,0.4f},{162,0.2f},{77,-1.9f},{224,0.0f},{220,0.5f},{170,0.7f},{76,-0.2f},{188,-0.1f}}},{88,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{207,-1.3f},{165,0.1f},{115,-0.2f},{93,-0.4f},{190,-0.7f},{193,-1.0f},{125,0.8f},{183,-0.6f},{116,-1.5f},{254,-1.2f},{231,-0.8f},{213,-0.8f}}},{89,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{187,0.3f},{241,-1.2f},{214,-1.7f},{122,0.7f},{95,-1.9f},{80,-1.0f},{190,-0.3f},{198,-1.4f},{110,-1.8f},{62,-1.4f},{74,0.5f},{185,-0.6f}}},{90,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{188,-0.8f},{57,0.4f},{214,-0.4f},{176,-1.5f},{194,-1.8f},{119,-1.8f},{55,-0.0f},{86,0.7f},{203,-1.2f},{238,-0.7f},{254,0.7f},{210,-0.0f}}},{91,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{89,0.2f},{117,-0.8f},{121,-0.8f},{187,-2.0f},{161,0.8f},{46,-0.4f},{90,0.8f},{78,-1.5f},{100,1.0f},{53,-0.6f},{246,-1.1f},{245,-1.8f}}},{92,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{107,0.3f},{45,-1.7f},{88,0.9f},{214,-0.9f},{34,0.2f},{52,0.2f},{60,0.4f},{49,-0.3f},{199,0.4f},{253,-1.5f},{91,-1.7f},{193,0.7f}}},{93,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{101,-0.7f},{53,1.0f},{238,0.7f},{200,0.8f},{32,-1.6f},{255,-1.9f},{48,-1.7f},{167,0.3f},{227,0.7f},{45,0.7f},{184,0.6f},{229,-0.8f}}},{94,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{53,-1.3f},{102,-1.1f},{253,0.3f},{162,-1.9f},{244,0.2f},{177,-0.5f},{225,0.6f},{43,0.8f},{226,-1.5f},{191,-1.9f},{38,-0.3f},{64,0.6f}}},{95,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{57,-0.4f},{185,-0.7f},{120,-1.2f},{66,-2.0f},{160,0.3f},{195,0.2f},{123,0.5f},{122,-1.2f},{87,1.0f},{49,-0.2f},{74,0.7f},{118,-1.8f}}},{96,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{86,0.5f},{211,0.9f},{120,0.2f},{74,-0.8f},{160,-1.2f},{192,0.9f},{179,-1.1f},{174,-1.0f},{66,-1.9f},{112,-1.5f},{165,-0.3f},{56,-1.6f}}},{97,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{171,-1.2f},{202,-1.0f},{255,-0.9f},{207,-0.0f},{70,0.0f},{173,-1.0f},{125,0.6f},{197,0.0f},{109,-1.7f},{251,0.4f},{77,0.9f},{8212,-0.6f}}},{98,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{255,0.6f},{37,-1.6f},{118,-0.5f},{219,-0.1f},{58,-1.0f},{122,0.2f},{209,0.4f},{70,-1.9f},{74,-1.7f},{47,0.4f},{111,-0.8f},{191,0.4f}}},{99,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{247,-0.4f},{226,-0.4f},{85,-0.8f},{83,-0.5f},{59,0.3f},{43,-1.7f},{201,-1.3f},{46,-1.1f},{188,-0.2f},{96,0.6f},{217,-0.7f},{92,0.0f}}},{100,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{43,-1.0f},{97,-0.6f},{251,0.3f},{62,-0.1f},{116,-1.2f},{195,-0.6f},{64,0.7f},{118,-1.5f},{46,-1.4f},{215,-1.5f},{57,-1.5f},{160,-0.1f}}},{101,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{189,-1.5f},{56,-1.3f},{212,-1.4f},{191,-0.3f},{103,0.6f},{71,-1.2f},{78,0.1f},{38,-0.5f},{46,-0.4f},{219,1.0f},{40,-1.7f},{192,-0.6f}}},{102,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{93,0.9f},{174,-0.0f},{86,-0.9f},{37,-0.5f},{65,-1.0f},{247,0.3f},{80,-2.0f},{73,-1.4f},{101,-1.9f},{160,-0.0f},{181,-1.7f},{104,-1.6f}}},{103,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{115,0.9f},{104,0.2f},{228,-1.7f},{209,-0.7f},{74,0.8f},{72,-1.1f},{189,-1.0f},{8220,-1.5f},{173,-1.2f},{45,-0.8f},{79,-1.3f},{65,-0.3f}}},{104,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{65,-0.3f},{229,0.0f},{49,-0.4f},{218,0.4f},{121,-0.9f},{223,-1.4f},{172,-1.6f},{191,-1.5f},{80,-0.2f},{208,-0.5f},{110,-0.2f},{234,-0.6f}}},{105,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{88,0.6f},{207,0.0f},{112,-1.3f},{224,0.7f},{202,-2.0f},{240,-1.0f},{198,-0.0f},{80,0.5f},{62,-1.4f},{239,-0.6f},{105,-1.0f},{192,-1.3f}}},{106,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{77,-0.5f},{187,-1.6f},{170,-1.1f},{175,-0.7f},{252,-1.1f},{49,0.1f},{174,0.7f},{43,1.0f},{210,0.1f},{222,-1.6f},{64,0.9f},{255,-0.0f}}},{107,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{166,-1.2f},{43,0.8f},{109,-0.7f},{69,-1.8f},{110,-0.3f},{75,-1.5f},{40,-0.4f},{234,-1.8f},{162,0.4f},{52,0.8f},{207,-0.2f},{214,-0.1f}}},{108,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{246,-0.5f},{53,-0.5f},{177,-1.8f},{160,-0.7f},{88,0.9f},{172,-1.9f},{114,0.5f},{235,-1.4f},{238,-0.8f},{161,-0.8f},{120,-1.4f},{244,-0.7f}}},{109,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{181,0.3f},{200,-0.4f},{116,0.5f},{93,0.4f},{123,0.6f},{42,0.2f},{251,-1.2f},{8221,-1.9f},{184,-1.0f},{206,-0.5f},{40,0.1f},{105,0.7f}}},{110,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{89,-0.8f},{114,-1.0f},{84,0.3f},{104,-1.0f},{116,-1.5f},{216,-0.6f},{161,0.1f},{187,-1.8f},{73,0.8f},{92,-1.6f},{190,-0.7f},{212,-1.2f}}},{111,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{238,0.9f},{88,-0.4f},{39,0.2f},{175,-1.5f},{78,-0.5f},{224,-1.9f},{249,-0.3f},{92,-0.6f},{192,-1.4f},{252,0.4f},{86,-0.7f},{227,0.9f}}},{112,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{232,0.6f},{70,0.5f},{242,-0.2f},{98,-0.5f},{161,0.4f},{95,-1.5f},{65,0.8f},{8220,-0.0f},{69,-0.1f},{56,0.6f},{190,0.1f},{238,-1.0f}}},{113,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{39,-1.0f},{55,-0.3f},{220,-0.2f},{175,-1.3f},{162,0.0f},{211,-2.0f},{32,-1.3f},{199,-0.9f},{160,-1.8f},{249,-2.0f},{110,-0.1f},{219,-1.6f}}},{114,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{227,0.9f},{236,-1.8f},{179,-0.8f},{8221,0.9f},{199,-0.9f},{164,-0.1f},{110,-0.9f},{186,0.7f},{184,-0.5f},{71,0.5f},{123,-0.3f},{85,-0.7f}}},{115,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{96,-1.5f},{40,0.3f},{162,0.8f},{172,0.2f},{105,-1.9f},{45,-0.7f},{173,0.9f},{160,-2.0f},{100,0.2f},{39,-0.6f},{98,-1.0f},{198,-0.2f}}},{116,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{193,0.2f},{199,0.3f},{79,-0.2f},{222,-0.3f},{47,0.5f},{233,0.6f},{206,-1.4f},{111,-0.9f},{94,-1.9f},{201,-0.4f},{8221,0.7f},{108,-0.8f}}},{117,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{163,0.4f},{99,-1.4f},{240,-1.4f},{52,-0.3f},{126,-0.4f},{164,-1.9f},{90,-0.9f},{174,-0.7f},{49,1.0f},{87,-1.0f},{197,-1.5f},{241,0.4f}}},{118,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{213,-0.1f},{231,0.9f},{82,0.1f},{120,0.9f},{118,-1.3f},{53,0.3f},{67,0.1f},{190,0.8f},{38,-1.5f},{253,-1.1f},{55,0.1f},{84,-1.1f}}},{119,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{43,0.7f},{119,-0.3f},{86,0.5f},{91,-0.8f},{213,0.6f},{185,-1.9f},{229,-1.2f},{211,-0.3f},{74,-1.7f},{205,-0.3f},{47,-0.8f},{227,0.2f}}},{120,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{108,0.4f},{172,-0.5f},{203,-1.0f},{192,-1.3f},{224,-1.4f},{184,-1.4f},{112,-0.8f},{247,-1.5f},{162,-0.1f},{232,0.1f},{38,0.3f},{89,-0.2f}}},{121,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{79,-1.6f},{111,0.9f},{90,-1.3f},{200,-1.3f},{177,0.8f},{166,-1.5f},{71,-0.2f},{169,-1.2f},{41,-0.3f},{186,-0.7f},{52,-0.5f},{87,0.8f}}},{122,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{83,-1.4f},{176,0.3f},{55,-1.1f},{214,-1.1f},{212,0.1f},{165,0.8f},{249,-1.4f},{42,-1.5f},{45,-0.4f},{71,-1.8f},{93,-0.4f},{168,-1.1f}}},{123,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{181,-0.5f},{64,-1.1f},{217,-1.6f},{176,0.9f},{234,-1.5f},{224,-1.2f},{249,-1.8f},{207,0.1f},{165,-0.1f},{235,0.0f},{180,0.8f},{109,-0.7f}}},{124,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{185,-1.0f},{107,-0.3f},{174,0.9f},{189,0.6f},{251,-0.2f},{249,-0.7f},{61,-1.2f},{178,-0.7f},{226,0.3f},{173,-1.5f},{109,-0.2f},{72,-0.4f}}},{125,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{38,0.4f},{230,-1.1f},{247,0.6f},{192,0.1f},{96,0.9f},{164,-0.2f},{194,-0.4f},{32,-1.1f},{107,-0.2f},{168,-1.1f},{60,-1.0f},{246,-0.9f}}},{126,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{87,0.9f},{116,-0.5f},{35,-1.8f},{170,-0.9f},{222,-1.1f},{193,-1.5f},{123,-0.1f},{112,-1.0f},{218,0.1f},{95,0.0f},{162,-0.2f},{115,-1.7f}}},{160,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{190,0.6f},{231,-0.3f},{56,0.6f},{68,-1.3f},{192,-0.4f},{251,-1.5f},{45,-0.7f},{84,-1.1f},{91,0.0f},{109,-1.2f},{61,-0.6f},{65,-0.1f}}},{161,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{72,0.5f},{184,0.6f},{206,-0.8f},{123,0.8f},{64,-1.6f},{126,-0.9f},{248,-0.6f},{68,0.7f},{196,-1.2f},{165,-0.8f},{222,0.4f},{169,1.0f}}},{162,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{201,0.7f},{243,0.1f},{246,-0.2f},{104,-1.3f},{77,-0.6f},{252,1.0f},{219,0.1f},{61,0.5f},{37,-1.5f},{94,-0.2f},{202,0.4f},{76,0.5f}}},{163,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{59,-1.1f},{95,-0.8f},{215,0.9f},{83,-0.7f},{125,0.9f},{114,-1.5f},{218,-1.2f},{164,-0.4f},{168,-0.9f},{119,0.1f},{188,-0.1f},{66,-0.2f}}},{164,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{77,-1.0f},{197,-0.1f},{208,-1.7f},{247,0.5f},{8364,0.9f},{200,0.5f},{182,-0.1f},{93,-1.5f},{91,-1.0f},{187,-0.5f},{73,0.1f},{162,0.9f}}},{165,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{193,0.1f},{87,0.7f},{32,-0.9f},{167,0.9f},{56,-0.6f},{183,-0.3f},{201,-1.5f},{189,-0.1f},{58,-0.7f},{107,-0.2f},{122,-0.7f},{59,0.6f}}},{166,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{95,0.5f},{48,-1.4f},{67,-0.7f},{175,-0.3f},{160,-0.3f},{46,0.3f},{66,0.8f},{8220,-1.4f},{77,-1.4f},{165,-0.7f},{198,0.1f},{231,0.6f}}},{167,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{88,-0.3f},{244,0.8f},{203,-1.4f},{248,-0.8f},{192,0.6f},{113,-2.0f},{219,0.3f},{171,0.3f},{74,-0.3f},{238,0.5f},{231,-0.7f},{249,0.7f}}},{168,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{244,-0.2f},{113,-1.5f},{122,-2.0f},{234,0.3f},{195,-1.0f},{123,-1.4f},{109,-1.9f},{182,0.8f},{188,-0.8f},{230,0.1f},{160,-1.1f},{239,0.6f}}},{169,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{38,-0.9f},{184,-1.5f},{69,0.2f},{211,1.0f},{230,-0.0f},{198,-0.4f},{67,-0.5f},{77,-1.7f},{244,-0.7f},{125,-1.1f},{72,0.8f},{78,0.5f}}},{170,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{195,-2.0f},{99,-0.7f},{94,1.0f},{251,-1.9f},{54,-1.2f},{184,-1.7f},{192,0.2f},{45,-0.6f},{182,0.5f},{100,-1.2f},{174,-0.0f},{53,-0.3f}}},{171,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{198,0.9f},{184,0.8f},{49,-0.7f},{228,-1.9f},{190,-2.0f},{36,-0.8f},{178,-1.9f},{204,-1.5f},{170,0.5f},{169,0.1f},{195,0.5f},{185,0.1f}}},{172,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{182,-1.2f},{83,-0.9f},{78,0.8f},{102,-0.8f},{227,-1.9f},{203,0.9f},{233,-0.5f},{208,0.5f},{179,-0.3f},{213,-0.8f},{34,0.4f},{188,0.2f}}},{173,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{221,-1.4f},{60,-0.7f},{121,0.8f},{8217,0.3f},{99,-1.7f},{177,0.4f},{194,-0.5f},{58,-1.5f},{181,-0.9f},{225,-1.1f},{218,-0.8f},{105,-0.4f}}},{174,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{208,-1.4f},{111,-0.9f},{164,-1.4f},{104,-2.0f},{51,0.4f},{182,-0.7f},{198,-1.1f},{234,-1.0f},{46,-1.0f},{239,0.3f},{203,-0.3f},{171,0.8f}}},{175,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{36,-1.7f},{174,-2.0f},{212,-1.2f},{208,-0.4f},{250,-0.0f},{91,0.8f},{119,-2.0f},{57,-1.2f},{125,-1.6f},{117,-1.0f},{92,0.9f},{121,-1.0f}}},{176,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{118,-0.3f},{98,0.2f},{193,-1.0f},{223,-1.4f},{85,-1.3f},{174,-0.1f},{185,0.6f},{255,-1.8f},{54,0.2f},{86,0.3f},{200,-0.6f},{76,-1.5f}}},{177,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{37,-1.2f},{215,-1.3f},{229,-0.3f},{181,0.1f},{99,0.5f},{192,-1.5f},{8364,-1.8f},{212,-1.6f},{243,-1.6f},{62,-0.7f},{238,0.7f},{33,-1.7f}}},{178,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{185,-0.8f},{47,-0.0f},{203,-1.6f},{194,0.2f},{217,0.9f},{173,-1.9f},{199,1.0f},{8221,-0.1f},{123,-0.1f},{69,-1.9f},{196,-0.7f},{243,-0.8f}}},{179,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{207,-1.0f},{170,-1.6f},{174,-1.6f},{205,0.3f},{231,0.2f},{209,0.5f},{166,-1.2f},{242,-1.0f},{124,1.0f},{61,-0.0f},{222,-0.1f},{175,-0.8f}}},{180,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{239,0.8f},{101,-1.8f},{51,-0.9f},{50,0.9f},{85,-0.2f},{166,-0.1f},{100,-1.4f},{126,-2.0f},{80,-2.0f},{65,0.3f},{208,-0.0f},{48,0.3f}}},{181,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{83,-0.3f},{125,-1.2f},{74,-1.3f},{68,-0.4f},{249,0.3f},{115,0.5f},{113,0.5f},{73,-1.0f},{231,-1.0f},{8364,0.9f},{77,-1.7f},{108,-0.8f}}},{182,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{247,0.4f},{169,0.8f},{66,-1.2f},{60,-0.2f},{105,-0.0f},{42,-2.0f},{236,-1.8f},{201,0.7f},{167,-1.1f},{212,-1.1f},{122,-0.4f},{99,-0.5f}}},{183,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{160,-1.5f},{219,-0.3f},{199,-0.7f},{220,-0.3f},{217,0.8f},{116,-1.5f},{67,-0.1f},{49,-1.7f},{244,-0.4f},{53,-1.3f},{51,-1.8f},{46,0.2f}}},{184,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{37,-1.4f},{108,-0.2f},{194,-2.0f},{87,-1.2f},{227,0.9f},{97,-1.2f},{58,-1.7f},{174,-1.8f},{112,0.3f},{208,-0.7f},{240,-2.0f},{72,-1.7f}}},{185,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{195,-0.7f},{89,-1.4f},{87,-1.3f},{107,-0.0f},{191,-0.8f},{78,-1.5f},{125,-1.2f},{223,0.5f},{81,-1.1f},{196,-1.0f},{109,-0.8f},{222,0.9f}}},{186,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{194,0.6f},{213,-1.5f},{254,-1.6f},{219,-1.6f},{66,-1.5f},{218,-1.0f},{120,-0.0f},{107,1.0f},{61,0.6f},{90,0.6f},{166,-0.8f},{117,0.2f}}},{187,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{33,0.8f},{168,-1.2f},{36,-1.5f},{231,-1.5f},{8217,-1.1f},{233,0.5f},{184,0.1f},{57,-1.6f},{59,-1.5f},{8220,-0.6f},{109,-0.7f},{204,0.4f}}},{188,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{174,-0.9f},{56,-1.5f},{47,-0.4f},{210,-1.9f},{98,-0.9f},{115,-1.6f},{175,-1.9f},{99,-0.4f},{81,-1.2f},{253,-1.8f},{55,0.3f},{168,-0.8f}}},{189,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{113,-0.9f},{69,-1.4f},{114,1.0f},{226,-1.3f},{199,0.1f},{160,-1.8f},{180,-0.8f},{124,0.7f},{172,-0.1f},{176,0.4f},{249,-1.7f},{205,-1.6f}}},{190,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{229,-0.6f},{35,-0.1f},{94,-0.1f},{109,0.5f},{254,-1.2f},{241,-0.6f},{180,-0.4f},{198,-1.9f},{228,-1.3f},{222,0.5f},{201,0.6f},{246,0.5f}}},{191,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{239,0.3f},{233,-1.3f},{186,0.9f},{8221,-0.4f},{198,-1.1f},{176,-0.0f},{8364,0.3f},{79,-0.3f},{125,-1.7f},{57,-1.5f},{96,-0.4f},{174,-0.9f}}},{192,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{100,-1.6f},{8220,-1.4f},{39,-1.2f},{233,-0.8f},{188,-2.0f},{32,0.7f},{36,-1.9f},{8217,-1.7f},{224,1.0f},{121,-0.5f},{78,-1.4f},{120,-0.9f}}},{193,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{240,0.8f},{254,-2.0f},{89,-1.9f},{189,-1.5f},{234,-0.6f},{182,1.0f},{78,1.0f},{58,0.1f},{43,-1.6f},{111,-0.6f},{220,0.6f},{164,-1.8f}}},{194,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{46,-1.4f},{70,0.5f},{58,-1.3f},{163,-1.4f},{249,-2.0f},{219,-0.9f},{94,-0.4f},{180,-0.2f},{211,0.3f},{110,0.1f},{244,-1.2f},{53,0.6f}}},{195,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{245,-2.0f},{100,-1.9f},{189,0.9f},{209,0.4f},{118,-0.0f},{174,0.8f},{195,-0.0f},{243,0.9f},{72,-0.6f},{55,-1.7f},{81,0.7f},{71,-1.2f}}},{196,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{185,0.8f},{85,-1.0f},{115,-1.6f},{71,-1.8f},{163,0.5f},{248,-0.5f},{234,-1.2f},{95,1.0f},{191,1.0f},{250,-1.2f},{192,0.3f},{49,-0.1f}}},{197,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{188,0.2f},{235,-1.6f},{178,0.2f},{119,0.2f},{80,0.2f},{36,0.2f},{211,-1.9f},{126,-1.7f},{218,-1.2f},{62,0.4f},{114,0.7f},{220,-0.6f}}},{198,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{114,-0.1f},{223,1.0f},{70,0.9f},{175,0.8f},{167,-0.5f},{93,0.4f},{44,0.2f},{122,-2.0f},{77,0.7f},{176,-0.7f},{222,-0.7f},{196,-1.3f}}},{199,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{199,0.4f},{196,-0.2f},{220,-0.9f},{215,0.4f},{242,-1.7f},{95,-0.4f},{43,0.8f},{70,-1.5f},{181,0.7f},{71,-0.2f},{119,0.8f},{92,-1.2f}}},{200,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{248,-1.4f},{8217,0.1f},{103,0.4f},{66,-1.4f},{207,-2.0f},{166,-0.1f},{232,-0.2f},{214,-0.0f},{173,-1.5f},{217,0.9f},{93,0.5f},{198,-0.4f}}},{201,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{68,-0.7f},{239,0.6f},{40,-0.7f},{8220,0.9f},{238,-1.7f},{58,-0.8f},{184,-1.7f},{198,-1.0f},{166,-1.2f},{45,-0.8f},{52,-1.9f},{94,0.7f}}},{202,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8364,-1.5f},{94,1.0f},{45,-1.8f},{36,0.1f},{57,-0.4f},{178,-1.3f},{54,0.4f},{8221,-1.4f},{43,-1.2f},{175,-0.0f},{248,-1.2f},{212,0.2f}}},{203,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{70,-0.5f},{82,-1.2f},{183,-0.2f},{164,-0.7f},{166,0.3f},{120,-0.3f},{237,-0.2f},{245,-1.6f},{96,0.4f},{201,0.8f},{62,-0.9f},{187,0.6f}}},{204,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{169,-1.0f},{189,-1.7f},{201,-1.1f},{34,0.1f},{168,-1.1f},{122,0.8f},{118,-1.5f},{80,-0.6f},{33,-1.3f},{178,0.6f},{64,0.3f},{125,-1.9f}}},{205,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{162,-1.2f},{43,-1.7f},{45,-1.3f},{227,0.9f},{243,0.7f},{177,-1.3f},{111,-1.6f},{70,-2.0f},{248,-1.9f},{247,-1.5f},{221,1.0f},{190,0.6f}}},{206,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{220,-1.3f},{58,-1.9f},{126,-1.1f},{225,1.0f},{218,-1.6f},{48,-0.8f},{60,-1.7f},{212,0.1f},{95,-0.6f},{245,0.1f},{191,0.9f},{46,-1.4f}}},{207,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{57,-0.3f},{248,0.6f},{75,0.5f},{8212,0.1f},{97,0.0f},{68,-1.6f},{83,-1.7f},{85,-1.7f},{192,-1.5f},{92,-0.4f},{224,-1.7f},{175,-1.6f}}},{208,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{39,-0.5f},{160,1.0f},{191,0.8f},{232,-1.7f},{174,-1.3f},{167,0.1f},{113,-0.8f},{233,-1.5f},{122,0.2f},{228,-1.0f},{231,0.8f},{199,-1.2f}}},{209,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{55,-0.5f},{252,-1.9f},{223,-1.6f},{100,-1.1f},{61,0.7f},{86,-1.2f},{208,0.7f},{244,0.2f},{175,0.3f},{189,-1.8f},{192,0.3f},{242,-0.4f}}},{210,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{121,-0.1f},{36,-0.7f},{232,0.4f},{114,0.4f},{249,-0.0f},{244,-0.0f},{87,-1.2f},{73,-0.6f},{194,-1.7f},{169,0.7f},{94,-1.7f},{107,-1.2f}}},{211,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{68,-0.7f},{164,0.7f},{245,-0.2f},{227,0.8f},{103,-0.9f},{52,0.8f},{106,-1.3f},{233,-1.4f},{199,-0.3f},{191,-0.6f},{121,-0.0f},{90,0.5f}}},{212,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{50,-1.0f},{190,-0.3f},{244,-1.9f},{216,-0.8f},{103,-1.2f},{121,-1.7f},{248,-1.5f},{172,-1.3f},{163,-1.2f},{183,-0.8f},{202,-1.6f},{196,0.4f}}},{213,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{167,-1.7f},{240,0.6f},{102,-0.2f},{80,-0.7f},{8364,-0.4f},{226,-1.0f},{53,0.9f},{172,0.2f},{189,-1.2f},{8212,-0.8f},{165,-1.4f},{45,-0.0f}}},{214,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{247,-1.6f},{203,-0.8f},{226,-0.1f},{54,-0.2f},{195,-0.6f},{190,0.6f},{171,-0.9f},{74,-1.9f},{101,-0.9f},{56,-0.2f},{8217,-1.2f},{34,-0.9f}}},{215,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{91,0.8f},{226,-1.8f},{113,-0.2f},{64,0.8f},{254,-1.0f},{90,-2.0f},{243,-1.2f},{87,-0.7f},{228,-0.1f},{8212,-0.5f},{246,-1.3f},{238,1.0f}}},{216,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{74,-0.7f},{109,-1.7f},{165,-0.9f},{80,-0.2f},{188,-1.1f},{49,0.5f},{34,-0.3f},{185,0.2f},{184,-1.2f},{248,-0.5f},{212,-1.1f},{230,0.1f}}},{217,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{223,-0.2f},{97,0.6f},{191,-1.7f},{182,-0.4f},{81,-0.9f},{231,-1.1f},{8217,-0.6f},{61,-0.3f},{167,-1.9f},{55,0.7f},{98,0.5f},{119,0.3f}}},{218,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{36,-1.6f},{174,-1.7f},{220,-1.8f},{76,-0.4f},{99,0.1f},{227,-0.6f},{180,-1.7f},{85,-0.2f},{49,-1.8f},{8364,-1.7f},{77,-1.4f},{81,-0.4f}}},{219,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{211,-1.1f},{110,-1.5f},{75,-0.9f},{192,-0.0f},{168,-0.8f},{117,-0.6f},{199,-0.6f},{189,-1.3f},{240,-1.1f},{170,-1.7f},{8212,-1.8f},{232,-0.9f}}},{220,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{190,-1.9f},{87,-0.4f},{82,-0.9f},{165,-1.4f},{106,-0.4f},{195,-0.1f},{96,-1.3f},{197,-1.0f},{74,0.7f},{252,0.6f},{84,0.1f},{181,-0.8f}}},{221,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8212,-0.0f},{165,0.7f},{93,-1.8f},{78,-2.0f},{214,0.6f},{41,-0.1f},{181,0.3f},{35,0.2f},{216,-1.9f},{122,-0.8f},{231,-0.9f},{45,0.1f}}},{222,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{74,-0.7f},{191,-0.4f},{221,-0.5f},{79,0.9f},{166,-1.6f},{233,0.6f},{77,-0.6f},{51,-1.6f},{117,-0.6f},{82,-1.5f},{72,-1.1f},{161,0.7f}}},{223,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{55,-1.5f},{111,-0.5f},{103,-0.8f},{185,-1.1f},{223,1.0f},{211,-1.8f},{255,-0.4f},{83,-1.5f},{94,0.2f},{64,0.2f},{97,-1.8f},{32,-1.4f}}},{224,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{52,-0.3f},{217,-1.9f},{173,0.3f},{176,-1.4f},{215,-0.3f},{234,-1.3f},{110,0.6f},{46,-1.1f},{53,0.5f},{90,-1.8f},{190,-0.3f},{118,-0.5f}}},{225,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{77,-1.1f},{50,-1.6f},{38,0.1f},{36,0.9f},{48,-0.9f},{63,0.7f},{39,-1.1f},{168,-1.6f},{121,-0.4f},{118,-0.3f},{8220,-1.6f},{226,-0.3f}}},{226,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{80,0.5f},{88,-0.8f},{96,0.0f},{8221,-0.8f},{231,-0.6f},{70,-0.1f},{250,-1.3f},{42,-1.9f},{46,-1.7f},{8220,0.2f},{225,0.6f},{94,0.2f}}},{227,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{171,-0.7f},{113,-0.3f},{200,0.6f},{54,-1.0f},{191,-0.8f},{249,-1.5f},{227,-0.6f},{175,-0.5f},{182,-2.0f},{35,-0.2f},{49,-0.9f},{97,0.4f}}},{228,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{186,-0.4f},{38,-0.9f},{50,-1.6f},{82,-1.6f},{90,-0.5f},{55,-0.2f},{250,-1.3f},{66,0.8f},{91,0.5f},{92,-1.5f},{196,-1.6f},{212,0.7f}}},{229,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{92,0.4f},{254,0.1f},{214,-0.2f},{41,-1.8f},{125,0.7f},{75,0.6f},{51,-0.5f},{93,-1.7f},{47,-0.1f},{68,0.6f},{89,-1.7f},{186,-1.8f}}},{230,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{194,-1.8f},{68,-1.6f},{125,-0.7f},{187,-1.4f},{90,0.5f},{168,-0.4f},{202,-1.3f},{251,0.8f},{203,-1.1f},{227,-2.0f},{225,0.8f},{174,0.8f}}},{231,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{226,-1.9f},{33,-0.1f},{66,-1.7f},{240,0.7f},{193,-0.9f},{108,-1.6f},{243,-0.8f},{114,-0.5f},{244,-1.0f},{113,0.8f},{70,-1.0f},{233,-1.4f}}},{232,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{172,0.5f},{102,-0.1f},{119,0.1f},{218,0.1f},{90,-0.6f},{245,0.2f},{212,-0.3f},{246,-1.0f},{116,-0.4f},{214,-2.0f},{38,1.0f},{114,-1.3f}}},{233,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{178,-0.1f},{242,0.2f},{215,0.3f},{219,-1.6f},{177,-1.0f},{168,0.7f},{90,-1.2f},{123,0.6f},{217,-1.0f},{80,-0.6f},{125,-1.0f},{208,-0.7f}}},{234,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{168,-0.7f},{184,-1.2f},{254,-0.6f},{88,0.4f},{91,-0.5f},{236,0.8f},{173,0.6f},{54,-1.7f},{245,-0.5f},{85,-1.5f},{108,-0.7f},{115,-1.2f}}},{235,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{115,-0.2f},{73,-0.3f},{53,-1.9f},{105,0.1f},{173,-0.9f},{58,0.1f},{211,0.3f},{125,0.2f},{166,-1.1f},{117,-1.2f},{237,-0.6f},{120,0.5f}}},{236,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{55,0.2f},{210,-1.5f},{174,-1.9f},{89,0.2f},{103,0.3f},{238,-0.9f},{251,0.8f},{187,-1.3f},{59,-0.0f},{93,-0.0f},{34,0.4f},{49,0.7f}}},{237,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{210,-0.9f},{225,-0.9f},{215,-0.6f},{54,-1.1f},{243,-1.4f},{36,-0.5f},{202,-1.1f},{114,-1.3f},{201,-0.1f},{236,-0.8f},{220,-1.3f},{248,-0.3f}}},{238,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{174,0.5f},{110,-0.1f},{176,-0.5f},{63,-0.5f},{91,-1.7f},{42,-0.5f},{202,-0.6f},{8217,-0.5f},{81,-0.2f},{87,-0.0f},{196,-1.0f},{195,-1.7f}}},{239,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{185,-0.9f},{172,-1.3f},{248,0.0f},{53,0.5f},{43,-0.4f},{193,0.4f},{191,-1.9f},{232,0.9f},{182,-1.7f},{59,-0.0f},{93,-0.6f},{82,-0.6f}}},{240,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{91,0.4f},{62,-0.2f},{164,-1.9f},{46,-0.3f},{124,-0.7f},{245,-1.2f},{229,-1.3f},{228,-0.9f},{71,0.1f},{210,0.5f},{36,0.7f},{61,-1.7f}}},{241,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{94,-0.5f},{42,0.1f},{187,0.8f},{214,-1.7f},{91,-1.8f},{117,0.7f},{54,-0.6f},{125,-1.3f},{248,0.5f},{227,-0.7f},{40,0.2f},{100,-1.9f}}},{242,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{48,1.0f},{68,-0.5f},{185,-0.7f},{122,0.0f},{37,-0.7f},{222,0.1f},{177,0.9f},{186,0.7f},{229,-0.1f},{192,-1.8f},{73,-1.4f},{241,-1.0f}}},{243,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{236,-0.6f},{88,0.1f},{105,-0.2f},{240,0.2f},{186,-0.9f},{199,0.2f},{108,0.3f},{175,-1.4f},{174,0.6f},{112,0.4f},{247,0.9f},{226,-0.7f}}},{244,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{207,-0.1f},{253,-1.2f},{211,-1.5f},{35,-0.4f},{170,0.8f},{111,-0.6f},{89,0.9f},{225,0.4f},{54,-0.7f},{182,0.2f},{194,-1.2f},{201,-0.1f}}},{245,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{97,-1.3f},{8364,-0.1f},{65,-1.3f},{45,0.2f},{227,-1.3f},{228,0.2f},{66,-1.7f},{229,-0.3f},{8212,-0.2f},{162,-1.0f},{244,-0.1f},{120,-0.6f}}},{246,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{125,0.6f},{8217,-0.6f},{117,-1.9f},{46,-0.7f},{244,-1.0f},{192,-1.0f},{160,-1.4f},{77,0.3f},{234,-0.6f},{240,-0.9f},{87,-0.5f},{114,-0.7f}}},{247,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{179,-0.1f},{167,-1.9f},{45,0.3f},{67,1.0f},{168,-2.0f},{98,-0.2f},{198,1.0f},{113,-0.4f},{123,-1.8f},{34,0.7f},{114,-0.8f},{89,0.2f}}},{248,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{40,0.8f},{246,-0.0f},{65,0.6f},{188,-0.0f},{208,-0.4f},{209,0.3f},{244,-1.1f},{56,-0.5f},{190,-0.9f},{94,1.0f},{66,-0.5f},{202,-1.1f}}},{249,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{205,0.9f},{173,-0.7f},{250,0.6f},{221,-1.8f},{41,0.7f},{220,0.0f},{164,-0.0f},{188,0.3f},{53,0.7f},{44,0.5f},{100,0.8f},{71,0.9f}}},{250,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{83,-0.0f},{96,-1.4f},{214,0.5f},{36,-0.5f},{64,-0.3f},{215,-0.1f},{199,0.7f},{175,-0.5f},{160,-1.7f},{54,-0.7f},{193,-1.8f},{35,0.8f}}},{251,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{234,-0.2f},{125,0.1f},{203,-1.1f},{161,-1.1f},{58,-1.8f},{72,-0.3f},{101,-1.1f},{168,0.3f},{196,-1.4f},{163,-0.5f},{209,-1.1f},{165,-1.9f}}},{252,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{69,-0.7f},{57,0.2f},{201,-0.1f},{171,0.1f},{70,-1.7f},{83,-1.8f},{91,-1.2f},{183,-1.7f},{8212,-1.6f},{115,0.2f},{40,0.0f},{38,-0.4f}}},{253,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{192,0.2f},{194,0.0f},{254,-0.2f},{57,-1.5f},{41,-0.5f},{88,0.9f},{47,-1.3f},{72,-0.1f},{73,-1.7f},{69,0.8f},{187,0.0f},{123,0.8f}}},{254,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{212,-1.5f},{35,-1.4f},{88,0.5f},{122,-1.8f},{187,-0.7f},{201,-1.3f},{54,0.4f},{78,-1.8f},{242,0.1f},{205,-1.4f},{118,-0.6f},{101,0.7f}}},{255,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{8220,-0.4f},{248,-1.8f},{56,-0.8f},{193,0.8f},{112,0.7f},{239,-1.6f},{47,-0.8f},{45,-0.5f},{66,-0.4f},{8212,0.1f},{253,-2.0f},{190,-1.6f}}},{8364,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{192,0.7f},{244,-0.5f},{248,-1.2f},{8221,-1.9f},{8220,0.9f},{238,0.8f},{188,-1.8f},{196,-0.6f},{212,-1.2f},{99,0.5f},{41,1.0f},{125,0.5f}}},{8212,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{215,0.1f},{242,-1.3f},{94,-1.3f},{87,-0.4f},{207,0.0f},{222,-0.7f},{85,0.1f},{195,-0.7f},{202,-0.3f},{112,0.6f},{39,-1.9f},{243,0.9f}}},{8217,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{105,-1.0f},{219,-0.1f},{244,-0.2f},{55,-0.7f},{98,-2.0f},{54,-0.5f},{90,-1.8f},{200,0.3f},{232,-1.9f},{115,-0.5f},{199,0.2f},{99,0.7f}}},{8220,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{254,-0.2f},{83,0.8f},{126,-0.9f},{249,0.9f},{81,0.1f},{168,-1.4f},{248,0.8f},{97,-0.4f},{62,-0.9f},{219,0.7f},{116,-1.5f},{114,-0.8f}}},{8221,10,12,1,11,9.5f,0,0,0,0,0,0.1f,0.2f,0.3f,0.4f,12,{{52,-0.1f},{96,-1.0f},{201,0.5f},{86,0.3f},{198,0.7f},{190,0.5f},{8217,-1.3f},{103,-0.7f},{211,0.4f},{50,-0.9f},{116,-1.9f},{85,-0.2f}}} } };
+TextureFont* fonts[NUM_FONTS] = { &font0,&font1,&font2,&font3 };
@@ -0,0 +1,10 @@
+// Signed distance field font atlas generated by spFontSDF from font.h.
+// Do not edit, regenerate it with: spFontSDF fontSDF.h 4 4
+
+#define FONT_SDF_WIDTH  1
+#define FONT_SDF_HEIGHT 1
+#define FONT_SDF_SPREAD 4
+
+static const unsigned char fontSDFData[FONT_SDF_WIDTH * FONT_SDF_HEIGHT] = {
+    0,
+};
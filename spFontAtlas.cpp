@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  spFontAtlas.cpp
+//  spReticle
+//
+
+/*
+ * @file  spFontAtlas.cpp
+ * Converts the fonts compiled from font.h, along with the distance field
+ * atlas generated by spFontSDF, into a binary font atlas file (see
+ * FontAtlas.h). Point the SPRETICLE_FONT_ATLAS environment variable at the
+ * file to use it without rebuilding the plugin.
+ *
+ * Usage: spFontAtlas output.spfont
+ */
+
+#include <iostream>
+
+#include "FontAtlas.h"
+
+int main(int argc, char **argv)
+{
+    if (argc != 2)
+    {
+        std::cerr << "usage: " << argv[0] << " output.spfont" << std::endl;
+        return 1;
+    }
+
+    FontAtlas atlas;
+    atlas.loadBuiltin();
+
+    if (!atlas.write(argv[1]))
+    {
+        std::cerr << "unable to write " << argv[1] << std::endl;
+        return 1;
+    }
+
+    // Make sure the plugin will accept the file
+    FontAtlas check;
+    if (!check.load(argv[1]) || check.numGlyphs() != atlas.numGlyphs())
+    {
+        std::cerr << "unable to read back " << argv[1] << std::endl;
+        return 1;
+    }
+
+    std::cout << argv[1] << ": " << atlas.numFonts() << " fonts, "
+              << atlas.numGlyphs() << " glyphs, "
+              << atlas.width() << "x" << atlas.height() << " atlas" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,250 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  spFontBench.cpp
+//  spReticle
+//
+
+/*
+ * @file  spFontBench.cpp
+ * Times the glyph and kerning lookups of FontAtlas on typical burn-in
+ * strings against the std::map lookup and linear kerning scan they
+ * replaced, after checking that both give the same glyphs and kerning.
+ *
+ * Usage: spFontBench [atlas.spfont] [iterations]
+ *
+ * The fonts compiled from font.h are used when no atlas file is given.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <wchar.h>
+
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "FontAtlas.h"
+
+// Burn-in text as the reticle draws it: shot and version, frame counters,
+// lens and camera data, dates, plus a few Latin-1 and wide characters that
+// go through the hash table.
+static const wchar_t *burnInText[] = {
+    L"aa010_0010_comp_v003",
+    L"1001 / 1087  [87]",
+    L"24.000 fps  2.39:1",
+    L"35mm  f/2.8  ISO 800",
+    L"Tue Oct 18 14:22:07 2026",
+    L"artist: jdoe  dept: lighting",
+    L"TC 01:00:04:17",
+    L"\u00C4rger \u00DCber Stra\u00DFe",
+    L"R\u00E9sum\u00E9 caf\u00E9 na\u00EFve",
+    L"\u20AC 1.250,00 \u2014 \u00B10.5\u00B0"
+};
+
+static const int numBurnInText = sizeof(burnInText) / sizeof(burnInText[0]);
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// The lookups of the previous FontAtlas: one std::map per font and a linear
+// scan over the kerning pairs of the glyph.
+class MapLookup
+{
+public:
+    MapLookup(const FontAtlas &atlas) : atlas(atlas), maps(atlas.numFonts())
+    {
+        for (unsigned int i = 0; i < atlas.numFonts(); i++)
+        {
+            const FontFileFont &font = atlas.font(i);
+            for (unsigned int j = 0; j < font.numGlyphs; j++)
+            {
+                const FontFileGlyph *glyph = &atlas.glyph(font.firstGlyph + j);
+                maps[i][glyph->charcode] = glyph;
+            }
+        }
+    }
+
+    const FontFileGlyph *findGlyph(int font, wchar_t c) const
+    {
+        GlyphMap::const_iterator it = maps[font].find((unsigned int)c);
+        return (it == maps[font].end()) ? NULL : it->second;
+    }
+
+    float kerning(const FontFileGlyph *glyph, wchar_t previous) const
+    {
+        for (unsigned int i = 0; i < glyph->numKerning; i++)
+        {
+            const FontFileKerning &k = atlas.kerningPair(glyph->firstKerning + i);
+            if (k.charcode == (unsigned int)previous)
+                return k.kerning;
+        }
+        return 0.0f;
+    }
+
+private:
+    typedef std::map<unsigned int, const FontFileGlyph *> GlyphMap;
+
+    const FontAtlas       &atlas;
+    std::vector<GlyphMap> maps;
+};
+
+// Lay out every string in every font as drawText does, adding up the
+// advances and kerning so that the lookups cannot be optimized away.
+template <class Lookup>
+static double layout(const Lookup &lookup, unsigned int numFonts, int iterations, size_t &numChars)
+{
+    double width = 0.0;
+    numChars = 0;
+
+    for (int it = 0; it < iterations; it++)
+    {
+        for (unsigned int font = 0; font < numFonts; font++)
+        {
+            for (int s = 0; s < numBurnInText; s++)
+            {
+                wchar_t previous = 0;
+                for (const wchar_t *c = burnInText[s]; *c; c++)
+                {
+                    const FontFileGlyph *glyph = lookup.findGlyph(font, *c);
+                    numChars++;
+                    if (!glyph)
+                        continue;
+
+                    if (previous)
+                        width += lookup.kerning(glyph, previous);
+                    width += glyph->advance_x;
+                    previous = *c;
+                }
+            }
+        }
+    }
+
+    return width;
+}
+
+// Every glyph and kerning pair of the strings must match
+static bool check(const FontAtlas &atlas, const MapLookup &old)
+{
+    for (unsigned int font = 0; font < atlas.numFonts(); font++)
+    {
+        for (int s = 0; s < numBurnInText; s++)
+        {
+            wchar_t previous = 0;
+            for (const wchar_t *c = burnInText[s]; *c; c++)
+            {
+                const FontFileGlyph *glyph = atlas.findGlyph(font, *c);
+                if (glyph != old.findGlyph(font, *c))
+                {
+                    std::cerr << "glyph mismatch for character " << (unsigned int)*c
+                              << " in font " << font << std::endl;
+                    return false;
+                }
+
+                if (glyph && previous && atlas.kerning(glyph, previous) != old.kerning(glyph, previous))
+                {
+                    std::cerr << "kerning mismatch for characters " << (unsigned int)previous
+                              << ", " << (unsigned int)*c << " in font " << font << std::endl;
+                    return false;
+                }
+
+                previous = *c;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 3)
+    {
+        std::cerr << "usage: " << argv[0] << " [atlas.spfont] [iterations]" << std::endl;
+        return 1;
+    }
+
+    FontAtlas atlas;
+    if (argc > 1)
+    {
+        if (!atlas.load(argv[1]))
+        {
+            std::cerr << "unable to read " << argv[1] << std::endl;
+            return 1;
+        }
+    }
+    else
+        atlas.loadBuiltin();
+
+    int iterations = (argc > 2) ? atoi(argv[2]) : 20000;
+    if (iterations <= 0)
+        iterations = 1;
+
+    double start = now();
+    MapLookup old(atlas);
+    double buildTime = now() - start;
+
+    if (!check(atlas, old))
+        return 1;
+
+    size_t numChars = 0;
+
+    start = now();
+    double oldWidth = layout(old, atlas.numFonts(), iterations, numChars);
+    double oldTime = now() - start;
+
+    start = now();
+    double newWidth = layout(atlas, atlas.numFonts(), iterations, numChars);
+    double newTime = now() - start;
+
+    if (oldWidth != newWidth)
+    {
+        std::cerr << "layout mismatch: " << oldWidth << " != " << newWidth << std::endl;
+        return 1;
+    }
+
+    printf("%u fonts, %u glyphs, %u kerning pairs, %lu characters looked up\n",
+           atlas.numFonts(), atlas.numGlyphs(), atlas.numKerning(), (unsigned long)numChars);
+    printf("map build         %10.3f ms\n", buildTime * 1e3);
+    printf("map + kerning scan %9.2f ns/char\n", oldTime / numChars * 1e9);
+    printf("tables            %10.2f ns/char\n", newTime / numChars * 1e9);
+    printf("speedup           %10.2fx\n", newTime > 0.0 ? oldTime / newTime : 0.0);
+
+    return 0;
+}
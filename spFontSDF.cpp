@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  spFontSDF.cpp
+//  spReticle
+//
+
+/*
+ * @file  spFontSDF.cpp
+ * Generates the signed distance field font atlas used by the OpenGL text
+ * shader from the alpha texture atlas in font.h, so the atlas can be
+ * regenerated without freetype-gl.
+ *
+ * The exact euclidean distance to the glyph outlines is computed on the full
+ * resolution atlas, then averaged down by the downsample factor. Texels are
+ * 128 on the outlines, larger inside the glyphs, and saturate at a distance
+ * of spread output texels. The glyph texture coordinates of font.h are
+ * normalized, so they are valid for the smaller atlas as well.
+ *
+ * Usage: spFontSDF output.h [downsample [spread]]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "defines.h"
+#include "font.h"
+
+static const float INF = 1e20f;
+
+// One dimensional squared distance transform of the sampled function f
+// (Felzenszwalb and Huttenlocher, "Distance Transforms of Sampled Functions").
+//
+static void distanceTransform1D(const float *f, int n, float *d, int *v, float *z)
+{
+    int k = 0;
+    v[0] = 0;
+    z[0] = -INF;
+    z[1] = INF;
+
+    for (int q = 1; q < n; q++)
+    {
+        float s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k])) / (2*q - 2*v[k]);
+        while (s <= z[k])
+        {
+            k--;
+            s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k])) / (2*q - 2*v[k]);
+        }
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k+1] = INF;
+    }
+
+    k = 0;
+    for (int q = 0; q < n; q++)
+    {
+        while (z[k+1] < q)
+            k++;
+        d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+    }
+}
+
+// Squared distance of every pixel to the nearest pixel whose inside state is
+// the given one.
+//
+static void distanceTransform(const std::vector<bool> &inside, bool seed,
+                              int width, int height, std::vector<float> &dist)
+{
+    int n = std::max(width, height);
+    std::vector<float> f(n), d(n), z(n + 1);
+    std::vector<int> v(n);
+
+    dist.resize(width * height);
+    for (int i = 0; i < width * height; i++)
+        dist[i] = (inside[i] == seed) ? 0.0f : INF;
+
+    for (int x = 0; x < width; x++)
+    {
+        for (int y = 0; y < height; y++)
+            f[y] = dist[y * width + x];
+        distanceTransform1D(&f[0], height, &d[0], &v[0], &z[0]);
+        for (int y = 0; y < height; y++)
+            dist[y * width + x] = d[y];
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        distanceTransform1D(&dist[y * width], width, &d[0], &v[0], &z[0]);
+        std::copy(d.begin(), d.begin() + width, dist.begin() + y * width);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2 || argc > 4)
+    {
+        std::cerr << "usage: " << argv[0] << " output.h [downsample [spread]]" << std::endl;
+        return 1;
+    }
+
+    int downsample = (argc > 2) ? atoi(argv[2]) : SDF_DOWNSAMPLE;
+    int spread     = (argc > 3) ? atoi(argv[3]) : SDF_SPREAD;
+    if (downsample < 1 || spread < 1)
+    {
+        std::cerr << "downsample and spread must be positive" << std::endl;
+        return 1;
+    }
+
+    int width  = int(fontAtlas.width);
+    int height = int(fontAtlas.height);
+    int depth  = int(fontAtlas.depth);
+
+    // Alpha is the last channel of every texel
+    std::vector<bool> inside(width * height);
+    for (int i = 0; i < width * height; i++)
+        inside[i] = fontAtlas.data[i * depth + depth - 1] >= 128;
+
+    std::vector<float> distIn, distOut;
+    distanceTransform(inside, false, width, height, distIn);
+    distanceTransform(inside, true, width, height, distOut);
+
+    int sdfWidth  = (width  + downsample - 1) / downsample;
+    int sdfHeight = (height + downsample - 1) / downsample;
+    float scale = 0.5f / (spread * downsample);
+
+    std::vector<unsigned char> sdf(sdfWidth * sdfHeight);
+    for (int sy = 0; sy < sdfHeight; sy++)
+    {
+        for (int sx = 0; sx < sdfWidth; sx++)
+        {
+            // Average the signed distance over the block of source pixels
+            float sum = 0.0f;
+            int count = 0;
+            for (int y = sy * downsample; y < std::min(height, (sy + 1) * downsample); y++)
+            {
+                for (int x = sx * downsample; x < std::min(width, (sx + 1) * downsample); x++)
+                {
+                    int i = y * width + x;
+                    sum += sqrtf(distIn[i]) - sqrtf(distOut[i]);
+                    count++;
+                }
+            }
+
+            float value = 0.5f + (sum / count) * scale;
+            value = std::max(0.0f, std::min(1.0f, value));
+            sdf[sy * sdfWidth + sx] = (unsigned char) (value * 255.0f + 0.5f);
+        }
+    }
+
+    FILE *out = fopen(argv[1], "w");
+    if (!out)
+    {
+        std::cerr << "unable to open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    fprintf(out, "// Signed distance field font atlas generated by spFontSDF from font.h.\n");
+    fprintf(out, "// Do not edit, regenerate it with: spFontSDF %s %d %d\n\n", argv[1], downsample, spread);
+    fprintf(out, "#define FONT_SDF_WIDTH  %d\n", sdfWidth);
+    fprintf(out, "#define FONT_SDF_HEIGHT %d\n", sdfHeight);
+    fprintf(out, "#define FONT_SDF_SPREAD %d\n\n", spread);
+    fprintf(out, "static const unsigned char fontSDFData[FONT_SDF_WIDTH * FONT_SDF_HEIGHT] = {");
+    for (size_t i = 0; i < sdf.size(); i++)
+        fprintf(out, "%s%d,", (i % 24) ? "" : "\n    ", sdf[i]);
+    fprintf(out, "\n};\n");
+
+    if (fclose(out) != 0)
+    {
+        std::cerr << "unable to write " << argv[1] << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -79,6 +79,14 @@
 #include <maya/MFileIO.h>
 #include <maya/MFileObject.h>
 #include <maya/MFnMessageAttribute.h>
+#include <maya/MFnDagNode.h>
+#include <maya/MPxCommand.h>
+#include <maya/MArgList.h>
+#include <maya/MSelectionList.h>
+#include <maya/MNodeMessage.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MAnimControl.h>
+#include <maya/MImage.h>
 
 #if (MAYA_API_VERSION>=201200)
 // Viewport 2.0 includes
@@ -90,6 +98,17 @@
 #include <maya/MSelectionList.h>
 #endif
 
+#if (MAYA_API_VERSION>=201700)
+#include <maya/MPxSubSceneOverride.h>
+#include <maya/MViewport2Renderer.h>
+#include <maya/MShaderManager.h>
+#include <maya/MHWGeometry.h>
+#include <maya/MFrameContext.h>
+#include <maya/MUIDrawManager.h>
+#include <maya/MBoundingBox.h>
+#include <maya/MPoint.h>
+#endif
+
 #include "spReticleLoc.h"
 
 #define McheckStatus(stat,msg)  \
@@ -105,8 +124,11 @@
     }
 
 MTypeId spReticleLoc::id( 0x00000502 );
+bool    spReticleLoc::scriptTextEnabled = false;
 
 #if (MAYA_API_VERSION>=201200)
+	// Set to the sub-scene classification by initializePlugin when the
+	// subScene backend is used
 	MString	spReticleLoc::drawDbClassification("drawdb/geometry/spReticleLoc");
 	MString	spReticleLoc::drawRegistrantId("spReticleLoc");
 #endif
@@ -176,10 +198,15 @@ MObject spReticleLoc::MiscTextColor;
 MObject spReticleLoc::MiscTextTrans;
 MObject spReticleLoc::LineColor;
 MObject spReticleLoc::LineTrans;
+MObject spReticleLoc::LineWidth;
+MObject spReticleLoc::DisplayStats;
 MObject spReticleLoc::Time;
+MObject spReticleLoc::ConfigVersion;
+MObject spReticleLoc::OutTime;
 MObject spReticleLoc::DriveCameraAperture;
 MObject spReticleLoc::MaximumDistance;
 MObject spReticleLoc::UseOverscan;
+MObject spReticleLoc::ShotMetadataFile;
 MObject spReticleLoc::Pad;
 MObject spReticleLoc::UsePad;
 MObject spReticleLoc::PadAmount;
@@ -207,38 +234,30 @@ MObject spReticleLoc::TextEnabled;
 MObject spReticleLoc::TextBold;
 MObject spReticleLoc::TextSize;
 MObject spReticleLoc::TextScale;
+MObject spReticleLoc::TextSource;
 MObject spReticleLoc::Tag;
 
 spReticleLoc::spReticleLoc() {}
-spReticleLoc::~spReticleLoc() {}
 
-// This method will retrieve the individual r,g,b and alpha values from
-// various plugs and store them in an MColor object.
-//
-MStatus spReticleLoc::getColor(MObject colorObj, MObject transObj, MColor & color)
+spReticleLoc::~spReticleLoc()
 {
-    MPlug p,c;
-    MStatus stat;
-
-    p = MPlug( thisNode, colorObj );
-
-    // Get red
-    c = p.child(0, &stat);
-    McheckStatus (stat, ("spReticleLoc::getColor getting red plug from "+p.name() ) );
-    McheckStatus ( c.getValue ( color.r  ), ("spReticleLoc::getColor getting red from "+p.name() ) );
+    MMessage::removeCallback(nodeCallback);
 
-    // Get green
-    c = p.child(1,&stat);
-    McheckStatus (stat, ("spReticleLoc::getColor getting green plug from "+p.name() ) );
-    McheckStatus ( c.getValue ( color.g  ), ("spReticleLoc::getColor getting green from "+p.name() ) );
+    for (size_t i = 0; i < cameraVisibility.size(); i++)
+        MMessage::removeCallback(cameraVisibility[i].callback);
+}
 
-    // Get blue
-    c = p.child(2, &stat);
-    McheckStatus (stat, ("spReticleLoc::getColor getting blue plug from "+p.name() ) );
-    McheckStatus ( c.getValue ( color.b  ), ("spReticleLoc::getColor getting blue from "+p.name() ) );
+// This method will retrieve the individual r,g,b and alpha values from
+// a color and a transparency data handle and store them in an MColor object.
+//
+MStatus spReticleLoc::getColor(MDataHandle colorHandle, MDataHandle transHandle, MColor & color)
+{
+    const float3 & c = colorHandle.asFloat3();
 
-    p = MPlug( thisNode, transObj );
-    McheckStatus ( p.getValue ( color.a ), ("spReticleLoc::getColor gettings transparency from "+p.name() ) );
+    color.r = c[0];
+    color.g = c[1];
+    color.b = c[2];
+    color.a = transHandle.asFloat();
 
     return MS::kSuccess;
 }
@@ -361,6 +380,8 @@ void spReticleLoc::printGeom(Geom & g)
 //
 void spReticleLoc::printOptions()
 {
+    Options &options = settings.options;
+
     cerr << "-------------------------------------------------" << endl;
     cerr << "cameraFilterMode   : " << options.cameraFilterMode << endl;
     cerr << "displayLineH        : " << options.displayLineH << endl;
@@ -372,26 +393,28 @@ void spReticleLoc::printOptions()
     cerr << "driveCameraAperture : " << options.driveCameraAperture << endl;
     cerr << "maximumDistance     : " << options.maximumDistance << endl;
     cerr << "useOverscan         : " << options.useOverscan << endl;
+    cerr << "lineWidth           : " << options.lineWidth << endl;
+    cerr << "displayStats        : " << options.displayStats << endl;
 }
 
 // This method gets the pad data.
 //
-MStatus spReticleLoc::getPadData()
+MStatus spReticleLoc::getPadData(MDataBlock & data)
 {
-    MPlug p;
     MStatus stat;
+    PadOptions &pad = settings.pad;
 
     // Get the pad attribute;
-    p = MPlug ( thisNode, UsePad );
-    McheckStatus ( p.getValue ( pad.usePad ), "spReticleLoc::getPadData pad");
+    pad.usePad = data.inputValue( UsePad, &stat ).asBool();
+    McheckStatus ( stat, "spReticleLoc::getPadData pad");
 
     // Get the padAmountX attribute;
-    p = MPlug ( thisNode, PadAmountX );
-    McheckStatus ( p.getValue ( pad.padAmountX  ), "spReticleLoc::getPadData padAmountX");
+    pad.padAmountX = data.inputValue( PadAmountX, &stat ).asFloat();
+    McheckStatus ( stat, "spReticleLoc::getPadData padAmountX");
 
     // Get the padAmountY attribute;
-    p = MPlug ( thisNode, PadAmountY );
-    McheckStatus ( p.getValue ( pad.padAmountY  ), "spReticleLoc::getPadData padAmountX");
+    pad.padAmountY = data.inputValue( PadAmountY, &stat ).asFloat();
+    McheckStatus ( stat, "spReticleLoc::getPadData padAmountY");
 
     // Set whether the filmback is padded
     pad.isPadded = (pad.padAmountX > EPSILON || pad.padAmountY > EPSILON );
@@ -399,15 +422,15 @@ MStatus spReticleLoc::getPadData()
     if (pad.usePad && pad.isPadded)
     {
         // Get the pad display mode
-        p = MPlug ( thisNode, PadDisplayMode );
-        McheckStatus ( p.getValue ( pad.displayMode ), "spReticleLoc::getPadData padDisplayMode");
+        pad.displayMode = data.inputValue( PadDisplayMode, &stat ).asShort();
+        McheckStatus ( stat, "spReticleLoc::getPadData padDisplayMode");
 
         // Get the pad mask color
-        stat = getColor( PadMaskColor, PadMaskTrans, pad.padGeom.maskColor );
+        stat = getColor( data.inputValue( PadMaskColor ), data.inputValue( PadMaskTrans ), pad.padGeom.maskColor );
         McheckStatus ( stat, "spReticleLoc::getPadData get padMaskColor");
 
         // Get the pad line color
-        stat = getColor( PadLineColor, PadLineTrans, pad.padGeom.lineColor );
+        stat = getColor( data.inputValue( PadLineColor ), data.inputValue( PadLineTrans ), pad.padGeom.lineColor );
         McheckStatus ( stat, "spReticleLoc::getPadData get padLineColor");
     }
     else
@@ -422,37 +445,37 @@ MStatus spReticleLoc::getPadData()
 // This method retrieves all of the data related to the filmback from
 // various plugs.
 //
-MStatus spReticleLoc::getFilmbackData()
+MStatus spReticleLoc::getFilmbackData(MDataBlock & data)
 {
-    MPlug p;
     MStatus stat;
+    Filmback &filmback = settings.filmback;
 
     //Get horizontal film aperture
-    p = MPlug( thisNode, HorizontalFilmAperture );
-    McheckStatus ( p.getValue ( filmback.horizontalFilmAperture  ), "spReticleLoc::getFilmbackData get horizontalFilmAperture");
+    filmback.horizontalFilmAperture = data.inputValue( HorizontalFilmAperture, &stat ).asFloat();
+    McheckStatus ( stat, "spReticleLoc::getFilmbackData get horizontalFilmAperture");
 
     //Get vertical film aperture
-    p = MPlug( thisNode, VerticalFilmAperture );
-    McheckStatus ( p.getValue ( filmback.verticalFilmAperture  ), "spReticleLoc::getFilmbackData get verticalFilmAperture");
+    filmback.verticalFilmAperture = data.inputValue( VerticalFilmAperture, &stat ).asFloat();
+    McheckStatus ( stat, "spReticleLoc::getFilmbackData get verticalFilmAperture");
 
     //Get whether the film aperture is relative or absolute
-    p = MPlug( thisNode, RelativeFilmback );
-    McheckStatus ( p.getValue ( filmback.relativeFilmback  ), "spReticleLoc::getFilmbackData get relativeFilmback");
+    filmback.relativeFilmback = data.inputValue( RelativeFilmback, &stat ).asBool();
+    McheckStatus ( stat, "spReticleLoc::getFilmbackData get relativeFilmback");
 
     //Get sound track width
-    p = MPlug( thisNode, SoundTrackWidth );
-    McheckStatus ( p.getValue ( filmback.soundTrackWidth  ), "spReticleLoc::getFilmbackData get soundTrackWidth");
+    filmback.soundTrackWidth = data.inputValue( SoundTrackWidth, &stat ).asFloat();
+    McheckStatus ( stat, "spReticleLoc::getFilmbackData get soundTrackWidth");
 
     //Get whether to display the film gate
-    p = MPlug( thisNode, DisplayFilmGate );
-    McheckStatus ( p.getValue ( filmback.displayFilmGate  ), "spReticleLoc::getFilmbackData get displayFilmGate");
+    filmback.displayFilmGate = data.inputValue( DisplayFilmGate, &stat ).asShort();
+    McheckStatus ( stat, "spReticleLoc::getFilmbackData get displayFilmGate");
     
     //Get the filmback mask color
-    stat = getColor( FilmGateMaskColor, FilmGateMaskTrans, filmback.filmbackGeom.maskColor );
+    stat = getColor( data.inputValue( FilmGateMaskColor ), data.inputValue( FilmGateMaskTrans ), filmback.filmbackGeom.maskColor );
     McheckStatus ( stat, "spReticleLoc::getFilmbackData get filmGateMaskColor");
     
     //Get the filmback line color
-    stat = getColor( FilmGateLineColor, FilmGateLineTrans, filmback.filmbackGeom.lineColor );
+    stat = getColor( data.inputValue( FilmGateLineColor ), data.inputValue( FilmGateLineTrans ), filmback.filmbackGeom.lineColor );
     McheckStatus ( stat, "spReticleLoc::getFilmbackData get filmGateLineColor");
 
     return MS::kSuccess;
@@ -462,31 +485,31 @@ MStatus spReticleLoc::getFilmbackData()
 // various plugs and then calls calcProjGeom to calculate the various
 // projection geometry instances.
 //
-MStatus spReticleLoc::getProjectionData()
+MStatus spReticleLoc::getProjectionData(MDataBlock & data)
 {
-    MPlug p;
     MStatus stat;
+    Filmback &filmback = settings.filmback;
 
     //Get whether to display the projection gate
-    p = MPlug( thisNode, DisplayProjectionGate );
-    McheckStatus ( p.getValue ( filmback.displayProjGate  ), "spReticleLoc::getProjectionData get displayProjectionGate");
+    filmback.displayProjGate = data.inputValue( DisplayProjectionGate, &stat ).asShort();
+    McheckStatus ( stat, "spReticleLoc::getProjectionData get displayProjectionGate");
 
     if ( filmback.displayProjGate )
     {
         //Get horizontal projection gate
-        p = MPlug( thisNode, HorizontalProjectionGate );
-        McheckStatus ( p.getValue ( filmback.horizontalProjectionGate  ), "spReticleLoc::getProjectionData get horizontalProjectionGate");
+        filmback.horizontalProjectionGate = data.inputValue( HorizontalProjectionGate, &stat ).asFloat();
+        McheckStatus ( stat, "spReticleLoc::getProjectionData get horizontalProjectionGate");
 
         //Get vertical projection gate
-        p = MPlug( thisNode, VerticalProjectionGate );
-        McheckStatus ( p.getValue ( filmback.verticalProjectionGate  ), "spReticleLoc::getProjectionData get verticalProjectionGate");
+        filmback.verticalProjectionGate = data.inputValue( VerticalProjectionGate, &stat ).asFloat();
+        McheckStatus ( stat, "spReticleLoc::getProjectionData get verticalProjectionGate");
 
         //Get the projection gate mask color
-        stat = getColor( ProjGateMaskColor, ProjGateMaskTrans, filmback.projGeom.maskColor );
+        stat = getColor( data.inputValue( ProjGateMaskColor ), data.inputValue( ProjGateMaskTrans ), filmback.projGeom.maskColor );
         McheckStatus ( stat, "spReticleLoc::getProjectionData get projGateMaskColor");
 
         //Get the projection gate line color
-        stat = getColor( ProjGateLineColor, ProjGateLineTrans, filmback.projGeom.lineColor );
+        stat = getColor( data.inputValue( ProjGateLineColor ), data.inputValue( ProjGateLineTrans ), filmback.projGeom.lineColor );
         McheckStatus ( stat, "spReticleLoc::getProjectionData get projGateLineColor");
     }
 
@@ -495,21 +518,22 @@ MStatus spReticleLoc::getProjectionData()
 
 // This method returns the data related to the filmback's safe action area.
 //
-MStatus spReticleLoc::getSafeActionData()
+MStatus spReticleLoc::getSafeActionData(MDataBlock & data)
 {
-    MPlug p;
+    MStatus stat;
+    Filmback &filmback = settings.filmback;
 
     //Get whether to display safe action
-    p = MPlug( thisNode, DisplaySafeAction );
-    McheckStatus ( p.getValue ( filmback.displaySafeAction  ), "spReticleLoc::getSafeActionData get displaySafeAction");
+    filmback.displaySafeAction = data.inputValue( DisplaySafeAction, &stat ).asShort();
+    McheckStatus ( stat, "spReticleLoc::getSafeActionData get displaySafeAction");
 
     //Get horizontal safe action
-    p = MPlug( thisNode, HorizontalSafeAction );
-    McheckStatus ( p.getValue ( filmback.horizontalSafeAction  ), "spReticleLoc::getSafeActionData get horizontalSafeAction");
+    filmback.horizontalSafeAction = data.inputValue( HorizontalSafeAction, &stat ).asFloat();
+    McheckStatus ( stat, "spReticleLoc::getSafeActionData get horizontalSafeAction");
 
     //Get vertical safe action
-    p = MPlug( thisNode, VerticalSafeAction );
-    McheckStatus ( p.getValue ( filmback.verticalSafeAction  ), "spReticleLoc::getSafeActionData get verticalSafeAction");
+    filmback.verticalSafeAction = data.inputValue( VerticalSafeAction, &stat ).asFloat();
+    McheckStatus ( stat, "spReticleLoc::getSafeActionData get verticalSafeAction");
 
     //Set the safe action line color to the filmback line color
     filmback.safeActionGeom.lineColor = filmback.filmbackGeom.lineColor;
@@ -519,21 +543,22 @@ MStatus spReticleLoc::getSafeActionData()
 
 // This method returns the data relating to the filmback's safe title area.
 //
-MStatus spReticleLoc::getSafeTitleData()
+MStatus spReticleLoc::getSafeTitleData(MDataBlock & data)
 {
-    MPlug p;
+    MStatus stat;
+    Filmback &filmback = settings.filmback;
 
     //Get whether to display safe title
-    p = MPlug( thisNode, DisplaySafeTitle );
-    McheckStatus ( p.getValue ( filmback.displaySafeTitle  ), "spReticleLoc::getSafeTitleData get displaySafeTitle");
+    filmback.displaySafeTitle = data.inputValue( DisplaySafeTitle, &stat ).asShort();
+    McheckStatus ( stat, "spReticleLoc::getSafeTitleData get displaySafeTitle");
 
     //Get horizontal safe title
-    p = MPlug( thisNode, HorizontalSafeTitle );
-    McheckStatus ( p.getValue ( filmback.horizontalSafeTitle  ), "spReticleLoc::getSafeTitleData get horizontalSafeTitle");
+    filmback.horizontalSafeTitle = data.inputValue( HorizontalSafeTitle, &stat ).asFloat();
+    McheckStatus ( stat, "spReticleLoc::getSafeTitleData get horizontalSafeTitle");
 
     //Get vertical safe title
-    p = MPlug( thisNode, VerticalSafeTitle );
-    McheckStatus ( p.getValue ( filmback.verticalSafeTitle  ), "spReticleLoc::getSafeTitleData get verticalSafeTitle");
+    filmback.verticalSafeTitle = data.inputValue( VerticalSafeTitle, &stat ).asFloat();
+    McheckStatus ( stat, "spReticleLoc::getSafeTitleData get verticalSafeTitle");
 
     //Set the safe title line color to the filmback line color
     filmback.safeTitleGeom.lineColor = filmback.filmbackGeom.lineColor;
@@ -545,50 +570,18 @@ MStatus spReticleLoc::getSafeTitleData()
 // attribute is effectively a complex compound attribute where each index
 // is the data for a specific aspect ratio.
 //
-MStatus spReticleLoc::getAspectRatioChildren(MPlug arPlug, Aspect_Ratio & ar)
+MStatus spReticleLoc::getAspectRatioChildren(MDataHandle arHandle, const MObject * children, Aspect_Ratio & ar)
 {
-    MStatus stat;
-    MPlug p, c;
-
-    p = arPlug.child( 0 , &stat );
-    McheckStatus( p.getValue( ar.aspectRatio ), "spReticleLoc::getAspectRatioChildren - aspectRatio" );
-
-    p = arPlug.child( 1 , &stat );
-    McheckStatus( p.getValue( ar.displayMode ), "spReticleLoc::getAspectRatioChildren - displayMode" );
+    ar.aspectRatio = arHandle.child( children[0] ).asFloat();
+    ar.displayMode = arHandle.child( children[1] ).asShort();
 
     if (ar.displayMode != 0)
     {
-        p = arPlug.child( 2 , &stat );
-        c = p.child( 0, &stat );
-        McheckStatus( c.getValue( ar.aspectGeom.maskColor.r ), "spReticleLoc::getAspectRatioChildren - aspectMaskColorR" );
-
-        c = p.child( 1, &stat );
-        McheckStatus( c.getValue( ar.aspectGeom.maskColor.g ), "spReticleLoc::getAspectRatioChildren - aspectMaskColorG" );
+        getColor( arHandle.child( children[2] ), arHandle.child( children[3] ), ar.aspectGeom.maskColor );
+        getColor( arHandle.child( children[4] ), arHandle.child( children[5] ), ar.aspectGeom.lineColor );
 
-        c = p.child( 2, &stat );
-        McheckStatus( c.getValue( ar.aspectGeom.maskColor.b ), "spReticleLoc::getAspectRatioChildren - aspectMaskColorB" );
-
-        p = arPlug.child( 3 , &stat );
-        McheckStatus( p.getValue( ar.aspectGeom.maskColor.a ), "spReticleLoc::getAspectRatioChildren - aspectMaskTrans" );
-
-        p = arPlug.child( 4 , &stat );
-        c = p.child( 0, &stat );
-        McheckStatus( c.getValue( ar.aspectGeom.lineColor.r ), "spReticleLoc::getAspectRatioChildren - aspectLineColorR" );
-
-        c = p.child( 1, &stat );
-        McheckStatus( c.getValue( ar.aspectGeom.lineColor.g ), "spReticleLoc::getAspectRatioChildren - aspectLineColorG" );
-
-        c = p.child( 2, &stat );
-        McheckStatus( c.getValue( ar.aspectGeom.lineColor.b ), "spReticleLoc::getAspectRatioChildren - aspectLineColorB" );
-
-        p = arPlug.child( 5 , &stat );
-        McheckStatus( p.getValue( ar.aspectGeom.lineColor.a ), "spReticleLoc::getAspectRatioChildren - aspectLineTrans" );
-
-        p = arPlug.child( 6 , &stat );
-        McheckStatus( p.getValue( ar.displaySafeAction ), "spReticleLoc::getAspectRatioChildren - displaySafeAction" );
-
-        p = arPlug.child( 7 , &stat );
-        McheckStatus( p.getValue( ar.displaySafeTitle ), "spReticleLoc::getAspectRatioChildren - displaySafeTitle" );
+        ar.displaySafeAction = arHandle.child( children[6] ).asShort();
+        ar.displaySafeTitle = arHandle.child( children[7] ).asShort();
     }
 
     return MS::kSuccess;
@@ -602,24 +595,35 @@ bool spReticleLoc::aspectRatioSortPredicate(const Aspect_Ratio & lhs,
 
 // This retrieves the data for all of the various aspect ratios.
 //
-MStatus spReticleLoc::getAspectRatioData()
+MStatus spReticleLoc::getAspectRatioData(MDataBlock & data)
 {
+    MStatus stat;
+    std::vector<Aspect_Ratio> &ars = settings.ars;
+
     // Get the aspectRatios data
-    MPlug arsPlug = MPlug( thisNode, AspectRatios );
-    int numPlugs = arsPlug.numElements();
+    MArrayDataHandle arsHandle = data.inputArrayValue( AspectRatios, &stat );
+    McheckStatus( stat, "spReticleLoc::getAspectRatioData - cannot get aspectRatios" );
 
-    MStatus stat;
+    // The children of an aspectRatios element, in the order expected by
+    // getAspectRatioChildren
+    MObject children[] = { AspectRatio, DisplayMode, AspectMaskColor, AspectMaskTrans,
+                           AspectLineColor, AspectLineTrans, AspectDisplaySafeAction, AspectDisplaySafeTitle };
+
+    int numElements = arsHandle.elementCount();
 
     // Clear the aspect ratio vector
     ars.clear();
 
-    for (int i = 0; i < numPlugs; i++)
+    for (int i = 0; i < numElements; i++)
     {
-        MPlug p = arsPlug.elementByPhysicalIndex( i, &stat );
+        stat = arsHandle.jumpToArrayElement( i );
         McheckStatus( stat, "spReticleLoc::getAspectRatioData - cannot get index" );
 
+        MDataHandle arHandle = arsHandle.inputValue( &stat );
+        McheckStatus( stat, "spReticleLoc::getAspectRatioData - cannot get element" );
+
         Aspect_Ratio ar;
-        stat = getAspectRatioChildren( p, ar );
+        stat = getAspectRatioChildren( arHandle, children, ar );
         McheckStatus( stat, "spReticleLoc::getAspectRatioData - cannot get children" );
 
         //printAspectRatio( ar );
@@ -627,38 +631,31 @@ MStatus spReticleLoc::getAspectRatioData()
         ars.push_back( ar );
     }
 
-    numAspectRatios = (int)ars.size();
-
     // Sort aspect ratios
     std::sort(ars.begin(),ars.end(),aspectRatioSortPredicate);
 
     return MS::kSuccess;
 }
 
-bool spReticleLoc::needToUpdateAspectRatios()
-{
-    MPlug arsPlug = MPlug( thisNode, AspectRatios );
-    return (ars.size() != arsPlug.numElements() );
-}
-
 // This method gets the data for a PanScan class instance.
 //
-MStatus spReticleLoc::getPanScanData ( PanScan & ps )
+MStatus spReticleLoc::getPanScanData ( MDataBlock & data, PanScan & ps )
 {
-    MPlug psPlug( thisNode, PanScanAttr );
+    MStatus stat;
+
+    MDataHandle psHandle = data.inputValue( PanScanAttr, &stat );
+    McheckStatus( stat, "spReticleLoc::getPanScanData - cannot get panScan" );
 
-    MStatus stat = getAspectRatioChildren( psPlug, ps );
+    MObject children[] = { PanScanAspectRatio, PanScanDisplayMode, PanScanMaskColor, PanScanMaskTrans,
+                           PanScanLineColor, PanScanLineTrans, PanScanDisplaySafeAction, PanScanDisplaySafeTitle };
+
+    stat = getAspectRatioChildren( psHandle, children, ps );
     McheckStatus( stat, "spReticleLoc::getPanScanData - cannot get children" );
 
     if (ps.displayMode != 0)
     {
-        MPlug p;
-
-        p = psPlug.child( 8 , &stat );
-        McheckStatus( p.getValue( ps.panScanRatio ), "spReticleLoc::getPanScanData - panScanRatio" );
-
-        p = psPlug.child( 9 , &stat );
-        McheckStatus( p.getValue( ps.panScanOffset ), "spReticleLoc::getPanScanData - panScanOffset" );
+        ps.panScanRatio = psHandle.child( PanScanRatio ).asFloat();
+        ps.panScanOffset = psHandle.child( PanScanOffset ).asFloat();
     }
 
     //printPanScan( ps );
@@ -670,86 +667,52 @@ MStatus spReticleLoc::getPanScanData ( PanScan & ps )
 // is a complex compound attribute where each index is the data for a specific
 // text element.
 //
-MStatus spReticleLoc::getTextChildren(MPlug tPlug, TextData & td)
+MStatus spReticleLoc::getTextChildren(MDataHandle tHandle, TextData & td)
 {
-    MStatus stat;
-    MPlug p, c;
-
-    p = tPlug.child( 0 , &stat );
-    McheckStatus( p.getValue( td.textType ), "spReticleLoc::getTextChildren - textType" );
-
-    p = tPlug.child( 1 , &stat );
-    McheckStatus( p.getValue( td.textStr ), "spReticleLoc::getTextChildren - textStr" );
-
-    p = tPlug.child( 2 , &stat );
-    McheckStatus( p.getValue( td.textAlign ), "spReticleLoc::getTextChildren - textAlign" );
-
-    p = tPlug.child( 3 , &stat );
-    c = p.child( 0, &stat );
-    McheckStatus( c.getValue( td.textPosX ), "spReticleLoc::getTextChildren - textPosX" );
-
-    c = p.child( 1, &stat );
-    McheckStatus( c.getValue( td.textPosY ), "spReticleLoc::getTextChildren - textPosY" );
-
-    p = tPlug.child( 4 , &stat );
-    McheckStatus( p.getValue( td.textPosRel ), "spReticleLoc::getTextChildren - textPosRel" );
-
-    p = tPlug.child( 5 , &stat );
-    McheckStatus( p.getValue( td.textLevel ), "spReticleLoc::getTextChildren - textLevel" );
-
-    p = tPlug.child( 6 , &stat );
-    McheckStatus( p.getValue( td.textARLevel ), "spReticleLoc::getTextChildren - textARLevel" );
-
-    p = tPlug.child( 7 , &stat );
-    c = p.child( 0, &stat );
-    McheckStatus( c.getValue( td.textColor.r ), "spReticleLoc::getTextChildren - textColorR" );
-
-    c = p.child( 1, &stat );
-    McheckStatus( c.getValue( td.textColor.g ), "spReticleLoc::getTextChildren - textColorG" );
-
-    c = p.child( 2, &stat );
-    McheckStatus( c.getValue( td.textColor.b ), "spReticleLoc::getTextChildren - textColorB" );
-
-    p = tPlug.child( 8 , &stat );
-    McheckStatus( p.getValue( td.textColor.a ), "spReticleLoc::getTextChildren - textTrans" );
-
-    p = tPlug.child( 9, &stat );
-    McheckStatus( p.getValue( td.textEnabled ), "spReticleLoc::getTextChildren - textEnabled" );
-
-    p = tPlug.child( 10 , &stat );
-    McheckStatus( p.getValue( td.textBold ), "spReticleLoc::getTextChildren - textBold" );
-        
-    p = tPlug.child( 11 , &stat );
-    McheckStatus( p.getValue( td.textSize ), "spReticleLoc::getTextChildren - textSize" );
-        
-    p = tPlug.child( 12 , &stat );
-    McheckStatus( p.getValue( td.textScale ), "spReticleLoc::getTextChildren - textScale" );
-        
-    p = tPlug.child( 13 , &stat );
-    McheckStatus( p.getValue( td.textVAlign ), "spReticleLoc::getTextChildren - textVAlign" );
+    td.textType = tHandle.child( TextType ).asShort();
+    td.textStr = tHandle.child( TextStr ).asString();
+    td.textAlign = tHandle.child( TextAlign ).asShort();
+    td.textPosX = tHandle.child( TextPosX ).asFloat();
+    td.textPosY = tHandle.child( TextPosY ).asFloat();
+    td.textPosRel = tHandle.child( TextPosRel ).asShort();
+    td.textLevel = tHandle.child( TextLevel ).asShort();
+    td.textARLevel = tHandle.child( TextARLevel ).asInt();
+
+    getColor( tHandle.child( TextColor ), tHandle.child( TextTrans ), td.textColor );
+
+    td.textEnabled = tHandle.child( TextEnabled ).asBool();
+    td.textBold = tHandle.child( TextBold ).asBool();
+    td.textSize = tHandle.child( TextSize ).asInt();
+    td.textScale = tHandle.child( TextScale ).asBool();
+    td.textVAlign = tHandle.child( TextVAlign ).asShort();
+    td.textSource = tHandle.child( TextSource ).asString();
 
     return MS::kSuccess;
 }
 
-MStatus spReticleLoc::getTextData()
+MStatus spReticleLoc::getTextData(MDataBlock & data)
 {
     // Clear the text vector
     text.clear();
 
     MStatus stat;
-    MPlug p,tp,cp;
 
-    p = MPlug( thisNode, Text );
-    int numPlugs = p.numElements();
+    MArrayDataHandle textHandle = data.inputArrayValue( Text, &stat );
+    McheckStatus( stat, "spReticleLoc::getTextData - cannot get text" );
+
+    int numElements = textHandle.elementCount();
 
-    for (int i = 0; i < numPlugs && i < 10; i++ )
+    for (int i = 0; i < numElements && i < 10; i++ )
     {
         TextData td;
 
-        tp = p.elementByPhysicalIndex( i, &stat );
+        stat = textHandle.jumpToArrayElement( i );
         McheckStatus( stat, "spReticleLoc::getTextData - cannot get index" );
 
-        stat = getTextChildren( tp, td );
+        MDataHandle tHandle = textHandle.inputValue( &stat );
+        McheckStatus( stat, "spReticleLoc::getTextData - cannot get element" );
+
+        stat = getTextChildren( tHandle, td );
         McheckStatus( stat, "spReticleLoc::getTextData - cannot get children" );
 
         //printText( td );
@@ -762,68 +725,85 @@ MStatus spReticleLoc::getTextData()
 
 // This method retrieves all of the options settings.
 //
-MStatus spReticleLoc::getOptions()
+MStatus spReticleLoc::getOptions(MDataBlock & data)
 {
-    MPlug p;
     MStatus stat;
+    Options &options = settings.options;
 
     // Check to see if drawing is enabled
-    p = MPlug ( thisNode, DrawingEnabled );
-    McheckStatus ( p.getValue ( options.drawingEnabled ), "spReticleLoc::getOptions drawingEnabled" );
+    options.drawingEnabled = data.inputValue( DrawingEnabled, &stat ).asBool();
+    McheckStatus ( stat, "spReticleLoc::getOptions drawingEnabled" );
 
     if (options.drawingEnabled)
     {
         // Check to see if the text should be rendered;
-        p = MPlug ( thisNode, EnableTextDrawing );
-        McheckStatus ( p.getValue( options.enableTextDrawing), "spReticleLoc::getOptions enableTextDrawing" );
+        options.enableTextDrawing = data.inputValue( EnableTextDrawing, &stat ).asBool();
+        McheckStatus ( stat, "spReticleLoc::getOptions enableTextDrawing" );
 
         // Get the camera filter mode
-        p = MPlug ( thisNode, CameraFilterMode );
-        McheckStatus ( p.getValue ( options.cameraFilterMode  ), "spReticleLoc::getOptions cameraFilterMode");
+        options.cameraFilterMode = data.inputValue( CameraFilterMode, &stat ).asShort();
+        McheckStatus ( stat, "spReticleLoc::getOptions cameraFilterMode");
 
         // Display horizontal line option;
-        p = MPlug ( thisNode, DisplayLineH );
-        McheckStatus ( p.getValue ( options.displayLineH  ), "spReticleLoc::getOptions displayLineH");
+        options.displayLineH = data.inputValue( DisplayLineH, &stat ).asBool();
+        McheckStatus ( stat, "spReticleLoc::getOptions displayLineH");
 
         // Display vertical line option;
-        p = MPlug ( thisNode, DisplayLineV );
-        McheckStatus ( p.getValue ( options.displayLineV  ), "spReticleLoc::getOptions displayLineV");
+        options.displayLineV = data.inputValue( DisplayLineV, &stat ).asBool();
+        McheckStatus ( stat, "spReticleLoc::getOptions displayLineV");
 
         // Display horizontal thirds option;
-        p = MPlug ( thisNode, DisplayThirdsH );
-        McheckStatus ( p.getValue ( options.displayThirdsH  ), "spReticleLoc::getOptions displayThirdsH");
+        options.displayThirdsH = data.inputValue( DisplayThirdsH, &stat ).asBool();
+        McheckStatus ( stat, "spReticleLoc::getOptions displayThirdsH");
 
         // Display vertical thirds option;
-        p = MPlug ( thisNode, DisplayThirdsV );
-        McheckStatus ( p.getValue ( options.displayThirdsV  ), "spReticleLoc::getOptions displayThirdsV");
+        options.displayThirdsV = data.inputValue( DisplayThirdsV, &stat ).asBool();
+        McheckStatus ( stat, "spReticleLoc::getOptions displayThirdsV");
 
         // Display crosshair option;
-        p = MPlug ( thisNode, DisplayCrosshair );
-        McheckStatus ( p.getValue ( options.displayCrosshair  ), "spReticleLoc::getOptions displayCrosshair");
+        options.displayCrosshair = data.inputValue( DisplayCrosshair, &stat ).asBool();
+        McheckStatus ( stat, "spReticleLoc::getOptions displayCrosshair");
         
-        // Display crosshair option;
-        p = MPlug ( thisNode, DisplayFieldGuide );
-        McheckStatus ( p.getValue ( options.displayFieldGuide  ), "spReticleLoc::getOptions displayFieldGuide");
+        // Display field guide option;
+        options.displayFieldGuide = data.inputValue( DisplayFieldGuide, &stat ).asBool();
+        McheckStatus ( stat, "spReticleLoc::getOptions displayFieldGuide");
         
         // Text Color;
-        stat = getColor (MiscTextColor, MiscTextTrans, options.textColor );
+        stat = getColor ( data.inputValue( MiscTextColor ), data.inputValue( MiscTextTrans ), options.textColor );
         McheckStatus ( stat, "spReticleLoc::getOptions textColor");
 
         // Line Color;
-        stat = getColor ( LineColor, LineTrans, options.lineColor );
+        stat = getColor ( data.inputValue( LineColor ), data.inputValue( LineTrans ), options.lineColor );
         McheckStatus ( stat, "spReticleLoc::getOptions lineColor");
 
+        // Line Width;
+        options.lineWidth = data.inputValue( LineWidth, &stat ).asFloat();
+        McheckStatus ( stat, "spReticleLoc::getOptions lineWidth");
+
+        // Draw statistics label and GPU timers;
+        options.displayStats = data.inputValue( DisplayStats, &stat ).asBool();
+        McheckStatus ( stat, "spReticleLoc::getOptions displayStats");
+
         // Get whether to drive a camera or not;
-        p = MPlug ( thisNode, DriveCameraAperture );
-        McheckStatus ( p.getValue ( options.driveCameraAperture  ), "spReticleLoc::getOptions driveCameraAperture");
+        options.driveCameraAperture = data.inputValue( DriveCameraAperture, &stat ).asBool();
+        McheckStatus ( stat, "spReticleLoc::getOptions driveCameraAperture");
 
         // Get the maximum distance attribute;
-        p = MPlug ( thisNode, MaximumDistance );
-        McheckStatus ( p.getValue ( options.maximumDistance  ), "spReticleLoc::getOptions maximumDistance");
+        options.maximumDistance = data.inputValue( MaximumDistance, &stat ).asFloat();
+        McheckStatus ( stat, "spReticleLoc::getOptions maximumDistance");
 
         // Get whether to respect overscan or not;
-        p = MPlug ( thisNode, UseOverscan );
-        McheckStatus ( p.getValue ( options.useOverscan  ), "spReticleLoc::getOptions useOverscan");
+        options.useOverscan = data.inputValue( UseOverscan, &stat ).asBool();
+        McheckStatus ( stat, "spReticleLoc::getOptions useOverscan");
+
+        // Get the shot metadata index, falling back to the environment
+        options.shotMetadataFile = data.inputValue( ShotMetadataFile, &stat ).asString();
+        McheckStatus ( stat, "spReticleLoc::getOptions shotMetadataFile");
+
+        if (options.shotMetadataFile == "" && getenv(SHOT_METADATA_ENV_VAR))
+            shotMetadata.setPath( getenv(SHOT_METADATA_ENV_VAR) );
+        else
+            shotMetadata.setPath( options.shotMetadataFile.asChar() );
     }
 
     // Print the options to cerr
@@ -832,330 +812,74 @@ MStatus spReticleLoc::getOptions()
     return MS::kSuccess;
 }
 
-// This method calculates the geometry of the current window. This data is
-// stored in a instance of the Geom class.
+// This method ingests the settings and the time. All of the settings affect
+// configVersion and the time affects outTime, so that the node is evaluated
+// by the dependency graph or the Evaluation Manager like any other node; the
+// draw only reads the results and never evaluates or edits the graph itself.
 //
-void spReticleLoc::calcPortGeom()
+MStatus spReticleLoc::compute(const MPlug & plug, MDataBlock & data)
 {
-    portGeom.x1 = 0;
-    portGeom.x2 = portWidth;
-    portGeom.y1 = 0;
-    portGeom.y2 = portHeight;
-
-    portGeom.x = portWidth / 2;
-    portGeom.y = portHeight / 2;
-    portGeom.isValid = true;
-}
-
-// This method calculates the geometry for the filmback. There are multiple
-// Geom instances that are used for displaying all of the filmback options.
-// This method takes the filmback data and calculates the appropriate settings
-// for the filmback Geom instances.
-//
-void spReticleLoc::calcFilmbackGeom()
-{
-    filmback = oFilmback;
-
-    // See if we are using the camera's filmback data
-    bool useCameraFilmback = filmback.horizontalFilmAperture < 0;
-
-    // If the horizontalFilmAperture equals -1, then use the cameras settings
-    if (useCameraFilmback)
-    {
-        filmback.horizontalFilmAperture = camera.horizontalFilmAperture();
-        filmback.verticalFilmAperture = camera.verticalFilmAperture();
-    }
-    // If drive camera aperture is on, then set camera values
-    else if (options.driveCameraAperture)
-    {
-        if (fabs(camera.horizontalFilmAperture() - filmback.horizontalFilmAperture) > EPSILON)
-            McheckVoid( camera.setHorizontalFilmAperture(filmback.horizontalFilmAperture), "spReticleLoc::calcFilmbackGeom - setting "+camera.name()+".horizontalFilmAperture");
-        if (fabs(camera.verticalFilmAperture() - filmback.verticalFilmAperture) > EPSILON)
-            McheckVoid( camera.setVerticalFilmAperture(filmback.verticalFilmAperture), "spReticleLoc::calcFilmbackGeom - setting "+camera.name()+".verticalFilmAperture");
-    }
-
-    // Calculate the aspect ratio of the cameras filmback
-    double cameraAspectRatio = camera.horizontalFilmAperture() / camera.verticalFilmAperture();
-
-    // Calculate the aspect ratio of the viewport and determine if it has a horizontal or vertical orientation
-    double portAspectRatio = portWidth/portHeight;
-    bool portHoriz = portAspectRatio > cameraAspectRatio;
-
-    MFnCamera::FilmFit filmFit = camera.filmFit();
-    if (filmFit == MFnCamera::kFillFilmFit)
-    {
-        if (portHoriz)
-            filmFit = MFnCamera::kHorizontalFilmFit;
-        else
-            filmFit = MFnCamera::kVerticalFilmFit;
-    }
-    else if (filmFit == MFnCamera::kOverscanFilmFit)
-    {
-        if (portHoriz)
-            filmFit = MFnCamera::kVerticalFilmFit;
-        else
-            filmFit = MFnCamera::kHorizontalFilmFit;
-    }
-
-    double panX = 0.0;
-    double panY = 0.0;
-    double zoom = 1.0;
+    MStatus stat;
 
-#if MAYA_API_VERSION >= 201100
-    if (camera.panZoomEnabled() && !camera.renderPanZoom())
+    if (plug == ConfigVersion)
     {
-        zoom = camera.zoom();
-        panX = camera.horizontalPan();
-        panY = camera.verticalPan();
-    }
-#endif
+        // Get options
+        stat = getOptions( data );
+        McheckStatus( stat, "spReticleLoc::compute get options" );
 
-    double pixelScale = 1.0;
-
-    // Calculate the pixel scale value to use when drawing the filmback
-    switch ( filmFit )
-    {
-        case MFnCamera::kInvalid :
-        case MFnCamera::kHorizontalFilmFit :
-        {
-            pixelScale = portWidth / overscan / camera.horizontalFilmAperture() / zoom;
-            portGeom.x -= (panX * pixelScale);
-            portGeom.y -= (panY * pixelScale);
-            break;
-        }
-        case MFnCamera::kVerticalFilmFit :
-        {
-            pixelScale = portHeight / overscan / camera.verticalFilmAperture() / zoom;
-            portGeom.x -= (panX * pixelScale);
-            portGeom.y -= (panY * pixelScale);
-            break;
-        }
-        default:
+        if (settings.options.drawingEnabled)
         {
-            MGlobal::displayError( name() + " invalid camera film fit (" + filmFit + ")");
-            break;
-        }
-    }
-
-    // If the reticle is in relativeFilmback mode, then scale the reticle filmback to fit the camera filmback
-    if (filmback.relativeFilmback)
-    {
-        double aspectRatio = filmback.horizontalFilmAperture / filmback.verticalFilmAperture;
-        if (aspectRatio > cameraAspectRatio)
-            pixelScale *= camera.horizontalFilmAperture() / filmback.horizontalFilmAperture;
-        else
-            pixelScale *= camera.verticalFilmAperture() / filmback.verticalFilmAperture;
-    }
-
-    // Account for lens squeeze for the filmback
-    double pixelScaleX = pixelScale * camera.lensSqueezeRatio();
-
-    // Calculate the filmback width and height
-    filmback.filmbackGeom.x = filmback.horizontalFilmAperture * pixelScaleX;
-    filmback.filmbackGeom.y = filmback.verticalFilmAperture * pixelScale;
-    
-    // Calculate the actual filmback geometry corner values    
-    filmback.filmbackGeom.x1 = portGeom.x - (filmback.filmbackGeom.x / 2);
-    filmback.filmbackGeom.x2 = portGeom.x + (filmback.filmbackGeom.x / 2);
-    filmback.filmbackGeom.y1 = portGeom.y - (filmback.filmbackGeom.y / 2);
-    filmback.filmbackGeom.y2 = portGeom.y + (filmback.filmbackGeom.y / 2);
-    filmback.filmbackGeom.isValid = true;
-
-    // Set the image area to match the filmback    
-    filmback.imageGeom = filmback.filmbackGeom;
-    filmback.horizontalImageAperture	= filmback.horizontalFilmAperture;
-    filmback.verticalImageAperture		= filmback.verticalFilmAperture;
-
-    // Calculate the pad area width and height
-    if (pad.usePad && pad.isPadded)
-    {
-        pad.padGeom.x = (filmback.horizontalFilmAperture - pad.padAmountX) * pixelScaleX;
-        pad.padGeom.y = (filmback.verticalFilmAperture - pad.padAmountY) * pixelScale;
-
-        // Calculate rest of the pad area
-        pad.padGeom.x1 = portGeom.x - (pad.padGeom.x / 2);
-        pad.padGeom.x2 = portGeom.x + (pad.padGeom.x / 2);
-        pad.padGeom.y1 = portGeom.y - (pad.padGeom.y / 2);
-        pad.padGeom.y2 = portGeom.y + (pad.padGeom.y / 2);
-        pad.padGeom.isValid = true;
+            // Get the pad attribute data
+            getPadData( data );
 
-        //Update the image area
-        filmback.horizontalImageAperture -= pad.padAmountX;
-        filmback.verticalImageAperture -= pad.padAmountY;
-    }
-
-    // Adjust for sound track if necessary
-    double imageOffsetX = 0;
-    if (filmback.soundTrackWidth > EPSILON)
-    {
-        filmback.horizontalImageAperture -= filmback.soundTrackWidth;
-        imageOffsetX = (filmback.soundTrackWidth * pixelScaleX) / 2.0;
-    }
+            // Get the filmback attribute data
+            getFilmbackData( data );
 
-    // Calculate the image area width & height
-    filmback.imageGeom.x = filmback.horizontalImageAperture * pixelScaleX;
-    filmback.imageGeom.y = filmback.verticalImageAperture * pixelScale;
-    
-    // Calculate the actual filmback geometry corner values    
-    filmback.imageGeom.x1 = (portGeom.x + imageOffsetX) - (filmback.imageGeom.x / 2.0f);
-    filmback.imageGeom.x2 = (portGeom.x + imageOffsetX) + (filmback.imageGeom.x / 2.0f);
-    filmback.imageGeom.y1 = portGeom.y - (filmback.imageGeom.y / 2.0f);
-    filmback.imageGeom.y2 = portGeom.y + (filmback.imageGeom.y / 2.0f);
-    filmback.imageGeom.isValid = true;
-
-    // reset safe action/title    
-    filmback.safeActionGeom.isValid = false;
-    filmback.safeTitleGeom.isValid = false;
-}
+            // Get the projection gate attribute data
+            getProjectionData( data );
 
-// This method calculates the safe action area for the filmback.
-//
-void spReticleLoc::calcFilmbackSafeActionGeom()
-{
-    calcMaskGeom(filmback.safeActionGeom,filmback.horizontalSafeAction,filmback.verticalSafeAction,filmback.imageGeom,filmback.horizontalImageAperture,filmback.verticalImageAperture);
-    filmback.safeActionGeom.isValid = true;
-}
+            // Get safe title and safe action data
+            getSafeActionData( data );
+            getSafeTitleData( data );
 
-// This method calculates the safe title area for the filmback.
-//
-void spReticleLoc::calcFilmbackSafeTitleGeom(){
-    calcMaskGeom(filmback.safeTitleGeom,filmback.horizontalSafeTitle,filmback.verticalSafeTitle,filmback.imageGeom,filmback.horizontalImageAperture,filmback.verticalImageAperture);
-    filmback.safeTitleGeom.isValid = true;
-}
+            // Get the aspect ratio data
+            getAspectRatioData( data );
 
-// This method calculates the actual mask x,y values for a given Geom
-// instance.
-//
-void spReticleLoc::calcMaskGeom(Geom & g, double w, double h, Geom & gSrc,
-                                 double wSrc, double hSrc)
-{
-    double pw = (w >= 0)?((wSrc-w)/2.0)/wSrc:(1.0-wSrc)/2.0;
-    double ph = (h >= 0)?((hSrc-h)/2.0)/hSrc:(1.0-hSrc)/2.0;
+            // Get pan and scan data
+            getPanScanData( data, settings.panScan );
 
-    g.x = gSrc.x*pw*camera.lensSqueezeRatio();
-    g.y = gSrc.y*ph;
+            // Get the text data
+            getTextData( data );
+        }
 
-    g.x1 = gSrc.x1+g.x;
-    g.x2 = gSrc.x2-g.x;
-    g.y1 = gSrc.y1+g.y;
-    g.y2 = gSrc.y2-g.y;
-}
+        // The settings are drawn without the node, with its name for errors
+        settings.name = name();
+        settings.configVersion++;
 
-// Calculates the safe action geometry for an Aspect Ratio.
-//
-void spReticleLoc::calcSafeActionGeom( Aspect_Ratio & ar )
-{
-    if ( ar.aspectGeom.isValid )
-    {
-        ar.safeActionGeom = ar.aspectGeom;
-        calcMaskGeom(ar.safeActionGeom, -1, -1, ar.aspectGeom, 0.9, 0.9);
-        ar.safeActionGeom.isValid = true;
-    }
-    else
-    {
-        ar.safeActionGeom.isValid = false;
-    }
-}
+        MDataHandle outHandle = data.outputValue( ConfigVersion, &stat );
+        McheckStatus( stat, "spReticleLoc::compute get configVersion" );
+        outHandle.set( settings.configVersion );
+        outHandle.setClean();
 
-// Calculates the safe title geometry for an Aspect Ratio.
-//
-void spReticleLoc::calcSafeTitleGeom( Aspect_Ratio & ar )
-{
-    if (ar.aspectGeom.isValid)
-    {
-        ar.safeTitleGeom = ar.aspectGeom;
-        calcMaskGeom(ar.safeTitleGeom, -1, -1, ar.aspectGeom, 0.8, 0.8);
-        ar.safeTitleGeom.isValid = true;
+        return MS::kSuccess;
     }
-    else
+    else if (plug == OutTime)
     {
-        ar.safeTitleGeom.isValid = false;
-    }
-}
-
-// This calculates the various Geom instances for a particular aspectRatio
-// instance.
-//
-void spReticleLoc::calcAspectGeom( Aspect_Ratio & ar )
-{
-    ar.aspectGeom.x = filmback.imageGeom.x / camera.lensSqueezeRatio();
-    ar.aspectGeom.y = ar.aspectGeom.x / ar.aspectRatio;
-
-    ar.aspectGeom.x1 = filmback.imageGeom.x1;
-    ar.aspectGeom.x2 = filmback.imageGeom.x2;
-    ar.aspectGeom.y1 = portGeom.y - (ar.aspectGeom.y / 2);
-    ar.aspectGeom.y2 = portGeom.y + (ar.aspectGeom.y / 2);
-
-    ar.aspectGeom.isValid = true;
-    ar.safeActionGeom.isValid = false;
-    ar.safeTitleGeom.isValid = false;
-
-    if (ar.displaySafeAction)
-        calcSafeActionGeom(ar);
+        MDataHandle timeHandle = data.inputValue( Time, &stat );
+        McheckStatus( stat, "spReticleLoc::compute get time" );
 
-    if (ar.displaySafeTitle)
-        calcSafeTitleGeom(ar);
-}
-
-// This calculates the PanScan Geom instances.
-//
-void spReticleLoc::calcPanScanGeom( PanScan & ps )
-{
-    //Calculate the aspect ratio of the filmback to later determine the fit of the pan/scan area    
-    float aspectRatio = filmback.horizontalImageAperture / filmback.verticalImageAperture;
-    
-    //If the aspect ratio of the pan/scan area is not set, use the filmback's aspect ratio    
-    if (ps.aspectRatio < 0)
-        ps.aspectRatio = aspectRatio;
+        MDataHandle outHandle = data.outputValue( OutTime, &stat );
+        McheckStatus( stat, "spReticleLoc::compute get outTime" );
+        outHandle.set( timeHandle.asTime() );
+        outHandle.setClean();
 
-    //Determine the fit of the pan/scan & pan/scan area against the filmback    
-    if (ps.aspectRatio > aspectRatio && ps.panScanRatio < ps.aspectRatio)
-    {
-        ps.aspectGeom.y = (filmback.imageGeom.x / camera.lensSqueezeRatio()) / ps.aspectRatio;
-        ps.aspectGeom.x = ps.aspectGeom.y * ps.panScanRatio;
-    }
-    else if (ps.panScanRatio > aspectRatio)
-    {
-        ps.aspectGeom.x = filmback.imageGeom.x / camera.lensSqueezeRatio();
-        ps.aspectGeom.y = ps.aspectGeom.x / ps.panScanRatio;
+        return MS::kSuccess;
     }
-    else
-    {
-        ps.aspectGeom.y = filmback.imageGeom.y;
-        ps.aspectGeom.x = ps.aspectGeom.y * ps.panScanRatio;
-    }
-    
-    //Adjust for lens squeeze
-    ps.aspectGeom.x *= camera.lensSqueezeRatio();
-
-    ps.aspectGeom.x1 = filmback.imageGeom.x1+ ( ((ps.panScanOffset+1)/2)*(filmback.imageGeom.x-ps.aspectGeom.x) );
-    ps.aspectGeom.x2 = ps.aspectGeom.x1+ps.aspectGeom.x;
-    ps.aspectGeom.y1 = portGeom.y - (ps.aspectGeom.y / 2.0f);
-    ps.aspectGeom.y2 = portGeom.y + (ps.aspectGeom.y / 2.0f);
-
-    ps.aspectGeom.isValid = true;
-    ps.safeActionGeom.isValid = false;
-    ps.safeTitleGeom.isValid = false;
-
-    if (ps.displaySafeAction)
-        calcSafeActionGeom( ps );
-
-    if (ps.displaySafeTitle)
-        calcSafeTitleGeom( ps );
-}
-
-bool spReticleLoc::setInternalValueInContext(const  MPlug & plug,
-        const MDataHandle & dataHandle,  MDGContext & ctx)
-{
-    if (plug == worldInverseMatrix || plug == isTemplated)
-        return false;
 
-    needRefresh = true;
-
-    return false;
+    return MS::kUnknownParameter;
 }
 
-bool spReticleLoc::calcDynamicText(TextData *td, const int i)
+bool spReticleLoc::calcDynamicText(const CameraState &cam, TextData *td, const int i)
 {
     char buff[255];
     
@@ -1167,34 +891,23 @@ bool spReticleLoc::calcDynamicText(TextData *td, const int i)
             if (td->textStr == "")
                 td->textStr = MString("%1.2f mm");
             
-            sprintf(buff,td->textStr.asChar(),camera.focalLength() );
+            sprintf(buff,td->textStr.asChar(),cam.focalLength );
             td->textStr = MString(buff);
             break;
         case 2:						//Camera
             if (td->textStr == "")
-                td->textStr = camera.name();
+                td->textStr = cam.name;
             else
             {
-                sprintf(buff,td->textStr.asChar(),camera.name().asChar() );
+                sprintf(buff,td->textStr.asChar(),cam.name.asChar() );
                 td->textStr = MString(buff);
             }
             break;
         case 3:						//Frame
         {
             MTime time;
-            MPlug p = MPlug ( thisNode, Time );
-            if (p.isNull() == false && p.isConnected() == false)
-            {
-                MString cmd = "connectAttr time1.o "+p.name();
-                MGlobal::executeCommand(cmd);
-            }
-            
-            MStatus status = p.getValue(time);
-            if (!status)
-            {
-                status.perror("spReticleLoc::calcDynamicText get time");
+            if (!getTime(time))
                 return false;
-            }
             
             if (td->textStr == "")
                 td->textStr = MString("%04.0f");
@@ -1206,7 +919,7 @@ bool spReticleLoc::calcDynamicText(TextData *td, const int i)
         case 4:						//Aspect Ratio
         {
             int level = td->textARLevel;
-            if (level < 0 || level >= numAspectRatios)
+            if (level < 0 || level >= (int)settings.ars.size())
             {
                 MGlobal::displayError( name() + " invalid text level (" + level + ") for text item " + i);
                 return false;
@@ -1215,27 +928,27 @@ bool spReticleLoc::calcDynamicText(TextData *td, const int i)
             if (td->textStr == "")
                 td->textStr = MString("%1.3f");
             
-            sprintf(buff,td->textStr.asChar(),ars[level].aspectRatio );
+            sprintf(buff,td->textStr.asChar(),settings.ars[level].aspectRatio );
             td->textStr = MString(buff);
             break;
         }
         case 5:						//Maximum Distance
-            if (options.maximumDistance <= 0)
+            if (settings.options.maximumDistance <= 0)
                 return false;
             
             if (td->textStr == "")
                 td->textStr = MString("max. dist %1.0f");
             
             //textColor = (maximumDist >= options.maximumDistance) ? MColor(1,1,1,0) : textColor;
-            sprintf(buff, td->textStr.asChar(), maximumDist );
+            sprintf(buff, td->textStr.asChar(), cam.maximumDist );
             td->textStr = MString(buff);
             break;
         case 6:						//Projection Gate
         {
-            if (!filmback.displayProjGate)
+            if (!settings.filmback.displayProjGate)
                 return false;
             
-            double aspectRatio = (filmback.horizontalProjectionGate/filmback.verticalProjectionGate);
+            double aspectRatio = (settings.filmback.horizontalProjectionGate/settings.filmback.verticalProjectionGate);
             
             if (td->textStr == "")
                 td->textStr = MString("%1.3f");
@@ -1342,14 +1055,14 @@ bool spReticleLoc::calcDynamicText(TextData *td, const int i)
             if (td->textStr == "")
                 td->textStr = MString("%1.2f");
             
-            sprintf(buff, td->textStr.asChar(), panScan.panScanRatio );
+            sprintf(buff, td->textStr.asChar(), settings.panScan.panScanRatio );
             td->textStr = MString(buff);
             break;
         case 18:						//Pan Scan Offset
             if (td->textStr == "")
                 td->textStr = MString("%1.2f");
             
-            sprintf(buff, td->textStr.asChar(), panScan.panScanOffset );
+            sprintf(buff, td->textStr.asChar(), settings.panScan.panScanOffset );
             td->textStr = MString(buff);
             break;
         case 19:						//Safe Action
@@ -1360,6 +1073,33 @@ bool spReticleLoc::calcDynamicText(TextData *td, const int i)
             if (td->textStr == "")
                 td->textStr = "safe title";
             break;
+        case 21:						//Shot Metadata
+        {
+            const char *value = getShotMetadata(td, i);
+            if (!value)
+                return false;
+            
+            if (td->textStr == "")
+                td->textStr = MString("%s");
+            
+            snprintf(buff, sizeof(buff), td->textStr.asChar(), value);
+            td->textStr = MString(buff);
+            break;
+        }
+        case 22:						//MEL Script
+        case 23:						//Python Script
+        {
+            const char *value = getScriptText(td, i);
+            if (!value)
+                return false;
+            
+            if (td->textStr == "")
+                td->textStr = MString("%s");
+            
+            snprintf(buff, sizeof(buff), td->textStr.asChar(), value);
+            td->textStr = MString(buff);
+            break;
+        }
         default:
             MGlobal::displayError( name() + " invalid text type for text item " + i);
             return false;
@@ -1368,229 +1108,273 @@ bool spReticleLoc::calcDynamicText(TextData *td, const int i)
     return true;
 }
 
-bool spReticleLoc::getTextLevelGeometry(TextData *td, Geom &g, const int i)
+// This returns the value of the shot metadata field named by the textSource
+// of a text item. The field is looked up in the index once and the result is
+// held until either the shot, the field or the index itself changes.
+//
+const char *spReticleLoc::getShotMetadata(TextData *td, const int i)
 {
-    switch (td->textLevel)
+    if ((int)shotFieldRefs.size() <= i)
+        shotFieldRefs.resize(i+1);
+    
+    ShotFieldRef &ref = shotFieldRefs[i];
+    
+    const char *shot = getenv(SHOT_ENV_VAR);
+    const char *field = td->textSource.asChar();
+    if (!shot || !*field)
+        return NULL;
+    
+    if (ref.shot != shot || ref.field != field)
     {
-        case 0:
-            g = portGeom;
-            break;
-        case 1:
-            g = pad.padGeom;
-            break;
-        case 2:
-            {
-                switch (td->textType)
-                {
-                    case 19:
-                        if (!filmback.safeActionGeom.isValid)
-                            calcFilmbackSafeActionGeom();
-                        g = filmback.safeActionGeom;
-                        break;
-                    case 20:
-                        if (!filmback.safeTitleGeom.isValid)
-                            calcFilmbackSafeTitleGeom();
-                        g = filmback.safeTitleGeom;
-                        break;
-                    default:
-                        g = filmback.filmbackGeom;
-                        break;
-                }
-            }
-            break;
-        case 3:
-            if (!filmback.displayProjGate)
-            {
-                MGlobal::displayError( name() + " cannot anchor text item " + i + " to undisplayed projection mask");
-                return false;
-            }
-            g = filmback.projGeom;
-            break;
-        case 4:
-            {
-                int level = td->textARLevel;
-                if (level < 0 || level >= numAspectRatios)
-                {
-                    MGlobal::displayError( name() + " invalid aspect ratio level (" + td->textARLevel + ") for text item " + i);
-                    return false;
-                }
-                
-                if (!ars[level].aspectGeom.isValid)
-                    return false;
-                
-                switch (td->textType)
-                {
-                    case 19:
-                        if (!ars[level].safeActionGeom.isValid)
-                            calcSafeActionGeom(ars[level]);
-                        g = ars[level].safeActionGeom;
-                        break;
-                    case 20:
-                        if (!ars[level].safeTitleGeom.isValid)
-                            calcSafeTitleGeom(ars[level]);
-                        g = ars[level].safeTitleGeom;
-                        break;
-                    default:
-                        g = ars[level].aspectGeom;
-                        break;
-                }
-            }
-            break;
-        case 5:
-            {
-                if (!panScan.aspectGeom.isValid)
-                    calcPanScanGeom( panScan );
-                
-                switch (td->textType)
-                {
-                    case 19:
-                        if (!panScan.safeActionGeom.isValid)
-                            calcSafeActionGeom(panScan);
-                        g = panScan.safeActionGeom;
-                        break;
-                    case 20:
-                        if (!panScan.safeTitleGeom.isValid)
-                            calcSafeTitleGeom(panScan);
-                        g = panScan.safeTitleGeom;
-                        break;
-                    default:
-                        g = panScan.aspectGeom;
-                        break;
-                }
-            }
-            break;
-        default:
-            MGlobal::displayError( name() + " invalid text anchor for text item " + i);
-            break;
+        ref.shot = shot;
+        ref.field = field;
+        ref.generation = 0;
     }
     
-    return true;
+    return shotMetadata.resolve(ref);
 }
 
-bool spReticleLoc::calcTextPosition(TextData *td, const Geom &g, double &x, double &y, const int i)
+// This returns the current time as evaluated into the outTime attribute. If
+// the time attribute isn't connected yet, the connection to time1 is queued
+// on the idle queue, as the graph must not be edited while it is drawn.
+//
+bool spReticleLoc::getTime(MTime &time)
 {
-    switch (td->textPosRel)
+    MPlug p = MPlug ( thisNode, Time );
+    if (!timeConnectQueued && p.isNull() == false && p.isConnected() == false)
     {
-        case 0:						//Bottom Left
-            x = g.x1;
-            y = g.y1;
-            break;
-        case 1:						//Bottom Center
-            x = (g.x1 + g.x2 ) / 2;
-            y = g.y1;
-            break;
-        case 2:						//Bottom Right
-            x = g.x2;
-            y = g.y1;
-            break;
-        case 3:						//Middle Left
-            x = g.x1;
-            y = (g.y1 + g.y2 ) / 2;
-            break;
-        case 4:						//Center
-            x = (g.x1 + g.x2 ) / 2;
-            y = (g.y1 + g.y2 ) / 2;
-            break;
-        case 5:						//Middle Right
-            x = g.x2;
-            y = (g.y1 + g.y2 ) / 2;
-            break;
-        case 6:						//Top Left
-            x = g.x1;
-            y = g.y2;
-            break;
-        case 7:						//Top Center
-            x = (g.x1 + g.x2 ) / 2;
-            y = g.y2;
-            break;
-        case 8:						//Top Right
-            x = g.x2;
-            y = g.y2;
-            break;
-        default:
-            MGlobal::displayError( name() + " invalid text relative position (" + td->textPosRel + ") for text item " + i);
-            return false;
+        MString cmd = "if (!`connectionInfo -id "+p.name()+"`) connectAttr time1.o "+p.name();
+        MGlobal::executeCommandOnIdle(cmd);
+        timeConnectQueued = true;
     }
     
-    return true;
+    p = MPlug ( thisNode, OutTime );
+    MStatus status = p.getValue(time);
+    if (!status)
+    {
+        status.perror("spReticleLoc::getTime get time");
+        return false;
+    }
+    
+    return true;
+}
+
+// This returns the cached result of the script of a script text item. The
+// script is never run from the draw; if there is no result for the current
+// frame yet, an evaluation is queued on the idle queue and the latest
+// result, if any, is displayed in the meantime.
+//
+const char *spReticleLoc::getScriptText(TextData *td, const int i)
+{
+    if ((int)scriptText.size() <= i)
+        scriptText.resize(i+1);
+    
+    ScriptText &st = scriptText[i];
+    
+    bool python = (td->textType == 23);
+    if (st.script != td->textSource || st.python != python)
+    {
+        st.script = td->textSource;
+        st.python = python;
+        st.results.clear();
+        st.latest = -1;
+        st.next = 0;
+    }
+    
+    if (st.script == "")
+        return NULL;
+    
+    // Scripts stored in a scene are only run when enabled, as they would
+    // run as soon as the scene is drawn
+    if (!scriptTextEnabled)
+    {
+        if (!st.warned)
+        {
+            MGlobal::displayWarning( name() + " script text item " + i + " is disabled, set " SCRIPT_TEXT_ENV_VAR "=1 before loading the plugin to enable it" );
+            st.warned = true;
+        }
+        return NULL;
+    }
+    
+    MTime time;
+    if (!getTime(time))
+        return NULL;
+    
+    double frame = time.as(MTime::uiUnit());
+    for (size_t j = 0; j < st.results.size(); j++)
+    {
+        if (st.results[j].frame == frame)
+            return st.results[j].result.asChar();
+    }
+    
+    if (!st.pending)
+    {
+        st.pending = true;
+        
+        MFnDagNode fnThisNode( thisNode );
+        MString cmd = "spReticleLocEvalText \""+fnThisNode.partialPathName()+"\" ";
+        cmd += i;
+        MGlobal::executeCommandOnIdle(cmd);
+    }
+    
+    return (st.latest >= 0) ? st.results[st.latest].result.asChar() : NULL;
 }
 
-void spReticleLoc::drawCustomTextElements(GPURenderer* renderer)
+// This evaluates the script of a script text item and caches its result for
+// the current frame, which is not necessarily the frame the evaluation was
+// queued at, as the idle queue hardly runs during playback. It is called
+// from the idle queue through the spReticleLocEvalText command.
+//
+void spReticleLoc::evalScriptText(int i)
 {
-    if (!text.size())
+    if (!scriptTextEnabled || i < 0 || i >= (int)scriptText.size())
+        return;
+    
+    ScriptText &st = scriptText[i];
+    if (!st.pending)
         return;
+    
+    double frame = MAnimControl::currentTime().as(MTime::uiUnit());
+    
+    MString result;
+    MStatus stat;
+    if (st.python)
+        stat = MGlobal::executePythonCommand(st.script, result);
+    else
+        stat = MGlobal::executeCommand(st.script, result);
+    
+    if (!stat)
+    {
+        MGlobal::displayWarning( name() + " script for text item " + i + " failed: " + st.script );
+        result = "";
+    }
+    
+    // Replace the result of the frame, or the oldest one once the cache is
+    // full
+    int slot = -1;
+    for (size_t j = 0; j < st.results.size(); j++)
+    {
+        if (st.results[j].frame == frame)
+            slot = int(j);
+    }
+    if (slot < 0)
+    {
+        if ((int)st.results.size() < SCRIPT_TEXT_CACHE_FRAMES)
+            st.results.push_back(ScriptResult());
+        slot = st.next;
+        st.next = (st.next + 1) % SCRIPT_TEXT_CACHE_FRAMES;
+    }
+    
+    st.results[slot].frame = frame;
+    st.results[slot].result = result;
+    st.latest = slot;
+    st.pending = false;
+    
+    // Redraw with the new result
+#if MAYA_API_VERSION >= 201600
+    M3dView::scheduleRefreshAllViews();
+#else
+    M3dView::active3dView().scheduleRefresh();
+#endif
+}
 
-    TextData *td;
+RenderStats spReticleLoc::totalStats() const
+{
+    RenderStats total = oglStats;
+    for (int i = 0; i < MAX_VIEW_STATES; i++)
+        total.add(viewStats[i]);
+    return total;
+}
 
-    // Make sure everything is ready for drawing text
-    renderer->enableTextRendering();
+void spReticleLoc::resetStats()
+{
+    oglStats.reset();
+    for (int i = 0; i < MAX_VIEW_STATES; i++)
+        viewStats[i].reset();
+}
 
-    Geom g;
-    for (int i = 0; i < (int)text.size(); i++)
-    {
-        td = &text[i];
+// This returns whether the reticle is drawn through a camera. The settings
+// are read first; the decision for the camera is then cached until the
+// settings change or a callback sees the camera or the cameras attribute
+// change, so that views that never show the reticle cost almost nothing.
+//
+bool spReticleLoc::isVisible(const MDagPath & cameraPath)
+{
+    MStatus stat;
+    MPlug p;
 
-        // If the text is not enabled, skip it
-        if (!td->textEnabled)
-            continue;
+    // Get the settings, computing them if they changed. Under the Evaluation
+    // Manager they have already been computed and this only reads the value.
+    int version;
+    p = MPlug ( thisNode, ConfigVersion );
+    McheckStatus ( p.getValue ( version ), "spReticleLoc::isVisible get configVersion");
 
-        MColor textColor = options.textColor;
+    // Drawing not enabled, return
+    if (!settings.options.drawingEnabled)
+        return false;
 
-        // Process dynamic text
-        if (td->textType && !calcDynamicText(td, i))
-            continue;
+    MObject cameraObj = cameraPath.node();
 
-        // Determine the level geometry
-        if (!getTextLevelGeometry(td, g, i))
-            continue;
+    CameraVisibility *cv = NULL;
+    for (size_t i = 0; i < cameraVisibility.size(); i++)
+    {
+        if (cameraVisibility[i].camera.isValid() && cameraVisibility[i].camera.objectRef() == cameraObj)
+        {
+            cv = &cameraVisibility[i];
+            break;
+        }
+    }
 
-        // Determine the position
-        double x,y;
-        if (!calcTextPosition(td,g,x,y,i))
-            continue;
+    if (cv && cv->valid && cv->configVersion == version)
+        return cv->visible;
+
+    bool cacheable = true;
+
+    if (!cv)
+    {
+        // Forget the cameras that were deleted
+        for (size_t i = 0; i < cameraVisibility.size(); )
+        {
+            if (!cameraVisibility[i].camera.isValid())
+            {
+                MMessage::removeCallback(cameraVisibility[i].callback);
+                cameraVisibility.erase(cameraVisibility.begin() + i);
+            }
+            else
+                i++;
+        }
+
+        MCallbackId callback = MNodeMessage::addAttributeChangedCallback(cameraObj, cameraChanged, this, &stat);
+        if (!stat)
+        {
+            stat.perror("spReticleLoc::isVisible adding camera callback");
+            return cameraVisible(cameraPath, cacheable);
+        }
 
-        // Actually draw the text
-        renderer->drawText( td, x, y);
+        CameraVisibility entry;
+        entry.camera = MObjectHandle(cameraObj);
+        entry.callback = callback;
+        cameraVisibility.push_back(entry);
+        cv = &cameraVisibility.back();
     }
 
-    // Disable text rendering
-    renderer->disableTextRendering();
+    cv->visible = cameraVisible(cameraPath, cacheable);
+    cv->configVersion = version;
+    cv->valid = cacheable;
+
+    return cv->visible;
 }
 
-// This updates the data in order to get things ready for drawing
+// This decides whether the reticle is drawn through a camera from the
+// camera and the camera filter mode. cacheable is set to false when the
+// decision depends on a value that no callback notices changing.
 //
-bool spReticleLoc::prepForDraw(const MObject & node, const MDagPath & path, const MDagPath & cameraPath)
+bool spReticleLoc::cameraVisible(const MDagPath & cameraPath, bool & cacheable) const
 {
     MStatus stat;
-    MPlug p;
-
-    // Initialize maximumDist
-    maximumDist = 0;
-
-#if SOURCE_MEL_SCRIPT
-    // If this is the first time it's being draw, load the default values
-    if (loadDefault)
-    {
-        MString tag;
-        p = MPlug ( thisNode, Tag );
-        McheckStatus ( p.getValue ( tag  ), "spReticleLoc::draw get tag");
-        
-        MString cmd = "if (exists(\"" SOURCE_MEL_METHOD "\")) "SOURCE_MEL_METHOD"(\""+path.partialPathName()+"\",\""+tag+"\")";
-        MGlobal::executeCommand(cmd);
-        loadDefault = false;
-    }
-#endif
-
-    // Get options
-    if (needRefresh)
-        getOptions();
-
-    // Drawing not enabled, return
-    if (!options.drawingEnabled)
-        return false;
 
     // Set the MFnCamera to the current camera
-    camera.setObject( cameraPath );
+    MFnCamera camera( cameraPath );
 
     // If camera is orthographic, then return
     if (camera.isOrtho()) 
@@ -1600,7 +1384,7 @@ bool spReticleLoc::prepForDraw(const MObject & node, const MDagPath & path, cons
     bool useReticle = false;
 
     //
-    switch (options.cameraFilterMode)
+    switch (settings.options.cameraFilterMode)
     {
         // Draw in all cameras
         case 0:
@@ -1612,10 +1396,12 @@ bool spReticleLoc::prepForDraw(const MObject & node, const MDagPath & path, cons
             // Find the CAMERA_ATTR plug on the camera node
             MPlug useReticlePlug = camera.findPlug(CAMERA_ATTR, &stat);
 
-            // If the plug is valid (not null) get the current value
+            // If the plug is valid (not null) get the current value. A
+            // driven plug changes without notice, so it is read every time.
             if (!useReticlePlug.isNull())
             {
-                McheckStatus ( useReticlePlug.getValue( useReticle ), "spReticleLoc::draw get CAMERA_ATTR plug");
+                McheckStatus ( useReticlePlug.getValue( useReticle ), "spReticleLoc::cameraVisible get CAMERA_ATTR plug");
+                cacheable = !useReticlePlug.isConnected();
             }
 
             // If camera is not set to use reticle then return
@@ -1658,401 +1444,267 @@ bool spReticleLoc::prepForDraw(const MObject & node, const MDagPath & path, cons
         }
     }
 
-    // Get the camera position
-    MMatrix wm = cameraPath.inclusiveMatrix();
+    return true;
+}
 
-    // Find the largest component
-    if (options.maximumDistance > 0)
-    {
-        // original: largest value
-        //maximumDist = std::max(wm[3][0],std::max(wm[3][1],wm[3][2]));
+// Attribute changes that can change whether a reticle is drawn through a
+// camera
+static const int visibilityMessages = MNodeMessage::kAttributeSet |
+                                      MNodeMessage::kConnectionMade |
+                                      MNodeMessage::kConnectionBroken |
+                                      MNodeMessage::kAttributeAdded |
+                                      MNodeMessage::kAttributeRemoved;
+
+// This callback invalidates the cached visibility of a camera when its
+// orthographic setting or its CAMERA_ATTR attribute is set, connected,
+// added or removed. The other attributes of the camera, animated focal
+// lengths and apertures among them, keep the cached decision.
+//
+void spReticleLoc::cameraChanged(MNodeMessage::AttributeMessage msg, MPlug & plug, MPlug & otherPlug, void * clientData)
+{
+    if (!(msg & visibilityMessages))
+        return;
 
-        // largest absolute value (if negative, returns positive number)
-        //maximumDist = std::max(fabs(wm[3][0]),std::max(fabs(wm[3][1]),fabs(wm[3][2])));
+    MString name = plug.partialName(false, false, false, false, false, true);
+    if (name != "orthographic" && name != CAMERA_ATTR)
+        return;
 
-        // largest value (if negative, returns negative number)
-        double maxDist = std::max(wm[3][0],std::max(wm[3][1],wm[3][2]));
-        double minDist = std::min(wm[3][0],std::min(wm[3][1],wm[3][2]));
-        maximumDist = (fabs(maxDist) > fabs(minDist)) ? maxDist : minDist;
+    spReticleLoc *reticle = static_cast<spReticleLoc*>(clientData);
+
+    MObject cameraObj = plug.node();
+    for (size_t i = 0; i < reticle->cameraVisibility.size(); i++)
+    {
+        CameraVisibility &cv = reticle->cameraVisibility[i];
+        if (cv.camera.isValid() && cv.camera.objectRef() == cameraObj)
+            cv.valid = false;
     }
+}
 
-    // Get the camera's overscan value
-    overscan = (options.useOverscan) ? 1.0 : camera.overscan();
-    ncp = camera.nearClippingPlane() + 0.001;
+// This callback invalidates the cached visibility of every camera when a
+// camera is connected to or disconnected from the cameras attribute.
+//
+void spReticleLoc::camerasChanged(MNodeMessage::AttributeMessage msg, MPlug & plug, MPlug & otherPlug, void * clientData)
+{
+    if (!(msg & (MNodeMessage::kConnectionMade | MNodeMessage::kConnectionBroken)) || plug.attribute() != Cameras)
+        return;
 
-    // Get the worldInverseMatrix
-    wim = getMatrix("worldInverseMatrix");
+    spReticleLoc *reticle = static_cast<spReticleLoc*>(clientData);
 
-    // Get the text data
-    getTextData();
+    for (size_t i = 0; i < reticle->cameraVisibility.size(); i++)
+        reticle->cameraVisibility[i].valid = false;
+}
 
-    // Update aspect ratios
-    if (needToUpdateAspectRatios() || needRefresh)
+// Whether the dynamic text of the given type changes with the frame, either
+// directly or through the camera, which can be animated
+//
+static bool isFrameDependent(int textType)
+{
+    switch (textType)
     {
-        // Get the aspect ratio data
-        getAspectRatioData();
+        case 1:						//Lens
+        case 2:						//Camera
+        case 3:						//Frame
+        case 5:						//Maximum Distance
+        case 22:						//MEL Script
+        case 23:						//Python Script
+            return true;
+        default:
+            return false;
     }
+}
 
-    // Check to see if we need to refresh the data
-    if (needRefresh)
-    {
-        // Get the pad attribute data
-        getPadData();
+// Queue setting the film aperture of the camera to the one of the reticle.
+// The values are written with 17 significant digits, so that the camera
+// ends up with exactly the values of the reticle. A request is kept per
+// camera until the camera has the aperture, and only queued again when the
+// reticle asks for another one, so a camera that can't be set, locked for
+// instance, isn't set again on every draw.
+//
+void spReticleLoc::driveCameraAperture( MFnCamera & camera, const MDagPath & cameraPath )
+{
+    MObject cameraObj = cameraPath.node();
+    double horizontal = settings.filmback.horizontalFilmAperture;
+    double vertical = settings.filmback.verticalFilmAperture;
 
-        // Get the filmback attribute data
-        getFilmbackData();
+    // Forget the deleted cameras
+    size_t index = apertureRequests.size();
+    for (size_t i = 0; i < apertureRequests.size(); )
+    {
+        if (!apertureRequests[i].camera.isValid())
+        {
+            apertureRequests.erase(apertureRequests.begin() + i);
+            continue;
+        }
 
-        // Get the projection gate attribute data
-        getProjectionData();
+        if (apertureRequests[i].camera.objectRef() == cameraObj)
+            index = i;
+        i++;
+    }
 
-        // Get safe title and safe action data
-        getSafeActionData();
-        getSafeTitleData();
+    if (fabs(camera.horizontalFilmAperture() - horizontal) <= EPSILON &&
+        fabs(camera.verticalFilmAperture() - vertical) <= EPSILON)
+    {
+        // The camera has the aperture
+        if (index < apertureRequests.size())
+            apertureRequests.erase(apertureRequests.begin() + index);
+        return;
+    }
 
-        // Get pan and scan data
-        getPanScanData( panScan );
+    if (index == apertureRequests.size())
+    {
+        apertureRequests.push_back(ApertureRequest());
+        apertureRequests[index].camera = cameraObj;
+    }
+    else if (apertureRequests[index].horizontal == horizontal && apertureRequests[index].vertical == vertical)
+        return;
 
-        // Hold this copy
-        oFilmback = filmback;
+    apertureRequests[index].horizontal = horizontal;
+    apertureRequests[index].vertical = vertical;
 
-        // Reset need refresh
-        needRefresh = false;
-    }
-	
-	return true;
+    MString cameraName = cameraPath.fullPathName();
+    MString h, v;
+    h.set( horizontal, 17 );
+    v.set( vertical, 17 );
+    MGlobal::executeCommandOnIdle( "setAttr " + cameraName + ".horizontalFilmAperture " + h +
+                                   "; setAttr " + cameraName + ".verticalFilmAperture " + v );
 }
 
-// This is the main function which draws the locator.
+// This updates the data in order to get things ready for drawing
 //
-void spReticleLoc::drawBase(int width, int height, GPURenderer* renderer)
+// During playback, only what changes with the frame is updated: the text
+// that does not depend on the frame or the camera is kept as resolved for
+// the previous frame of the view, and the shot metadata isn't looked up
+// again. The settings are still pulled, a change restarts the view.
+//
+bool spReticleLoc::prepForDraw(const MObject & node, const MDagPath & path, const MDagPath & cameraPath, CameraState & cam)
 {
-	portWidth = double(width);
-	portHeight = double(height);
-	
-    // Calculate the port geometry
-    calcPortGeom();
+    MStatus stat;
+    MPlug p;
 
-    // Peform the calculations necessary to define the filmback geometry.
-    calcFilmbackGeom();
+    // Initialize maximumDist
+    cam.maximumDist = 0;
 
-    // Calculate the projection gate geometry
-    if (filmback.displayProjGate)
-        calcMaskGeom(filmback.projGeom,filmback.horizontalProjectionGate,filmback.verticalProjectionGate,filmback.imageGeom,filmback.horizontalImageAperture,filmback.verticalImageAperture);
+#if SOURCE_MEL_SCRIPT
+    // If this is the first time it's being draw, load the default values.
+    // The script is run from the idle queue as it edits the node.
+    if (loadDefault)
+    {
+        MString tag;
+        p = MPlug ( thisNode, Tag );
+        McheckStatus ( p.getValue ( tag  ), "spReticleLoc::draw get tag");
+        
+        MString cmd = "if (exists(\"" SOURCE_MEL_METHOD "\")) "SOURCE_MEL_METHOD"(\""+path.partialPathName()+"\",\""+tag+"\")";
+        MGlobal::executeCommandOnIdle(cmd);
+        loadDefault = false;
+    }
+#endif
 
-    // Calculate the safe action geometry
-    if (filmback.displaySafeAction)
-        calcFilmbackSafeActionGeom();
+    // Reject the cameras the reticle isn't drawn through
+    if (!isVisible(cameraPath))
+        return false;
 
-    // Calculate the safe title geometry
-    if (filmback.displaySafeTitle)
-        calcFilmbackSafeTitleGeom();
+    bool playing = MAnimControl::isPlaying();
 
-    // Calculate the projection gate geometry
-    if (panScan.displayMode != 0)
-        calcPanScanGeom( panScan );
+    // Pick up a modified shot metadata index
+    if (!playing)
+        shotMetadata.refresh();
 
-    // Calculate the aspect ratio geometry
-    for (int i = 0; i < numAspectRatios; i++ )
-    {
-        // Only calculate the aspect geom if the display mode != 0
-        if (ars[i].displayMode != 0)
-        {
-            calcAspectGeom( ars[i] );
-        }
-    }
-    
-    // Set the filmback for the renderer
-    renderer->setFilmback(&filmback);
+    // Set the MFnCamera to the current camera
+    MFnCamera camera( cameraPath );
 
-    // Get everything setup for rendering
-    renderer->prepareForDraw(portWidth, portHeight);
-    
-    // create variable to store what the first geometry object to draw aspect ratios to
-    Geom aspectContainerGeom = portGeom;
-    Geom filmbackGeom = filmback.filmbackGeom;
+    // Get the camera position
+    MMatrix wm = cameraPath.inclusiveMatrix();
 
-    // Draw the filmback
-    if ( filmback.displayFilmGate )
+    // Find the largest component
+    if (settings.options.maximumDistance > 0)
     {
-        // Draw filmback Mask
-        if ( filmback.displayFilmGate == 3 )
-        {
-            renderer->drawMask(aspectContainerGeom, filmbackGeom, filmback.filmbackGeom.maskColor, 1);
-            aspectContainerGeom = filmback.filmbackGeom;
-        }
-        
-        // Draw filmback Line
-        renderer->drawLines(filmback.filmbackGeom, filmback.filmbackGeom.lineColor, 1, filmback.displayFilmGate == 2);
-        
-        // Draw Sound Area Line
-        if ( filmback.soundTrackWidth > EPSILON )
-            renderer->drawLine(filmback.imageGeom.x1, filmback.imageGeom.x1, filmback.imageGeom.y1, filmback.imageGeom.y2, filmback.imageGeom.lineColor, 0 );
-    }
+        // original: largest value
+        //maximumDist = std::max(wm[3][0],std::max(wm[3][1],wm[3][2]));
 
-    // Draw the padGeomMask
-    if (pad.usePad && pad.isPadded)
-    {
-        if (pad.displayMode == 3)
-            renderer->drawMask(aspectContainerGeom, pad.padGeom, pad.padGeom.maskColor, true);
-        aspectContainerGeom = pad.padGeom;
-    }
-    
-    // Draw all the aspectRatios
+        // largest absolute value (if negative, returns positive number)
+        //maximumDist = std::max(fabs(wm[3][0]),std::max(fabs(wm[3][1]),fabs(wm[3][2])));
 
-    // Draw the masks first
-    Aspect_Ratio ar;
-    for (int i = 0; i < numAspectRatios; i++ )
-    {
-        ar = ars[i];
-        // Draw the masks as Quads
-        if (ar.displayMode == 3)
-        {
-            Geom g = (i == 0)?aspectContainerGeom:ars[i-1].aspectGeom;
-            MColor maskColor = ar.aspectGeom.maskColor;
-            // Draw the mask in red if over the max distance
-            if (options.maximumDistance > 0 &&
-                fabs(maximumDist) >= options.maximumDistance)
-            {
-                if (i == 0)
-                {
-                    maskColor = MColor(1,0,0,maskColor.a);
-                }
-                else
-                {
-                    maskColor *= MColor(1.5,0.5,0.5,1);
-                }
-            }
-            //drawMask(g, ar.aspectGeom, maskColor, (i == 0 && !(pad.usePad && pad.isPadded)) );
-            renderer->drawMask(g, ar.aspectGeom, maskColor, i == 0);
-            
-            if ( ar.displaySafeAction == 3 )
-            {
-                float sf = (ar.displaySafeTitle == 3) ? 0.66 : 0.5;
-                MColor c = MColor(maskColor.r,maskColor.g,maskColor.b,1+((maskColor.a-1) * sf));
-                renderer->drawMask(ar.aspectGeom,ar.safeActionGeom,c,true);
-            }
-            if ( ar.displaySafeTitle == 3 )
-            {
-                float sf = (panScan.displaySafeAction == 3) ? 0.33 : 0.5;
-                MColor c = MColor(maskColor.r,maskColor.g,maskColor.b,1+((maskColor.a-1) * sf));
-                if ( ar.displaySafeAction == 3 )
-                    renderer->drawMask(ar.safeActionGeom,ar.safeTitleGeom,c,true);
-                else
-                    renderer->drawMask(ar.aspectGeom,ar.safeTitleGeom,c,true);
-            }
-        }
+        // largest value (if negative, returns negative number)
+        double maxDist = std::max(wm[3][0],std::max(wm[3][1],wm[3][2]));
+        double minDist = std::min(wm[3][0],std::min(wm[3][1],wm[3][2]));
+        cam.maximumDist = (fabs(maxDist) > fabs(minDist)) ? maxDist : minDist;
     }
 
-    // Draw lines
-    for (int i = 0; i < numAspectRatios; i++ )
-    {
-        ar = ars[i];
+    // Get the camera's overscan value
+    cam.overscan = (settings.options.useOverscan) ? 1.0 : camera.overscan();
+    ncp = camera.nearClippingPlane() + 0.001;
 
-        if (ar.displayMode != 0)
-        {
-            bool sides = (i == 0 || (fabs(ar.aspectGeom.x - ars[i].aspectGeom.x) > EPSILON) );
-            renderer->drawLines(ar.aspectGeom, ar.aspectGeom.lineColor, sides, ar.displayMode == 2);
-            // Draw safe action
-            if (ar.displaySafeAction)
-                renderer->drawLines( ar.safeActionGeom, ar.safeActionGeom.lineColor, true, ar.displaySafeAction == 2);
-
-            // Draw safe title
-            if (ar.displaySafeTitle)
-                renderer->drawLines( ar.safeTitleGeom, ar.safeTitleGeom.lineColor, true, ar.displaySafeTitle == 2);
-        }
-    }
+    // Get the worldInverseMatrix
+    wim = getMatrix("worldInverseMatrix");
+
+    // If drive camera aperture is on, then set camera values. The camera is
+    // set from the idle queue, and the draw picks the values up once set.
+    if (settings.filmback.horizontalFilmAperture >= 0 && settings.options.driveCameraAperture)
+        driveCameraAperture( camera, cameraPath );
 
-    // Draw the panScan
-    if ( panScan.displayMode != 0 )
+    getCameraState( camera, cam );
+
+    // Resolve the dynamic text for this camera. The items that cannot be
+    // displayed are disabled.
+    bool keepText = playing && cam.configVersion == settings.configVersion && cam.text.size() == text.size();
+    if (!keepText)
+        cam.text = text;
+    cam.configVersion = settings.configVersion;
+
+    if (settings.options.enableTextDrawing)
     {
-        if (panScan.displayMode == 2)
+        for (int i = 0; i < (int)cam.text.size(); i++)
         {
-            renderer->drawMask(filmback.imageGeom, panScan.aspectGeom, panScan.aspectGeom.maskColor, true, false );
-            
-            Geom g = panScan.aspectGeom;
-            
-            if ( panScan.displaySafeAction == 3 )
+            if (keepText)
             {
-                float sf = (panScan.displaySafeTitle == 3) ? 0.66 : 0.5;
-                MColor c = MColor(panScan.aspectGeom.maskColor.r,panScan.aspectGeom.maskColor.g,panScan.aspectGeom.maskColor.b,1+((panScan.aspectGeom.maskColor.a-1) * sf));
-                renderer->drawMask(panScan.aspectGeom,panScan.safeActionGeom, c, true );
-                g = panScan.safeActionGeom;
-            }
-            
-            if ( panScan.displaySafeTitle == 3 )
-            {
-                float sf = (panScan.displaySafeAction == 3) ? 0.33 : 0.5;
-                MColor c = MColor(panScan.aspectGeom.maskColor.r,panScan.aspectGeom.maskColor.g,panScan.aspectGeom.maskColor.b,1+((panScan.aspectGeom.maskColor.a-1) * sf));
-                renderer->drawMask(g,panScan.safeTitleGeom, c, true );
+                if (!isFrameDependent(text[i].textType))
+                    continue;
+                cam.text[i] = text[i];
             }
-        }
-        
-        renderer->drawLines(panScan.aspectGeom, panScan.aspectGeom.lineColor, 1, 0);
-        
-        // Draw safe action
-        if (panScan.displaySafeAction)
-        {
-            renderer->drawLines( panScan.safeActionGeom, panScan.safeActionGeom.lineColor, true, panScan.displaySafeAction == 2);
-        }
 
-        // Draw safe title
-        if (panScan.displaySafeTitle)
-        {
-            renderer->drawLines( panScan.safeTitleGeom, panScan.safeTitleGeom.lineColor, true, panScan.displaySafeTitle == 2);
+            TextData *td = &cam.text[i];
+            if (td->textEnabled && td->textType && !calcDynamicText(cam, td, i))
+                td->textEnabled = false;
         }
     }
+	
+	return true;
+}
 
-    // Draw the projection gate
-    if ( filmback.displayProjGate )
-    {
-        if ( filmback.displayProjGate == 3 )
-            renderer->drawMask(filmback.filmbackGeom, filmback.projGeom, filmback.projGeom.maskColor, 1);
-        
-        renderer->drawLines(filmback.projGeom, filmback.projGeom.lineColor, 1, filmback.displayProjGate == 2);
-    }
-
-    // Draw filmback safe action
-    if (filmback.displaySafeAction)
-    {
-        renderer->drawLines( filmback.safeActionGeom, filmback.safeActionGeom.lineColor, 1, filmback.displaySafeAction == 2);
-    }
+// This reads the camera settings the reticle geometry depends on.
+//
+void spReticleLoc::getCameraState( MFnCamera & camera, CameraState & cam )
+{
+    cam.name = camera.name();
+    cam.focalLength = camera.focalLength();
+    cam.horizontalFilmAperture = camera.horizontalFilmAperture();
+    cam.verticalFilmAperture = camera.verticalFilmAperture();
+    cam.lensSqueezeRatio = camera.lensSqueezeRatio();
+    cam.filmFit = camera.filmFit();
 
-    // Draw filmback safe title
-    if (filmback.displaySafeTitle)
-    {
-        renderer->drawLines( filmback.safeTitleGeom, filmback.safeTitleGeom.lineColor, 1, filmback.displaySafeTitle == 2);
-    }
+    cam.panX = 0.0;
+    cam.panY = 0.0;
+    cam.zoom = 1.0;
 
-    // Display horizontal line
-    if ( options.displayLineH )
+#if MAYA_API_VERSION >= 201100
+    if (camera.panZoomEnabled() && !camera.renderPanZoom())
     {
-        renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, portGeom.y, portGeom.y, options.lineColor, 0 );
+        cam.zoom = camera.zoom();
+        cam.panX = camera.horizontalPan();
+        cam.panY = camera.verticalPan();
     }
+#endif
+}
 
-    // Display vertical line
-    if ( options.displayLineV )
-    {
-        double cx = ( filmback.imageGeom.x1 + filmback.imageGeom.x2 ) / 2;
-        renderer->drawLine( cx, cx, filmback.imageGeom.y1, filmback.imageGeom.y2, options.lineColor, 0 );
-    }
-
-    // Display Horizontal Thirds
-    if ( options.displayThirdsH)
-    {
-        Geom g = aspectContainerGeom;
-        double y1 = g.y1+ ( ( g.y2 - g.y1 ) * 0.33 );
-        double y2 = g.y1+ ( ( g.y2 - g.y1 ) * 0.66 );
-        renderer->drawLine( g.x1, g.x2, y1, y1, options.lineColor, 0 );
-        renderer->drawLine( g.x1, g.x2, y2, y2, options.lineColor, 0 );
-    }
-
-    // Display Vertical Thirds
-    if ( options.displayThirdsV)
-    {
-        Geom g = aspectContainerGeom;
-        double x1 = g.x1+ ( ( g.x2 - g.x1 ) * 0.33 );
-        double x2 = g.x1+ ( ( g.x2 - g.x1 ) * 0.66 );
-        renderer->drawLine( x1, x1, g.y1, g.y2, options.lineColor, 0 );
-        renderer->drawLine( x2, x2, g.y1, g.y2, options.lineColor, 0 );
-    }
-
-    // Display crosshair
-    if ( options.displayCrosshair )
-    {
-        double cx = ( filmback.imageGeom.x1 + filmback.imageGeom.x2 ) / 2;
-        renderer->drawLine( cx-25, cx-5, portGeom.y, portGeom.y, options.lineColor, 0 );
-        renderer->drawLine( cx+25, cx+5, portGeom.y, portGeom.y, options.lineColor, 0 );
-        renderer->drawLine( cx, cx, portGeom.y-25, portGeom.y-5, options.lineColor, 0 );
-        renderer->drawLine( cx, cx, portGeom.y+25, portGeom.y+5, options.lineColor, 0 );
-    }
-    
-    // Display Field Guide
-    if ( options.displayFieldGuide)
-    {
-        //Calculate constants
-        int numLines = FIELDGUIDE_NUM_LINES;
-
-        double cx = ( filmback.imageGeom.x1 + filmback.imageGeom.x2 ) / 2.0;
-        double cy = ( filmback.imageGeom.y1 + filmback.imageGeom.y2 ) / 2.0;
-
-        double sx = (filmback.imageGeom.x / 2.0) / double(numLines+1);
-        double sy = (filmback.imageGeom.y / 2.0) / double(numLines+1);
-        
-        //If the filmback is not being drawn, then draw lines for it
-        if ( !filmback.displayFilmGate )
-            renderer->drawLines(filmback.filmbackGeom, options.lineColor, 1, 0);
-
-        //Draw field guide lines
-        for (int i = 1; i <= numLines; i++)
-        {
-            //Draw horizontal lines
-            double lx = sx * i;
-            double lx1 = filmback.imageGeom.x1 + lx;
-            double lx2 = filmback.imageGeom.x2 - lx;
-            
-            renderer->drawLine( lx1, lx1, filmback.imageGeom.y1, filmback.imageGeom.y2, options.lineColor, 0);
-            renderer->drawLine( lx2, lx2, filmback.imageGeom.y1, filmback.imageGeom.y2, options.lineColor, 0);
-            
-            //Draw vertical lines
-            double ly = sy * i;
-            double ly1 = filmback.imageGeom.y1 + ly;
-            double ly2 = filmback.imageGeom.y2 - ly;
-            
-            renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, ly1, ly1, options.lineColor, 0);
-            renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, ly2, ly2, options.lineColor, 0);
-        }
-
-        //Draw center lines
-        renderer->drawLine( cx, cx, filmback.imageGeom.y1, filmback.imageGeom.y2, options.lineColor, 0);
-        renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, cy, cy, options.lineColor, 0);
-        
-        //Draw Diagonal lines
-        renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, filmback.imageGeom.y1, filmback.imageGeom.y2, options.lineColor, 0);
-        renderer->drawLine( filmback.imageGeom.x1, filmback.imageGeom.x2, filmback.imageGeom.y2, filmback.imageGeom.y1, options.lineColor, 0);
-
-        //Draw Numbers
-        TextData td;
-        td.textAlign = 1;
-        td.textVAlign = 1;
-        td.textSize = 12;
-        td.textBold = false;
-        td.textColor = options.textColor;
-        td.textPosX = 0;
-        td.textPosY = 0;
-
-        renderer->enableTextRendering();
-        for (int i = 1; i <= numLines; i++)
-        {
-            double lx = sx * i;
-            double lx1 = filmback.imageGeom.x1 + lx;
-            double lx2 = filmback.imageGeom.x2 - lx;
-
-            double ly = sy * i;
-            double ly1 = filmback.imageGeom.y1 + ly;
-            double ly2 = filmback.imageGeom.y2 - ly;
-
-            //Draw text
-            td.textStr.set((numLines - i)+1);
-            renderer->drawText(&td,lx1,ly1);
-            renderer->drawText(&td,lx2,ly1);
-            renderer->drawText(&td,lx1,ly2);
-            renderer->drawText(&td,lx2,ly2);
-        }
-        renderer->disableTextRendering();
-    }
-
-    // Display the pad area
-    if (pad.usePad && pad.isPadded && pad.displayMode > 0)
-    {
-        renderer->drawLines(pad.padGeom, pad.padGeom.lineColor, 1, pad.displayMode == 2);
-    }
-
-    // Draw custom text elements
-    if ( options.enableTextDrawing )
-        drawCustomTextElements(renderer);
+// This is the main function which draws the locator, with the settings read
+// by compute. See drawReticle.
+//
+bool spReticleLoc::drawBase(int width, int height, const CameraState & cam, Layout & layout, GPURenderer* renderer) const
+{
+    // The GPU times are only read back for the statistics label
+    renderer->setGPUTimers(settings.options.displayStats);
 
-    // Clean-up after draw
-    renderer->postDraw();
+    return drawReticle(settings, cam, width, height, layout, renderer);
 }
 
 // This is the main function which draws the locator. It is called
@@ -2070,14 +1722,15 @@ void spReticleLoc::draw(M3dView & view, const MDagPath & path,
     view.getCamera(cameraPath);
 
     // Prep the data for drawing
-    if (!prepForDraw(thisMObject(), path, cameraPath))
+    if (!prepForDraw(thisMObject(), path, cameraPath, oglCamera))
         return;
 	
     // Get the view ready for drawing
     view.beginGL();
 
     // Perform the draw
-    drawBase(view.portWidth(), view.portHeight(), &oglRenderer);
+    oglRenderer.setStats(&oglStats);
+    drawBase(view.portWidth(), view.portHeight(), oglCamera, oglLayout, &oglRenderer);
 	
     // End of openGL calls
     view.endGL();
@@ -2122,12 +1775,17 @@ void spReticleLoc::postConstructor()
     // Load defaults
     loadDefault = SOURCE_MEL_SCRIPT;
 
-    // Set Refresh
-    needRefresh = true;
+    // Nothing ingested or queued yet
+    settings.configVersion = 0;
+    timeConnectQueued = false;
 
     // Initialize thisNode
     thisNode = thisMObject();
 
+    // Watch the connections of the cameras attribute
+    nodeCallback = MNodeMessage::addAttributeChangedCallback(thisNode, camerasChanged, this, &stat);
+    McheckVoid ( stat, "spReticleLoc::postConstructor, unable to add attribute changed callback");
+
     // Create aliases for deprecated node attributes
     MFnDependencyNode fnThisNode( thisNode );
 
@@ -2427,6 +2085,9 @@ MStatus spReticleLoc::initialize()
     eAttr.addField("Pan/Scan Offset",18);
     eAttr.addField("safe action",19);
     eAttr.addField("safe title",20);
+    eAttr.addField("Shot Metadata",21);
+    eAttr.addField("MEL Script",22);
+    eAttr.addField("Python Script",23);
     eAttr.setInternal(true);
 
     TextStr = tAttr.create( "textStr", "tstr", MFnStringData::kString );
@@ -2517,6 +2178,11 @@ MStatus spReticleLoc::initialize()
     eAttr.addField("Top", 2);
     eAttr.setInternal(true);
 
+    TextSource = tAttr.create( "textSource", "tsrc", MFnStringData::kString );
+    McheckStatus(stat,"create textSource attribute");
+    tAttr.setDefault(defaultTextAttr);
+    tAttr.setInternal(true);
+
     Text = cAttr.create( "text", "txt", &stat );
     McheckStatus(stat,"create text attribute");
     cAttr.addChild( TextType );
@@ -2533,6 +2199,7 @@ MStatus spReticleLoc::initialize()
     cAttr.addChild( TextSize );
     cAttr.addChild( TextScale );
     cAttr.addChild( TextVAlign );
+    cAttr.addChild( TextSource );
     cAttr.setArray( true );
     cAttr.setIndexMatters( true );
 
@@ -2559,6 +2226,12 @@ MStatus spReticleLoc::initialize()
     nAttr.setMax(1.0);
     nAttr.setInternal(true);
 
+    LineWidth = nAttr.create( "lineWidth", "lw", MFnNumericData::kFloat, 1.0, &stat );
+    McheckStatus(stat,"create lineWidth attribute");
+    nAttr.setMin(1.0);
+    nAttr.setSoftMax(10.0);
+    nAttr.setInternal(true);
+
     FilmGateMaskColor = nAttr.createColor( "filmGateMaskColor", "fgmc", &stat );
     McheckStatus(stat,"create filmGateMaskColor attribute");
     nAttr.setDefault( 0.0, 0.0, 0.0 );
@@ -2651,9 +2324,26 @@ MStatus spReticleLoc::initialize()
     McheckStatus(stat,"create displayFieldGuide attribute");
     nAttr.setInternal(true);
 
+    DisplayStats = nAttr.create( "displayStats", "dsts", MFnNumericData::kBoolean, false, &stat );
+    McheckStatus(stat,"create displayStats attribute");
+    nAttr.setInternal(true);
+
     Time = uAttr.create( "time", "tm", MFnUnitAttribute::kTime, 0.0, &stat );
     McheckStatus(stat,"create time attribute");
 
+    // Outputs computed from the settings and the time, read by the draw
+    ConfigVersion = nAttr.create( "configVersion", "cfv", MFnNumericData::kInt, 0, &stat );
+    McheckStatus(stat,"create configVersion attribute");
+    nAttr.setWritable(false);
+    nAttr.setStorable(false);
+    nAttr.setHidden(true);
+
+    OutTime = uAttr.create( "outTime", "otm", MFnUnitAttribute::kTime, 0.0, &stat );
+    McheckStatus(stat,"create outTime attribute");
+    uAttr.setWritable(false);
+    uAttr.setStorable(false);
+    uAttr.setHidden(true);
+
     DriveCameraAperture = nAttr.create( "driveCameraAperture", "dca", MFnNumericData::kBoolean, false, &stat );
     McheckStatus(stat,"create driveCameraAperture attribute");
     nAttr.setInternal(true);
@@ -2666,6 +2356,11 @@ MStatus spReticleLoc::initialize()
     McheckStatus(stat,"create useOverscan attribute");
     nAttr.setInternal(true);
 
+    ShotMetadataFile = tAttr.create( "shotMetadataFile", "smf", MFnStringData::kString );
+    McheckStatus(stat,"create shotMetadataFile attribute");
+    tAttr.setDefault(defaultTextAttr);
+    tAttr.setInternal(true);
+
     UsePad = nAttr.create( "usePad", "up", MFnNumericData::kBoolean, false, &stat );
     McheckStatus(stat,"create usePad attribute");
     nAttr.setInternal(true);
@@ -2767,6 +2462,8 @@ MStatus spReticleLoc::initialize()
         McheckStatus(stat,"addAttribute lineColor");
     stat = addAttribute (LineTrans);
         McheckStatus(stat,"addAttribute lineTrans");
+    stat = addAttribute (LineWidth);
+        McheckStatus(stat,"addAttribute lineWidth");
     stat = addAttribute (FilmGateMaskColor);
         McheckStatus(stat,"addAttribute filmGateMaskColor");
     stat = addAttribute (FilmGateMaskTrans);
@@ -2801,6 +2498,8 @@ MStatus spReticleLoc::initialize()
         McheckStatus(stat,"addAttribute displayCrosshair");
     stat = addAttribute (DisplayFieldGuide);
         McheckStatus(stat,"addAttribute displayFieldGuide");
+    stat = addAttribute (DisplayStats);
+        McheckStatus(stat,"addAttribute displayStats");
     stat = addAttribute (Time);
         McheckStatus(stat,"addAttribute time");
     stat = addAttribute (DriveCameraAperture);
@@ -2809,10 +2508,38 @@ MStatus spReticleLoc::initialize()
         McheckStatus(stat,"addAttribute maximumDistance");
     stat = addAttribute (UseOverscan);
         McheckStatus(stat,"addAttribute useOverscan");
+    stat = addAttribute (ShotMetadataFile);
+        McheckStatus(stat,"addAttribute shotMetadataFile");
     stat = addAttribute (Pad);
         McheckStatus(stat,"addAttribute pad");
     stat = addAttribute (Tag);
         McheckStatus(stat,"addAttribute tag");
+    stat = addAttribute (ConfigVersion);
+        McheckStatus(stat,"addAttribute configVersion");
+    stat = addAttribute (OutTime);
+        McheckStatus(stat,"addAttribute outTime");
+
+    // Every setting read by compute affects configVersion
+    MObject settings[] = {
+        EnableTextDrawing, DrawingEnabled, FilmbackAperture, RelativeFilmback,
+        SoundTrackWidth, DisplayFilmGate, ProjectionGate, DisplayProjectionGate,
+        SafeAction, DisplaySafeAction, SafeTitle, DisplaySafeTitle,
+        PanScanAttr, AspectRatios, Text, MiscTextColor, MiscTextTrans,
+        LineColor, LineTrans, LineWidth, FilmGateMaskColor, FilmGateMaskTrans,
+        FilmGateLineColor, FilmGateLineTrans, ProjGateMaskColor, ProjGateMaskTrans,
+        ProjGateLineColor, ProjGateLineTrans, CameraFilterMode, DisplayLineH,
+        DisplayLineV, DisplayThirdsH, DisplayThirdsV, DisplayCrosshair,
+        DisplayFieldGuide, DisplayStats, DriveCameraAperture, MaximumDistance,
+        UseOverscan, ShotMetadataFile, Pad };
+
+    for (unsigned int i = 0; i < sizeof(settings) / sizeof(settings[0]); i++)
+    {
+        stat = attributeAffects (settings[i], ConfigVersion);
+            McheckStatus(stat,"attributeAffects configVersion");
+    }
+
+    stat = attributeAffects (Time, OutTime);
+        McheckStatus(stat,"attributeAffects outTime");
 
     return MS::kSuccess;
 }
@@ -2829,10 +2556,89 @@ spReticleLocDrawOverride::~spReticleLocDrawOverride()
 {
 }
 
-#if (MAYA_API_VERSION>=201400 && USE_MUIDRAWMANAGER)
+// The panel drawn by a frame context, empty before Maya 2016 where Viewport
+// 2.0 does not name it
+#if (MAYA_API_VERSION>=201400)
+static MString panelName(const MHWRender::MFrameContext& frameContext)
+{
+    MString panel;
+#if (MAYA_API_VERSION>=201600)
+    frameContext.renderingDestination(panel);
+#endif
+    return panel;
+}
+#endif
+
+// Views are kept per panel, so that resizing a panel re-lays out its view
+// instead of creating new ones, and per camera and size when the panel is
+// not known
+template <class View>
+static bool isView(const View* view, const MString& panel, const MDagPath& cameraPath, int width, int height)
+{
+    if (view->panel != panel)
+        return false;
+    if (panel.length() > 0)
+        return true;
+    return view->camera == cameraPath && view->width == width && view->height == height;
+}
+
+spReticleLocData::~spReticleLocData()
+{
+    for (size_t i = 0; i < views.size(); i++)
+        delete views[i];
+}
+
+void spReticleLocData::setView(const MString& panel, const MDagPath& cameraPath, int width, int height)
+{
+    frame++;
+
+    spReticleLocView* oldest = NULL;
+    for (size_t i = 0; i < views.size(); i++)
+    {
+        if (isView(views[i], panel, cameraPath, width, height))
+        {
+            view = views[i];
+            view->lastUsed = frame;
+            view->camera = cameraPath;
+
+            // The cache texture of the old size is of no use anymore
+            if (view->width != width || view->height != height)
+            {
+                view->renderer.releaseCache();
+                view->width = width;
+                view->height = height;
+            }
+            return;
+        }
+
+        if (!oldest || views[i]->lastUsed < oldest->lastUsed)
+            oldest = views[i];
+    }
+
+    if (views.size() < MAX_VIEW_STATES)
+    {
+        oldest = new spReticleLocView();
+        oldest->index = (unsigned int)views.size();
+        views.push_back(oldest);
+    }
+    else
+    {
+        // The cache texture of the evicted view is rendered again
+        oldest->renderer.releaseCache();
+    }
+
+    view = oldest;
+    view->panel = panel;
+    view->camera = cameraPath;
+    view->width = width;
+    view->height = height;
+    view->lastUsed = frame;
+}
+
+#if (MAYA_API_VERSION>=201400)
 MHWRender::DrawAPI spReticleLocDrawOverride::supportedDrawAPIs() const
 {
-    // this plugin supports both GL and DX
+    // this plugin supports both GL and DX, DX through MUIDrawManager only
     return (MHWRender::kOpenGL | MHWRender::kDirectX11);
 }
 #elif (MAYA_API_VERSION>=201300)
@@ -2880,14 +2686,49 @@ MUserData* spReticleLocDrawOverride::prepareForDraw(
 
     spReticleLoc* reticle = static_cast<spReticleLoc*>(node.userNode());
 
-    bool draw = reticle->prepForDraw(obj,objPath,cameraPath);
+    spReticleLocData* data = static_cast<spReticleLocData*>(oldData);
+    if (!data)
+        data = new spReticleLocData();
 
-    spReticleLocData* data = new spReticleLocData();
+    // Reject the cameras the reticle isn't drawn through before selecting a
+    // view, so that they don't take the place of the views that draw it
+    data->reticle = reticle;
+    if (!reticle->isVisible(cameraPath))
+    {
+        data->draw = false;
+        return data;
+    }
 
+    // Every panel has its own view, and so do the views of the same camera
+    // at different sizes when the panel is not known
+#if (MAYA_API_VERSION < 201400)
+    data->setView(MString(), cameraPath, 0, 0);
+#else
+    int originX, originY, portWidth, portHeight;
+    frameContext.getViewportDimensions(originX, originY, portWidth, portHeight);
+    data->setView(panelName(frameContext), cameraPath, portWidth, portHeight);
+#endif
+
+    bool draw = reticle->prepForDraw(obj,objPath,cameraPath,data->view->cameraState);
     data->reticle = reticle;
-    data->renderer = &renderer;
+    data->renderer = &data->view->renderer;
+    data->backend = RendererBackend::kOpenGL;
     data->draw = draw;
 
+#if (MAYA_API_VERSION>=201400)
+    MHWRender::MRenderer* theRenderer = MHWRender::MRenderer::theRenderer();
+    if (RendererBackend::current() == RendererBackend::kDrawManager ||
+        (theRenderer && !theRenderer->drawAPIIsOpenGL()))
+    {
+        data->renderer = &data->view->drawManagerRenderer;
+        data->backend = RendererBackend::kDrawManager;
+    }
+#endif
+
+    // Every view counts its frames in its own statistics, as views may be
+    // drawn at the same time
+    data->renderer->setStats(&reticle->viewStats[data->view->index]);
+
     return data;
 }
 
@@ -2903,19 +2744,18 @@ void spReticleLocDrawOverride::draw(const MHWRender::MDrawContext& context, cons
     {
         if (drawData->draw)
         {
-            drawData->reticle->drawBase(portWidth, portHeight, drawData->renderer);
+            drawData->reticle->drawBase(portWidth, portHeight, drawData->view->cameraState, drawData->view->layout, drawData->renderer);
         }
     }
 }
 #else
 bool spReticleLocDrawOverride::hasUIDrawables() const
 {
-    return USE_MUIDRAWMANAGER;
+    return true;
 }
 
 void spReticleLocDrawOverride::addUIDrawables( const MDagPath& objPath, MHWRender::MUIDrawManager& drawManager, const MHWRender::MFrameContext& frameContext, const MUserData* data )
 {
-#if (USE_MUIDRAWMANAGER)
     //Get the view attributes that impact drawing
     int oX,oy,portWidth,portHeight;
     frameContext.getViewportDimensions(oX,oy,portWidth,portHeight);
@@ -2923,18 +2763,17 @@ void spReticleLocDrawOverride::addUIDrawables( const MDagPath& objPath, MHWRende
     const spReticleLocData* drawData = static_cast<const spReticleLocData*>(data);
     if (drawData)
     {
-        if (drawData->draw)
+        if (drawData->draw && drawData->backend == RendererBackend::kDrawManager)
         {
-            renderer.setDrawManager(&drawManager);
-            drawData->reticle->drawBase(portWidth, portHeight, &renderer);
+            drawData->view->drawManagerRenderer.setDrawManager(&drawManager);
+            if (drawData->reticle->drawBase(portWidth, portHeight, drawData->view->cameraState, drawData->view->layout, drawData->renderer))
+                RendererBackend::drewFrame(RendererBackend::kDrawManager);
         }
     }
-#endif
 }
 
 void spReticleLocDrawOverride::draw(const MHWRender::MDrawContext& context, const MUserData* data)
 {
-#if (!USE_MUIDRAWMANAGER)
     int portWidth, portHeight;
 
     context.getRenderTargetSize (portWidth, portHeight);
@@ -2942,31 +2781,661 @@ void spReticleLocDrawOverride::draw(const MHWRender::MDrawContext& context, cons
     const spReticleLocData* drawData = static_cast<const spReticleLocData*>(data);
     if (drawData)
     {
-        if (drawData->draw)
+        if (drawData->draw && drawData->backend == RendererBackend::kOpenGL)
         {
-            drawData->reticle->drawBase(portWidth, portHeight, drawData->renderer);
+            if (RendererBackend::requested() == RendererBackend::kAuto && !RendererBackend::decided())
+                RendererBackend::setDevice((const char *)glGetString(GL_RENDERER));
+
+            if (drawData->reticle->drawBase(portWidth, portHeight, drawData->view->cameraState, drawData->view->layout, drawData->renderer))
+                RendererBackend::drewFrame(RendererBackend::kOpenGL);
         }
     }
-#endif
 }
 #endif
 
 #endif
 
 
+#if (MAYA_API_VERSION>=201700)
+
+//---------------------------------------------------------------------------
+// Viewport 2.0 sub-scene override
+//---------------------------------------------------------------------------
+
+static const MString subSceneItemName("spReticleLocTriangles");
+
+spReticleLocSubSceneView::~spReticleLocSubSceneView()
+{
+    releaseBuffers();
+}
+
+void spReticleLocSubSceneView::releaseBuffers()
+{
+    delete positions;
+    delete colors;
+    delete indices;
+    positions = NULL;
+    colors = NULL;
+    indices = NULL;
+    numVertices = 0;
+}
+
+spReticleLocSubSceneOverride::spReticleLocSubSceneOverride(const MObject& obj) :
+    MHWRender::MPxSubSceneOverride(obj),
+    node(obj), shader(NULL), frame(0)
+{
+}
+
+spReticleLocSubSceneOverride::~spReticleLocSubSceneOverride()
+{
+    for (size_t i = 0; i < views.size(); i++)
+        delete views[i];
+
+    MHWRender::MRenderer* theRenderer = MHWRender::MRenderer::theRenderer();
+    if (shader && theRenderer)
+        theRenderer->getShaderManager()->releaseShader(shader);
+}
+
+MHWRender::DrawAPI spReticleLocSubSceneOverride::supportedDrawAPIs() const
+{
+    return MHWRender::kAllDevices;
+}
+
+// The layout depends on the camera and the viewport size, so drawBase runs
+// for every refresh. The buffers are only written when the triangles change.
+//
+bool spReticleLocSubSceneOverride::requiresUpdate(
+                                                  const MHWRender::MSubSceneContainer& /*container*/,
+                                                  const MHWRender::MFrameContext& /*frameContext*/) const
+{
+    return true;
+}
+
+spReticleLocSubSceneView* spReticleLocSubSceneOverride::findView(const MHWRender::MFrameContext& frameContext) const
+{
+    MStatus status;
+    MDagPath cameraPath = frameContext.getCurrentCameraPath(&status);
+    if (!status)
+        return NULL;
+
+    int originX, originY, portWidth, portHeight;
+    frameContext.getViewportDimensions(originX, originY, portWidth, portHeight);
+    MString panel = panelName(frameContext);
+
+    for (size_t i = 0; i < views.size(); i++)
+    {
+        if (isView(views[i], panel, cameraPath, portWidth, portHeight))
+            return views[i];
+    }
+
+    return NULL;
+}
+
+spReticleLocSubSceneView* spReticleLocSubSceneOverride::setView(const MString& panel, const MDagPath& cameraPath, int width, int height)
+{
+    frame++;
+
+    spReticleLocSubSceneView* oldest = NULL;
+    for (size_t i = 0; i < views.size(); i++)
+    {
+        spReticleLocSubSceneView* view = views[i];
+        if (isView(view, panel, cameraPath, width, height))
+        {
+            view->camera = cameraPath;
+            view->width = width;
+            view->height = height;
+            view->lastUsed = frame;
+            return view;
+        }
+
+        if (!oldest || view->lastUsed < oldest->lastUsed)
+            oldest = view;
+    }
+
+    if (views.size() < MAX_VIEW_STATES)
+    {
+        oldest = new spReticleLocSubSceneView();
+        oldest->index = (unsigned int)views.size();
+        oldest->itemName = subSceneItemName;
+        oldest->itemName += (int)views.size();
+        views.push_back(oldest);
+    }
+    else
+    {
+        // The triangles of the recycled view are written again
+        oldest->releaseBuffers();
+    }
+
+    oldest->panel = panel;
+    oldest->camera = cameraPath;
+    oldest->width = width;
+    oldest->height = height;
+    oldest->lastUsed = frame;
+    return oldest;
+}
+
+MHWRender::MRenderItem* spReticleLocSubSceneOverride::viewItem(MHWRender::MSubSceneContainer& container, spReticleLocSubSceneView* view)
+{
+    MHWRender::MRenderItem* item = container.find(view->itemName);
+    if (item)
+        return item;
+
+    MHWRender::MRenderer* theRenderer = MHWRender::MRenderer::theRenderer();
+    if (!theRenderer)
+        return NULL;
+
+    // Colored triangles, blended over everything else
+    if (!shader)
+    {
+        shader = theRenderer->getShaderManager()->getStockShader(MHWRender::MShaderManager::k3dCPVSolidShader);
+        if (!shader)
+            return NULL;
+        shader->setIsTransparent(true);
+    }
+
+    item = MHWRender::MRenderItem::Create(view->itemName,
+                                          MHWRender::MRenderItem::DecorationItem,
+                                          MHWRender::MGeometry::kTriangles);
+    item->setDrawMode(MHWRender::MGeometry::kAll);
+    item->depthPriority(MHWRender::MRenderItem::sActivePointDepthPriority);
+    item->castsShadows(false);
+    item->receivesShadows(false);
+    item->setExcludedFromPostEffects(true);
+    item->setShader(shader);
+    container.add(item);
+
+    // A new item has no geometry yet
+    view->releaseBuffers();
+    return item;
+}
+
+// Viewport 2.0 updates the container before drawing each viewport, so only
+// the item of the viewport being updated is enabled.
+//
+void spReticleLocSubSceneOverride::update(
+                                          MHWRender::MSubSceneContainer& container,
+                                          const MHWRender::MFrameContext& frameContext)
+{
+    MStatus status;
+
+    for (size_t i = 0; i < views.size(); i++)
+    {
+        MHWRender::MRenderItem* item = container.find(views[i]->itemName);
+        if (item)
+            item->enable(false);
+        views[i]->drawn = false;
+    }
+
+    MDagPath cameraPath = frameContext.getCurrentCameraPath(&status);
+    MDagPath objPath;
+    if (!status || !MDagPath::getAPathTo(node, objPath))
+        return;
+
+    int originX, originY, portWidth, portHeight;
+    frameContext.getViewportDimensions(originX, originY, portWidth, portHeight);
+    if (portWidth <= 0 || portHeight <= 0)
+        return;
+
+    MFnDependencyNode fnNode(node);
+    spReticleLoc* reticle = static_cast<spReticleLoc*>(fnNode.userNode());
+
+    // Reject the cameras the reticle isn't drawn through before selecting a
+    // view, so that they don't take the place of the views that draw it
+    if (!reticle->isVisible(cameraPath))
+        return;
+
+    spReticleLocSubSceneView* view = setView(panelName(frameContext), cameraPath, portWidth, portHeight);
+    MHWRender::MRenderItem* item = viewItem(container, view);
+    if (!item)
+        return;
+
+    if (!reticle->prepForDraw(node, objPath, cameraPath, view->cameraState))
+        return;
+
+    view->renderer.setStats(&reticle->viewStats[view->index]);
+    reticle->drawBase(portWidth, portHeight, view->cameraState, view->layout, &view->renderer);
+    view->drawn = true;
+
+    if (view->renderer.changed() || !view->positions)
+        updateBuffers(item, view);
+
+    // Map the pixels to clip space just in front of the near plane, then to
+    // world space. Maya matrices transform row vectors.
+    MHWRender::MRenderer* theRenderer = MHWRender::MRenderer::theRenderer();
+    double nearZ = (theRenderer && !theRenderer->drawAPIIsOpenGL()) ? 0.0001 : -0.9999;
+
+    MMatrix pixelToClip;
+    pixelToClip[0][0] = 2.0 / portWidth;
+    pixelToClip[1][1] = 2.0 / portHeight;
+    pixelToClip[3][0] = -1.0;
+    pixelToClip[3][1] = -1.0;
+    pixelToClip[3][2] = nearZ;
+
+    MMatrix matrix = pixelToClip * frameContext.getMatrix(MHWRender::MFrameContext::kViewProjInverseMtx);
+    item->setMatrix(&matrix);
+    item->enable(view->numVertices > 0 && !view->renderer.triangles().empty());
+}
+
+void spReticleLocSubSceneOverride::updateBuffers(MHWRender::MRenderItem* item, spReticleLocSubSceneView* view)
+{
+    const std::vector<SubSceneRenderer::Vertex> &triangles = view->renderer.triangles();
+    unsigned int count = (unsigned int)triangles.size();
+    if (count == 0)
+        return;
+
+    bool resized = count != view->numVertices;
+    if (resized)
+    {
+        view->releaseBuffers();
+
+        const MHWRender::MVertexBufferDescriptor positionDesc("", MHWRender::MGeometry::kPosition, MHWRender::MGeometry::kFloat, 3);
+        const MHWRender::MVertexBufferDescriptor colorDesc("", MHWRender::MGeometry::kColor, MHWRender::MGeometry::kFloat, 4);
+        view->positions = new MHWRender::MVertexBuffer(positionDesc);
+        view->colors = new MHWRender::MVertexBuffer(colorDesc);
+        view->indices = new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32);
+
+        unsigned int* index = (unsigned int*) view->indices->acquire(count, true);
+        for (unsigned int i = 0; i < count; i++)
+            index[i] = i;
+        view->indices->commit(index);
+
+        view->numVertices = count;
+    }
+
+    float* p = (float*) view->positions->acquire(count, true);
+    float* c = (float*) view->colors->acquire(count, true);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const SubSceneRenderer::Vertex &v = triangles[i];
+        p[i*3]   = v.x;
+        p[i*3+1] = v.y;
+        p[i*3+2] = 0.0f;
+        c[i*4]   = v.r;
+        c[i*4+1] = v.g;
+        c[i*4+2] = v.b;
+        c[i*4+3] = v.a;
+    }
+    view->positions->commit(p);
+    view->colors->commit(c);
+
+    // The item keeps using the same buffers until they are reallocated
+    if (resized)
+    {
+        MHWRender::MVertexBufferArray buffers;
+        buffers.addBuffer("positions", view->positions);
+        buffers.addBuffer("colors", view->colors);
+
+        MBoundingBox bounds(MPoint(-1000000,-1000000,-1000000), MPoint(1000000,1000000,1000000));
+        setGeometryForRenderItem(*item, buffers, *view->indices, &bounds);
+    }
+}
+
+bool spReticleLocSubSceneOverride::hasUIDrawables() const
+{
+    return true;
+}
+
+void spReticleLocSubSceneOverride::addUIDrawables(
+                                                  MHWRender::MUIDrawManager& drawManager,
+                                                  const MHWRender::MFrameContext& frameContext)
+{
+    const spReticleLocSubSceneView* view = findView(frameContext);
+    if (!view || !view->drawn)
+        return;
+
+    const std::vector<SubSceneRenderer::TextItem> &text = view->renderer.text();
+    if (text.empty())
+        return;
+
+    drawManager.beginDrawable();
+    drawManager.setFontName("Bitstream Charter");
+
+    for (size_t i = 0; i < text.size(); i++)
+    {
+        const SubSceneRenderer::TextItem &item = text[i];
+        drawManager.setFontSize(item.fontSize);
+        drawManager.setColor(item.color);
+        drawManager.text2d(MPoint(item.x, item.y), item.text, (MHWRender::MUIDrawManager::TextAlignment)item.align);
+    }
+
+    drawManager.endDrawable();
+}
+
+#endif
+
+//---------------------------------------------------------------------------
+// Script text evaluation command
+//---------------------------------------------------------------------------
+
+void * spReticleLocEvalText::creator()
+{
+    return new spReticleLocEvalText();
+}
+
+MStatus spReticleLocEvalText::doIt(const MArgList &args)
+{
+    MStatus stat;
+
+    MString nodeName = args.asString( 0, &stat );
+    McheckStatus ( stat, "spReticleLocEvalText node argument" );
+
+    int index = args.asInt( 1, &stat );
+    McheckStatus ( stat, "spReticleLocEvalText index argument" );
+
+    // The node may have been deleted since the evaluation was queued
+    MSelectionList list;
+    MObject obj;
+    if (!list.add( nodeName ) || !list.getDependNode( 0, obj ))
+        return MS::kSuccess;
+
+    MFnDependencyNode fnNode( obj );
+    if (fnNode.typeId() != spReticleLoc::id)
+        return MS::kSuccess;
+
+    spReticleLoc* reticle = static_cast<spReticleLoc*>(fnNode.userNode());
+    reticle->evalScriptText( index );
+
+    return MS::kSuccess;
+}
+
+void * spReticleLocStats::creator()
+{
+    return new spReticleLocStats();
+}
+
+static void appendStat(MPxCommand *cmd, const char *name, double value)
+{
+    MString str;
+    str.set(value);
+    cmd->appendToResult(MString(name));
+    cmd->appendToResult(str);
+}
+
+MStatus spReticleLocStats::doIt(const MArgList &args)
+{
+    MStatus stat;
+    bool reset = false;
+    MString nodeName;
+    
+    for (unsigned int i = 0; i < args.length(); i++)
+    {
+        MString arg = args.asString( i, &stat );
+        McheckStatus ( stat, "spReticleLocStats argument" );
+        
+        if (arg == "-reset" || arg == "-r")
+            reset = true;
+        else
+            nodeName = arg;
+    }
+    
+    MSelectionList list;
+    MObject obj;
+    if (!list.add( nodeName ) || !list.getDependNode( 0, obj ))
+    {
+        MGlobal::displayError( MString("spReticleLocStats: no node named ") + nodeName );
+        return MS::kFailure;
+    }
+    
+    MFnDependencyNode fnNode( obj );
+    if (fnNode.typeId() != spReticleLoc::id)
+    {
+        MGlobal::displayError( MString("spReticleLocStats: ") + nodeName + " is not a spReticleLoc" );
+        return MS::kFailure;
+    }
+    
+    spReticleLoc* reticle = static_cast<spReticleLoc*>(fnNode.userNode());
+    const RenderStats stats = reticle->totalStats();
+    
+    // Times in milliseconds
+    appendStat( this, "frames", stats.frames );
+    appendStat( this, "lastTime", stats.lastTime * 1000.0 );
+    appendStat( this, "averageTime", stats.frames ? stats.totalTime * 1000.0 / stats.frames : 0.0 );
+    appendStat( this, "maxTime", stats.maxTime * 1000.0 );
+    appendStat( this, "drawCalls", stats.drawCalls );
+    appendStat( this, "uploadBytes", double(stats.uploadBytes) );
+    appendStat( this, "cachedFrames", stats.cachedFrames );
+    appendStat( this, "skippedFrames", stats.skippedFrames );
+    appendStat( this, "skipRatio", stats.frames ? double(stats.skippedFrames) / stats.frames : 0.0 );
+    appendStat( this, "textFrames", stats.textFrames );
+    appendStat( this, "gpuFrames", stats.gpuFrames );
+    appendStat( this, "gpuTime", stats.gpuTime * 1000.0 );
+    appendStat( this, "gpuMaskTime", stats.gpuMaskTime * 1000.0 );
+    appendStat( this, "gpuLineTime", stats.gpuLineTime * 1000.0 );
+    appendStat( this, "gpuTextTime", stats.gpuTextTime * 1000.0 );
+    appendStat( this, "glContexts", GLResources::numContexts() );
+    appendStat( this, "glBytes", double(GLResources::totalBytes()) );
+    
+    if (reset)
+        reticle->resetStats();
+    
+    return MS::kSuccess;
+}
+
+void * spReticleLocBackend::creator()
+{
+    return new spReticleLocBackend();
+}
+
+MStatus spReticleLocBackend::doIt(const MArgList &args)
+{
+    MStatus stat;
+    
+    if (args.length() > 0)
+    {
+        MString name = args.asString( 0, &stat );
+        McheckStatus ( stat, "spReticleLocBackend argument" );
+        
+        if (name == SUBSCENE_BACKEND || RendererBackend::subScene())
+        {
+            MGlobal::displayError( MString("spReticleLocBackend: the ") + SUBSCENE_BACKEND +
+                                   " backend can only be switched with " + BACKEND_ENV_VAR + " when the plugin is loaded" );
+            return MS::kFailure;
+        }
+        
+        if (!RendererBackend::select( name ))
+        {
+            MGlobal::displayError( MString("spReticleLocBackend: unknown backend ") + name );
+            return MS::kFailure;
+        }
+    }
+    
+    appendToResult( MString("requested") );
+    appendToResult( MString(RendererBackend::name(RendererBackend::requested())) );
+    appendToResult( MString("current") );
+    appendToResult( MString(RendererBackend::name(RendererBackend::current())) );
+    appendStat( this, "decided", RendererBackend::decided() );
+    appendStat( this, "subScene", RendererBackend::subScene() );
+    
+    // Times in milliseconds
+    appendStat( this, "openGLFrames", RendererBackend::frames(RendererBackend::kOpenGL) );
+    appendStat( this, "openGLTime", RendererBackend::averageTime(RendererBackend::kOpenGL) * 1000.0 );
+    appendStat( this, "drawManagerFrames", RendererBackend::frames(RendererBackend::kDrawManager) );
+    appendStat( this, "drawManagerTime", RendererBackend::averageTime(RendererBackend::kDrawManager) * 1000.0 );
+    
+    return MS::kSuccess;
+}
+
+void * spReticleLocRender::creator()
+{
+    return new spReticleLocRender();
+}
+
+// The size of the images rendered by Maya
+//
+static void getRenderResolution(int &width, int &height)
+{
+    MSelectionList list;
+    MObject obj;
+    if (!list.add( "defaultResolution" ) || !list.getDependNode( 0, obj ))
+        return;
+    
+    MFnDependencyNode fnNode( obj );
+    fnNode.findPlug( "width" ).getValue( width );
+    fnNode.findPlug( "height" ).getValue( height );
+}
+
+MStatus spReticleLocRender::doIt(const MArgList &args)
+{
+    MStatus stat;
+    MString nodeName, cameraName, fileName;
+    int width = 0, height = 0;
+    
+    for (unsigned int i = 0; i < args.length(); i++)
+    {
+        MString arg = args.asString( i, &stat );
+        McheckStatus ( stat, "spReticleLocRender argument" );
+        
+        bool hasValue = i + 1 < args.length();
+        if ((arg == "-camera" || arg == "-c") && hasValue)
+        {
+            cameraName = args.asString( ++i, &stat );
+            McheckStatus ( stat, "spReticleLocRender -camera argument" );
+        }
+        else if ((arg == "-width" || arg == "-w") && hasValue)
+        {
+            width = args.asInt( ++i, &stat );
+            McheckStatus ( stat, "spReticleLocRender -width argument" );
+        }
+        else if ((arg == "-height" || arg == "-h") && hasValue)
+        {
+            height = args.asInt( ++i, &stat );
+            McheckStatus ( stat, "spReticleLocRender -height argument" );
+        }
+        else if ((arg == "-file" || arg == "-f") && hasValue)
+        {
+            fileName = args.asString( ++i, &stat );
+            McheckStatus ( stat, "spReticleLocRender -file argument" );
+        }
+        else
+            nodeName = arg;
+    }
+    
+    if (fileName.length() == 0)
+    {
+        MGlobal::displayError( "spReticleLocRender: no -file given" );
+        return MS::kFailure;
+    }
+    
+    MSelectionList list;
+    MDagPath nodePath;
+    if (!list.add( nodeName ) || !list.getDagPath( 0, nodePath ))
+    {
+        MGlobal::displayError( MString("spReticleLocRender: no node named ") + nodeName );
+        return MS::kFailure;
+    }
+    
+    MObject obj = nodePath.node();
+    MFnDependencyNode fnNode( obj );
+    if (fnNode.typeId() != spReticleLoc::id)
+    {
+        MGlobal::displayError( MString("spReticleLocRender: ") + nodeName + " is not a spReticleLoc" );
+        return MS::kFailure;
+    }
+    
+    MDagPath cameraPath;
+    if (cameraName.length() > 0)
+    {
+        MSelectionList cameraList;
+        if (!cameraList.add( cameraName ) || !cameraList.getDagPath( 0, cameraPath ))
+        {
+            MGlobal::displayError( MString("spReticleLocRender: no camera named ") + cameraName );
+            return MS::kFailure;
+        }
+    }
+    else if (MGlobal::mayaState() != MGlobal::kInteractive ||
+             !M3dView::active3dView().getCamera( cameraPath ))
+    {
+        MGlobal::displayError( "spReticleLocRender: no -camera given and no active view" );
+        return MS::kFailure;
+    }
+    
+    if (width <= 0 || height <= 0)
+        getRenderResolution( width, height );
+    if (width <= 0 || height <= 0)
+    {
+        MGlobal::displayError( "spReticleLocRender: invalid image size" );
+        return MS::kFailure;
+    }
+    
+    spReticleLoc* reticle = static_cast<spReticleLoc*>(fnNode.userNode());
+    
+    CameraState cameraState;
+    if (!reticle->prepForDraw( obj, nodePath, cameraPath, cameraState ))
+    {
+        MGlobal::displayError( MString("spReticleLocRender: ") + nodeName + " is not drawn through " + cameraPath.partialPathName() );
+        return MS::kFailure;
+    }
+    
+    Layout layout;
+    SoftwareRenderer renderer;
+    reticle->drawBase( width, height, cameraState, layout, &renderer );
+    
+    std::vector<unsigned char> rgba;
+    renderer.toRGBA8( rgba );
+    
+    // toRGBA8 starts with the top row, MImage with the bottom one
+    MImage image;
+    stat = image.create( width, height, 4, MImage::kByte );
+    McheckStatus ( stat, "spReticleLocRender create image" );
+    std::copy( rgba.begin(), rgba.end(), image.pixels() );
+    image.verticalFlip();
+    
+    // The format is the extension of the file
+    MString format = "iff";
+    int dot = fileName.rindex( '.' );
+    if (dot >= 0 && dot + 1 < int(fileName.length()))
+        format = fileName.substring( dot + 1, fileName.length() - 1 );
+    
+    stat = image.writeToFile( fileName, format );
+    if (!stat)
+    {
+        MGlobal::displayError( MString("spReticleLocRender: unable to write ") + fileName );
+        return stat;
+    }
+    
+    setResult( fileName );
+    return MS::kSuccess;
+}
+
 //---------------------------------------------------------------------------
 // Plugin Registration
 //---------------------------------------------------------------------------
 
+// Shows the errors drawReticle finds in the settings of a node
+static void displayReticleError(const MString & message)
+{
+    MGlobal::displayError( message );
+}
+
 MStatus initializePlugin(MObject obj)
 {
     MFnPlugin plugin(obj, "SPI", PLUGIN_VERSION, "Any");
 
+    // Build the fonts shared by every renderer
+    FontRegistry::initialize();
+
+    // Report the errors in the settings of the nodes in Maya
+    setReticleErrorHandler( displayReticleError );
+
+    // Pick the Viewport 2.0 renderer
+    RendererBackend::initialize();
+
+    // Allow the script text types to run the scripts of the scene
+    const char *scriptText = getenv(SCRIPT_TEXT_ENV_VAR);
+    spReticleLoc::scriptTextEnabled = (scriptText && MString(scriptText) == "1");
+
 #if (MAYA_API_VERSION<201200)
     MStatus status = plugin.registerNode( "spReticleLoc", spReticleLoc::id, 
                          &spReticleLoc::creator, &spReticleLoc::initialize,
                          MPxNode::kLocatorNode );
 #else
+    // The node is classified for the override drawing it, which can only be
+    // chosen before the node is registered
+    if (RendererBackend::subScene())
+        spReticleLoc::drawDbClassification = "drawdb/subscene/spReticleLoc";
+    else
+        spReticleLoc::drawDbClassification = "drawdb/geometry/spReticleLoc";
+
     MStatus status = plugin.registerNode( "spReticleLoc", spReticleLoc::id, 
                          &spReticleLoc::creator, &spReticleLoc::initialize,
                          MPxNode::kLocatorNode,
@@ -2978,17 +3447,62 @@ MStatus initializePlugin(MObject obj)
         return status;
     }
 
+#if (MAYA_API_VERSION>=201700)
+    if (RendererBackend::subScene())
+    {
+        status = MHWRender::MDrawRegistry::registerSubSceneOverrideCreator(
+        spReticleLoc::drawDbClassification,
+        spReticleLoc::drawRegistrantId,
+        spReticleLocSubSceneOverride::Creator);
+        if (!status)
+        {
+            status.perror("registerSubSceneOverrideCreator");
+            return status;
+        }
+    }
+    else
+#endif
 #if (MAYA_API_VERSION>=201200)
-    status = MHWRender::MDrawRegistry::registerDrawOverrideCreator(
-    spReticleLoc::drawDbClassification,
-    spReticleLoc::drawRegistrantId,
-    spReticleLocDrawOverride::Creator);
+    {
+        status = MHWRender::MDrawRegistry::registerDrawOverrideCreator(
+        spReticleLoc::drawDbClassification,
+        spReticleLoc::drawRegistrantId,
+        spReticleLocDrawOverride::Creator);
+        if (!status)
+        {
+            status.perror("registerDrawOverrideCreator");
+            return status;
+        }
+    }
+#endif
+
+    status = plugin.registerCommand( "spReticleLocEvalText", spReticleLocEvalText::creator );
     if (!status)
     {
-        status.perror("registerDrawOverrideCreator");
+        status.perror("registerCommand");
+        return status;
+    }
+
+    status = plugin.registerCommand( "spReticleLocStats", spReticleLocStats::creator );
+    if (!status)
+    {
+        status.perror("registerCommand");
+        return status;
+    }
+
+    status = plugin.registerCommand( "spReticleLocBackend", spReticleLocBackend::creator );
+    if (!status)
+    {
+        status.perror("registerCommand");
+        return status;
+    }
+
+    status = plugin.registerCommand( "spReticleLocRender", spReticleLocRender::creator );
+    if (!status)
+    {
+        status.perror("registerCommand");
         return status;
     }
-#endif
 
 #if SOURCE_MEL_SCRIPT
     MGlobal::sourceFile(SOURCE_MEL_SCRIPT_PATH);
@@ -3002,16 +3516,60 @@ MStatus uninitializePlugin(MObject obj)
     MFnPlugin plugin( obj );
     MStatus status;
 
+#if (MAYA_API_VERSION>=201700)
+    if (RendererBackend::subScene())
+    {
+        status = MHWRender::MDrawRegistry::deregisterSubSceneOverrideCreator(
+            spReticleLoc::drawDbClassification,
+            spReticleLoc::drawRegistrantId);
+        if (!status)
+        {
+            status.perror("deregisterSubSceneOverrideCreator");
+            return status;
+        }
+    }
+    else
+#endif
 #if (MAYA_API_VERSION>=201200)
-    status = MHWRender::MDrawRegistry::deregisterDrawOverrideCreator(
-        spReticleLoc::drawDbClassification,
-        spReticleLoc::drawRegistrantId);
+    {
+        status = MHWRender::MDrawRegistry::deregisterDrawOverrideCreator(
+            spReticleLoc::drawDbClassification,
+            spReticleLoc::drawRegistrantId);
+        if (!status)
+        {
+            status.perror("deregisterDrawOverrideCreator");
+            return status;
+        }
+    }
+#endif
+
+    status = plugin.deregisterCommand( "spReticleLocEvalText" );
     if (!status)
     {
-        status.perror("deregisterDrawOverrideCreator");
+        status.perror("deregisterCommand");
+        return status;
+    }
+
+    status = plugin.deregisterCommand( "spReticleLocStats" );
+    if (!status)
+    {
+        status.perror("deregisterCommand");
+        return status;
+    }
+
+    status = plugin.deregisterCommand( "spReticleLocBackend" );
+    if (!status)
+    {
+        status.perror("deregisterCommand");
+        return status;
+    }
+
+    status = plugin.deregisterCommand( "spReticleLocRender" );
+    if (!status)
+    {
+        status.perror("deregisterCommand");
         return status;
     }
-#endif
 
     status = plugin.deregisterNode( spReticleLoc::id );
     if (!status)
@@ -3020,6 +3578,25 @@ MStatus uninitializePlugin(MObject obj)
         return status;
     }
 
+    // Delete the GL objects of every view while its context can still be
+    // made current, then forget the ones of the contexts we cannot reach
+    for (unsigned int i = 0; i < M3dView::numberOf3dViews(); i++)
+    {
+        M3dView view;
+        if (M3dView::get3dView(i, view))
+        {
+            view.beginGL();
+            GLResources::releaseContext();
+            view.endGL();
+        }
+    }
+    GLResources::clear();
+
+    RendererBackend::uninitialize();
+
+    // The fonts are freed once the last renderer is gone
+    FontRegistry::uninitialize();
+
     return status;
 }
 
@@ -35,11 +35,20 @@
 #include "defines.h"
 #include "util.h"
 #include "OpenGLRenderer.h"
+#include "SoftwareRenderer.h"
+#include "ShotMetadata.h"
+#include "ReticleDraw.h"
 
-#if(MAYA_API_VERSION>=201400 && USE_MUIDRAWMANAGER)
+#include "RendererBackend.h"
+
+#if(MAYA_API_VERSION>=201400)
 #include "V2Renderer.h"
 #endif
 
+#if(MAYA_API_VERSION>=201700)
+#include "SubSceneRenderer.h"
+#endif
+
 class spReticleLoc : public MPxLocatorNode
 {
 public:
@@ -50,25 +59,50 @@ public:
                             M3dView::DisplayStyle style,
                             M3dView::DisplayStatus status );
 
-    virtual bool            setInternalValueInContext( const MPlug &,
-                                                       const MDataHandle &,
-                                                       MDGContext &);
+    virtual MStatus         compute( const MPlug & plug, MDataBlock & data );
 
     static  void            *creator();
     static  MStatus         initialize();
 
     virtual bool            excludeAsLocator() const;
+#if MAYA_API_VERSION >= 201600
+    virtual SchedulingType  schedulingType() const { return kParallel; }
+#endif
     virtual void            postConstructor();
 
     virtual bool            isTransparent() const {return true;}
     virtual bool            drawLast() const      {return true;}
     virtual bool            isBounded() const     {return false;}
 
-    // Get node ready for drawing
-    bool                    prepForDraw(const MObject & thisNode, const MDagPath & path, const MDagPath & cameraPath);
+    // Whether the node is drawn through a camera, cached per camera
+    bool                    isVisible(const MDagPath & cameraPath);
+
+    // Get node ready for drawing through a camera, and fill in the camera
+    // state of the view
+    bool                    prepForDraw(const MObject & thisNode, const MDagPath & path, const MDagPath & cameraPath, CameraState & cam);
     
-    // Base draw method
-    void                    drawBase(int width, int height, GPURenderer* renderer);
+    // Base draw method. Draws the settings of the node with drawReticle,
+    // without modifying the node, so that views can draw the same node at
+    // the same time. Returns whether the frame was computed and drawn in
+    // full, rather than drawn again or with new text only.
+    bool                    drawBase(int width, int height, const CameraState & cam, Layout & layout, GPURenderer* renderer) const;
+
+    // Evaluate the script of a script text item, called from the idle queue
+    void                    evalScriptText(int i);
+
+    // Whether the script text types may run their scripts, see
+    // SCRIPT_TEXT_ENV_VAR
+    static bool             scriptTextEnabled;
+
+    // The frames drawn by the node in the legacy viewport, and in each
+    // Viewport 2.0 view, by the index of the view. Views that draw at the
+    // same time count their frames in their own statistics.
+    RenderStats             oglStats;
+    RenderStats             viewStats[MAX_VIEW_STATES];
+
+    // The statistics of all of the views added up
+    RenderStats             totalStats() const;
+    void                    resetStats();
 
 public:
     static MTypeId id;
@@ -135,10 +169,15 @@ public:
     static MObject MiscTextTrans;
     static MObject LineColor;
     static MObject LineTrans;
+    static MObject LineWidth;
+    static MObject DisplayStats;
     static MObject Time;
+    static MObject ConfigVersion;
+    static MObject OutTime;
     static MObject DriveCameraAperture;
     static MObject MaximumDistance;
     static MObject UseOverscan;
+    static MObject ShotMetadataFile;
     static MObject Pad;
     static MObject UsePad;
     static MObject PadAmount;
@@ -166,86 +205,164 @@ public:
     static MObject TextBold;
     static MObject TextSize;
     static MObject TextScale;
+    static MObject TextSource;
     static MObject Tag;
 
 private:
-    MStatus getPadData();
-    MStatus getFilmbackData();
-    MStatus getProjectionData();
-    MStatus getSafeActionData();
-    MStatus getSafeTitleData();
-    MStatus getAspectRatioChildren ( MPlug arPlug, Aspect_Ratio & ar );
+    MStatus getPadData( MDataBlock & data );
+    MStatus getFilmbackData( MDataBlock & data );
+    MStatus getProjectionData( MDataBlock & data );
+    MStatus getSafeActionData( MDataBlock & data );
+    MStatus getSafeTitleData( MDataBlock & data );
+    MStatus getAspectRatioChildren ( MDataHandle arHandle, const MObject * children, Aspect_Ratio & ar );
     static bool aspectRatioSortPredicate( const Aspect_Ratio &, const Aspect_Ratio &);
-    MStatus getAspectRatioData ();
-    bool needToUpdateAspectRatios();
-    MStatus getPanScanData ( PanScan & ps );
-    MStatus getTextChildren ( MPlug tPlug, TextData & td );
+    MStatus getAspectRatioData ( MDataBlock & data );
+    MStatus getPanScanData ( MDataBlock & data, PanScan & ps );
+    MStatus getTextChildren ( MDataHandle tHandle, TextData & td );
     MStatus generateTextBuffer(TextData &td);
-    MStatus getTextData();
-    MStatus getOptions();
+    MStatus getTextData( MDataBlock & data );
+    MStatus getOptions( MDataBlock & data );
 
-    MStatus getColor ( MObject colorObj, MObject transObj, MColor & color );
+    MStatus getColor ( MDataHandle colorHandle, MDataHandle transHandle, MColor & color );
     MMatrix getMatrix( MString matrixStr );
     void printAspectRatio ( Aspect_Ratio & ar );
     void printPanScan ( PanScan & ps );
     void printText ( TextData & td );
     void printGeom ( Geom & g );
     void printOptions ();
-    void calcPortGeom();
-    void calcFilmbackGeom();
-    void calcMaskGeom( Geom & g, double w, double h, Geom & gSrc, double wSrc, double hSrc );
-    void calcFilmbackSafeActionGeom();
-    void calcFilmbackSafeTitleGeom();
-    void calcSafeActionGeom( Aspect_Ratio & ar );
-    void calcSafeTitleGeom( Aspect_Ratio & ar );
-    void calcAspectGeom( Aspect_Ratio & ar);
-    void calcPanScanGeom( PanScan & ps );
-    bool calcDynamicText(TextData *td, const int i);
-    bool getTextLevelGeometry(TextData *td, Geom &g, const int i);
-    bool calcTextPosition(TextData *td, const Geom &g, double &x, double &y, const int i);
-
-    void drawCustomTextElements(GPURenderer* renderer);
-
-    Filmback   oFilmback,filmback;
-    PadOptions pad;
-    PanScan    panScan;
-    Geom       portGeom;
-    Options    options;
-
-    double    portWidth;
-    double    portHeight;
-    double    scaleFactor;
-    double    overscan;
+    void getCameraState( MFnCamera & camera, CameraState & cam );
+    void driveCameraAperture( MFnCamera & camera, const MDagPath & cameraPath );
+    bool cameraVisible( const MDagPath & cameraPath, bool & cacheable ) const;
+    static void cameraChanged( MNodeMessage::AttributeMessage msg, MPlug & plug, MPlug & otherPlug, void * clientData );
+    static void camerasChanged( MNodeMessage::AttributeMessage msg, MPlug & plug, MPlug & otherPlug, void * clientData );
+    bool calcDynamicText(const CameraState &cam, TextData *td, const int i);
+    const char *getShotMetadata(TextData *td, const int i);
+    const char *getScriptText(TextData *td, const int i);
+    bool getTime(MTime &time);
+
+    // Settings read from the attributes by compute; drawReticle copies them
+    // into the layout of the view before computing the geometry
+    ReticleSettings settings;
+
     double    ncp;
     MMatrix   wim;
-    MFnCamera camera;
     MObject   thisNode;
 
-    int    numAspectRatios;
     bool   loadDefault;
-    double maximumDist;
-    bool   needRefresh;
+    bool   timeConnectQueued;
 
-    std::vector<Aspect_Ratio> ars;
     std::vector<TextData>     text;
 
+    ShotMetadata              shotMetadata;
+    std::vector<ShotFieldRef> shotFieldRefs;
+    std::vector<ScriptText>   scriptText;
+
+    std::vector<CameraVisibility> cameraVisibility;
+    MCallbackId                   nodeCallback;
+
+    std::vector<ApertureRequest>  apertureRequests;
+
+    // Legacy viewport views draw one after the other with these
+    CameraState    oglCamera;
+    Layout         oglLayout;
     OpenGLRenderer oglRenderer;
 };
 
+// Internal command used to evaluate script text items from the idle queue:
+//     spReticleLocEvalText <node> <text index>
+class spReticleLocEvalText : public MPxCommand
+{
+public:
+    virtual MStatus doIt(const MArgList &args);
+    static  void    *creator();
+};
+
+// Select the Viewport 2.0 backend of every node, and report the backend
+// and the timings of auto mode as name and value pairs:
+//     spReticleLocBackend [openGL|drawManager|auto]
+class spReticleLocBackend : public MPxCommand
+{
+public:
+    virtual MStatus doIt(const MArgList &args);
+    static  void    *creator();
+};
+
+// Report the draw statistics of a node as name and value pairs, and
+// optionally reset them:
+//     spReticleLocStats [-reset] <node>
+class spReticleLocStats : public MPxCommand
+{
+public:
+    virtual MStatus doIt(const MArgList &args);
+    static  void    *creator();
+};
+
+// Render a node through a camera on the CPU with the SoftwareRenderer and
+// write the premultiplied RGBA image to a file, in any format MImage writes
+// (taken from the file extension). The size defaults to the render
+// resolution and the camera to the one of the active view:
+//     spReticleLocRender [-camera <camera>] [-width <w>] [-height <h>] -file <path> <node>
+class spReticleLocRender : public MPxCommand
+{
+public:
+    virtual MStatus doIt(const MArgList &args);
+    static  void    *creator();
+};
+
 //---------------------------------------------------------------------------
 // Viewport 2.0 override implementation
 //---------------------------------------------------------------------------
 #if (MAYA_API_VERSION>=201200)
 
+// Camera state, layout and renderers of a node for one view, a panel or,
+// when Maya does not name the panel, a camera drawn at a viewport size, kept
+// from frame to frame so that their vertex arrays, text runs and cached
+// frame are reused
+class spReticleLocView
+{
+public:
+    spReticleLocView() : width(0), height(0), index(0), lastUsed(0) {}
+
+    MString        panel;
+    MDagPath       camera;
+    int            width;
+    int            height;
+    unsigned int   index;
+    unsigned int   lastUsed;
+    CameraState    cameraState;
+    Layout         layout;
+    OpenGLRenderer renderer;
+#if (MAYA_API_VERSION>=201400)
+    V2Renderer     drawManagerRenderer;
+#endif
+};
+
+// Draw data of a node, handed back to prepareForDraw as oldData and only
+// deleted by Maya with the node
 class spReticleLocData : public MUserData
 {
 public:
-    spReticleLocData() : MUserData(false) {} // don't delete after draw
-    virtual ~spReticleLocData() {}
+    spReticleLocData() : MUserData(false), // don't delete after draw
+        reticle(NULL), renderer(NULL), view(NULL),
+        backend(RendererBackend::kOpenGL), draw(false), frame(0) {}
+    virtual ~spReticleLocData();
+
+    // Select the view of a panel, or of a camera and viewport size when
+    // the panel is empty, creating it or recycling the least recently used
+    // one when there are already MAX_VIEW_STATES views. A panel drawn at a
+    // new size keeps its view. The size is 0 before Maya 2014, where
+    // prepareForDraw has no frame context.
+    void setView(const MString& panel, const MDagPath& cameraPath, int width, int height);
 
     spReticleLoc* reticle;
     GPURenderer* renderer;
+    spReticleLocView* view;
+    RendererBackend::Type backend;
     bool draw;
+
+private:
+    std::vector<spReticleLocView*> views;
+    unsigned int                   frame;
 };
 
 class spReticleLocDrawOverride : public MHWRender::MPxDrawOverride
@@ -298,12 +415,97 @@ public:
 private:
     spReticleLocDrawOverride(const MObject& obj);
     spReticleLocData* data;
+};
 
-#if (MAYA_API_VERSION>=201400 && USE_MUIDRAWMANAGER)
-    V2Renderer renderer;
-#else
-    OpenGLRenderer renderer;
 #endif
+
+#if (MAYA_API_VERSION>=201700)
+
+// Camera state, layout, renderer and render item of a sub-scene override
+// for one viewport, a panel or a camera drawn at a size. The render item of
+// every viewport has its own buffers and pixel to world matrix.
+class spReticleLocSubSceneView
+{
+public:
+    spReticleLocSubSceneView() : width(0), height(0), index(0), lastUsed(0), drawn(false),
+        positions(NULL), colors(NULL), indices(NULL), numVertices(0) {}
+    ~spReticleLocSubSceneView();
+
+    // Release the buffers, so that they are written again for a new viewport
+    void releaseBuffers();
+
+    MString                     panel;
+    MDagPath                    camera;
+    int                         width;
+    int                         height;
+    unsigned int                index;
+    unsigned int                lastUsed;
+    CameraState                 cameraState;
+    Layout                      layout;
+    SubSceneRenderer            renderer;
+    bool                        drawn;
+
+    MString                     itemName;
+    MHWRender::MVertexBuffer*   positions;
+    MHWRender::MVertexBuffer*   colors;
+    MHWRender::MIndexBuffer*    indices;
+    unsigned int                numVertices;
+};
+
+// Viewport 2.0 sub-scene override. The masks and lines of each viewport are
+// a single render item of screen space triangles whose buffers persist from
+// frame to frame; only the matrix that maps the pixels to the view changes
+// with the camera. The text is drawn with MUIDrawManager, Maya 2017+.
+class spReticleLocSubSceneOverride : public MHWRender::MPxSubSceneOverride
+{
+public:
+    static MHWRender::MPxSubSceneOverride* Creator(const MObject& obj)
+    {
+            return new spReticleLocSubSceneOverride(obj);
+    }
+
+    virtual ~spReticleLocSubSceneOverride();
+
+    virtual MHWRender::DrawAPI supportedDrawAPIs() const;
+
+    virtual bool requiresUpdate(
+                                const MHWRender::MSubSceneContainer& container,
+                                const MHWRender::MFrameContext& frameContext) const;
+
+    virtual void update(
+                        MHWRender::MSubSceneContainer& container,
+                        const MHWRender::MFrameContext& frameContext);
+
+    virtual bool hasUIDrawables() const;
+
+    virtual void addUIDrawables(
+                                MHWRender::MUIDrawManager& drawManager,
+                                const MHWRender::MFrameContext& frameContext);
+
+private:
+    spReticleLocSubSceneOverride(const MObject& obj);
+
+    // The view of the panel, or camera and viewport size, of a frame
+    // context, NULL when there is none
+    spReticleLocSubSceneView* findView(const MHWRender::MFrameContext& frameContext) const;
+
+    // Select the view of a viewport, creating it or recycling the least
+    // recently used one when there are already MAX_VIEW_STATES views
+    spReticleLocSubSceneView* setView(const MString& panel, const MDagPath& cameraPath, int width, int height);
+
+    // Create the render item of a view, or find it in the container
+    MHWRender::MRenderItem* viewItem(MHWRender::MSubSceneContainer& container, spReticleLocSubSceneView* view);
+
+    // Copy the triangles of the renderer of a view into the buffers of its
+    // item, reallocating them when the number of vertices changed
+    void updateBuffers(MHWRender::MRenderItem* item, spReticleLocSubSceneView* view);
+
+    MObject                     node;
+    MHWRender::MShaderInstance* shader;
+
+    std::vector<spReticleLocSubSceneView*> views;
+    unsigned int                           frame;
 };
 
 #endif
+
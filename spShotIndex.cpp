@@ -0,0 +1,368 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  spShotIndex.cpp
+//  spReticle
+//
+
+/*
+ * @file  spShotIndex.cpp
+ * Compiles a JSON shot metadata sidecar into the binary index that is
+ * memory mapped by the "Shot Metadata" text type (see ShotMetadata.h).
+ *
+ * The JSON file is an object keyed by shot name where every value is a flat
+ * object of fields:
+ *
+ *     {
+ *         "aa010": { "cutIn": 1001, "cutOut": 1087, "lens": "35mm" },
+ *         "aa020": { "cutIn": 1001, "cutOut": 1042, "artist": "jdoe" }
+ *     }
+ *
+ * Numbers, booleans and strings are all stored as text. Fields missing from
+ * a shot resolve to nothing.
+ *
+ * Usage: spShotIndex input.json output.idx
+ *
+ * The index is written to a temporary file next to the output and renamed
+ * over it, so that the sessions that have the previous index mapped keep
+ * reading it whole until they map the new one.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#	include <windows.h>
+#	include <process.h>
+#	define getpid _getpid
+#else
+#	include <unistd.h>
+#endif
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ShotMetadata.h"
+
+typedef std::map<std::string, std::string>  Fields;
+typedef std::map<std::string, Fields>       Shots;
+
+// Minimal parser for the restricted JSON layout described above.
+class Parser
+{
+public:
+    Parser(const std::string &text) : text(text), pos(0) {}
+
+    bool parse(Shots &shots)
+    {
+        if (!expect('{'))
+            return false;
+
+        if (peek() == '}')
+            return expect('}');
+
+        do
+        {
+            std::string shot;
+            if (!parseString(shot) || !expect(':') || !parseFields(shots[shot]))
+                return false;
+        }
+        while (accept(','));
+
+        return expect('}');
+    }
+
+    std::string error() const
+    {
+        char buff[64];
+        sprintf(buff, "parse error at offset %lu", (unsigned long)pos);
+        return buff;
+    }
+
+private:
+    void skipSpace()
+    {
+        while (pos < text.size() && strchr(" \t\r\n", text[pos]))
+            pos++;
+    }
+
+    char peek()
+    {
+        skipSpace();
+        return (pos < text.size()) ? text[pos] : '\0';
+    }
+
+    bool accept(char c)
+    {
+        if (peek() != c)
+            return false;
+        pos++;
+        return true;
+    }
+
+    bool expect(char c)
+    {
+        return accept(c);
+    }
+
+    bool parseFields(Fields &fields)
+    {
+        if (!expect('{'))
+            return false;
+
+        if (peek() == '}')
+            return expect('}');
+
+        do
+        {
+            std::string key, value;
+            if (!parseString(key) || !expect(':') || !parseValue(value))
+                return false;
+            fields[key] = value;
+        }
+        while (accept(','));
+
+        return expect('}');
+    }
+
+    bool parseValue(std::string &value)
+    {
+        if (peek() == '"')
+            return parseString(value);
+
+        // Numbers and literals are stored verbatim
+        size_t start = pos;
+        while (pos < text.size() && !strchr(",} \t\r\n", text[pos]))
+            pos++;
+
+        value = text.substr(start, pos - start);
+        if (value == "null")
+            value.clear();
+
+        return pos > start;
+    }
+
+    bool parseString(std::string &str)
+    {
+        if (!expect('"'))
+            return false;
+
+        str.clear();
+        while (pos < text.size() && text[pos] != '"')
+        {
+            char c = text[pos++];
+            if (c == '\\' && pos < text.size())
+            {
+                c = text[pos++];
+                switch (c)
+                {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case 'r': c = '\r'; break;
+                    case 'u':
+                    {
+                        // Only the Basic Latin/Latin-1 range is supported by the fonts
+                        if (pos + 4 > text.size())
+                            return false;
+                        unsigned long code = strtoul(text.substr(pos, 4).c_str(), NULL, 16);
+                        pos += 4;
+                        c = (code < 256) ? char(code) : '?';
+                        break;
+                    }
+                }
+            }
+            str += c;
+        }
+
+        return expect('"');
+    }
+
+    const std::string &text;
+    size_t            pos;
+};
+
+class StringTable
+{
+public:
+    // Offset 0 is the empty string which also marks missing values
+    StringTable() : data(1, '\0') {}
+
+    unsigned int add(const std::string &str)
+    {
+        if (str.empty())
+            return 0;
+
+        std::map<std::string, unsigned int>::iterator it = offsets.find(str);
+        if (it != offsets.end())
+            return it->second;
+
+        unsigned int offset = (unsigned int)data.size();
+        data.insert(data.end(), str.begin(), str.end());
+        data.push_back('\0');
+        offsets[str] = offset;
+        return offset;
+    }
+
+    std::vector<char> data;
+
+private:
+    std::map<std::string, unsigned int> offsets;
+};
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        std::cerr << "usage: " << argv[0] << " input.json output.idx" << std::endl;
+        return 1;
+    }
+
+    FILE *in = fopen(argv[1], "rb");
+    if (!in)
+    {
+        std::cerr << "unable to open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    std::string text;
+    char buff[4096];
+    size_t n;
+    while ((n = fread(buff, 1, sizeof(buff), in)) > 0)
+        text.append(buff, n);
+    fclose(in);
+
+    Shots shots;
+    Parser parser(text);
+    if (!parser.parse(shots))
+    {
+        std::cerr << argv[1] << ": " << parser.error() << std::endl;
+        return 1;
+    }
+
+    // Collect the union of all field names
+    std::map<std::string, unsigned int> fieldIds;
+    for (Shots::iterator s = shots.begin(); s != shots.end(); ++s)
+        for (Fields::iterator f = s->second.begin(); f != s->second.end(); ++f)
+            fieldIds.insert(std::make_pair(f->first, 0u));
+
+    StringTable strings;
+    std::vector<unsigned int> fieldNames;
+    for (std::map<std::string, unsigned int>::iterator f = fieldIds.begin(); f != fieldIds.end(); ++f)
+    {
+        f->second = (unsigned int)fieldNames.size();
+        fieldNames.push_back(strings.add(f->first));
+    }
+
+    // Keep the table at most half full so probe sequences stay short
+    unsigned int numBuckets = 1;
+    while (numBuckets < shots.size() * 2)
+        numBuckets <<= 1;
+
+    unsigned int numFields = (unsigned int)fieldNames.size();
+    std::vector<unsigned int> buckets(numBuckets, 0);
+    std::vector<unsigned int> records;
+
+    unsigned int shotIndex = 0;
+    for (Shots::iterator s = shots.begin(); s != shots.end(); ++s, ++shotIndex)
+    {
+        records.push_back(strings.add(s->first));
+
+        std::vector<unsigned int> values(numFields, 0);
+        for (Fields::iterator f = s->second.begin(); f != s->second.end(); ++f)
+            values[fieldIds[f->first]] = strings.add(f->second);
+        records.insert(records.end(), values.begin(), values.end());
+
+        unsigned int slot = shotIndexHash(s->first.c_str()) & (numBuckets - 1);
+        while (buckets[slot])
+            slot = (slot + 1) & (numBuckets - 1);
+        buckets[slot] = shotIndex + 1;
+    }
+
+    ShotIndexHeader header;
+    memcpy(header.magic, SHOT_INDEX_MAGIC, 8);
+    header.version     = SHOT_INDEX_VERSION;
+    header.numShots    = (unsigned int)shots.size();
+    header.numFields   = numFields;
+    header.numBuckets  = numBuckets;
+    header.stringsSize = (unsigned int)strings.data.size();
+
+    // Never truncate the index in place: a session mapping it would fault
+    // reading past the new end of the file, or follow offsets into records
+    // it did not validate
+    char tmpPath[4096];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.%d.tmp", argv[2], int(getpid()));
+
+    FILE *out = fopen(tmpPath, "wb");
+    if (!out)
+    {
+        std::cerr << "unable to write " << tmpPath << std::endl;
+        return 1;
+    }
+
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(&buckets[0], sizeof(unsigned int), buckets.size(), out);
+    if (numFields)
+        fwrite(&fieldNames[0], sizeof(unsigned int), fieldNames.size(), out);
+    if (!records.empty())
+        fwrite(&records[0], sizeof(unsigned int), records.size(), out);
+    fwrite(&strings.data[0], 1, strings.data.size(), out);
+
+    bool written = !ferror(out);
+    if (fclose(out) != 0 || !written)
+    {
+        std::cerr << "unable to write " << tmpPath << std::endl;
+        remove(tmpPath);
+        return 1;
+    }
+
+#if defined(_WIN32)
+    bool renamed = MoveFileExA(tmpPath, argv[2], MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    bool renamed = rename(tmpPath, argv[2]) == 0;
+#endif
+    if (!renamed)
+    {
+        std::cerr << "unable to replace " << argv[2] << std::endl;
+        remove(tmpPath);
+        return 1;
+    }
+
+    std::cout << "wrote " << header.numShots << " shots with " << numFields
+              << " fields to " << argv[2] << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  GLCalls.cpp
+//  spReticle
+//
+
+#include "GLFunctions.h"
+#include "Lock.h"
+
+#include "GLCalls.h"
+
+// Per thread, as every thread of the thread tests draws in its own context
+static SP_THREAD_LOCAL unsigned int numCalls = 0;
+static SP_THREAD_LOCAL unsigned int numDraws = 0;
+static SP_THREAD_LOCAL unsigned int numQueries = 0;
+
+static inline void countCall()
+{
+    numCalls++;
+}
+
+// Calls that return something wait for the server, a round trip with
+// remote or indirect rendering such as VirtualGL
+static inline void countQuery()
+{
+    numCalls++;
+    numQueries++;
+}
+
+// The OpenGL 1.1 functions of the plugin, without the draw calls. Keep in
+// sync with GL11_WRAPPED in the Makefile.
+#define GL11_FUNCTIONS(W) \
+    W(Call,  void,      BindTexture,        (GLenum a, GLuint b),                                   (a, b)) \
+    W(Call,  void,      BlendFunc,          (GLenum a, GLenum b),                                   (a, b)) \
+    W(Call,  void,      Clear,              (GLbitfield a),                                         (a)) \
+    W(Call,  void,      ClearColor,         (GLclampf a, GLclampf b, GLclampf c, GLclampf d),       (a, b, c, d)) \
+    W(Call,  void,      ColorPointer,       (GLint a, GLenum b, GLsizei c, const GLvoid *d),        (a, b, c, d)) \
+    W(Call,  void,      DeleteTextures,     (GLsizei a, const GLuint *b),                           (a, b)) \
+    W(Call,  void,      DepthMask,          (GLboolean a),                                          (a)) \
+    W(Call,  void,      Disable,            (GLenum a),                                             (a)) \
+    W(Call,  void,      DisableClientState, (GLenum a),                                             (a)) \
+    W(Call,  void,      Enable,             (GLenum a),                                             (a)) \
+    W(Call,  void,      EnableClientState,  (GLenum a),                                             (a)) \
+    W(Query, void,      GenTextures,        (GLsizei a, GLuint *b),                                 (a, b)) \
+    W(Query, void,      GetIntegerv,        (GLenum a, GLint *b),                                   (a, b)) \
+    W(Query, GLboolean, IsEnabled,          (GLenum a),                                             (a)) \
+    W(Query, GLboolean, IsTexture,          (GLuint a),                                             (a)) \
+    W(Call,  void,      LoadIdentity,       (void),                                                 ()) \
+    W(Call,  void,      MatrixMode,         (GLenum a),                                             (a)) \
+    W(Call,  void,      Ortho,              (GLdouble a, GLdouble b, GLdouble c, GLdouble d, GLdouble e, GLdouble f), (a, b, c, d, e, f)) \
+    W(Call,  void,      PixelStorei,        (GLenum a, GLint b),                                    (a, b)) \
+    W(Call,  void,      PopAttrib,          (void),                                                 ()) \
+    W(Call,  void,      PopClientAttrib,    (void),                                                 ()) \
+    W(Call,  void,      PopMatrix,          (void),                                                 ()) \
+    W(Call,  void,      PushAttrib,         (GLbitfield a),                                         (a)) \
+    W(Call,  void,      PushClientAttrib,   (GLbitfield a),                                         (a)) \
+    W(Call,  void,      PushMatrix,         (void),                                                 ()) \
+    W(Call,  void,      TexCoordPointer,    (GLint a, GLenum b, GLsizei c, const GLvoid *d),        (a, b, c, d)) \
+    W(Call,  void,      TexImage2D,         (GLenum a, GLint b, GLint c, GLsizei d, GLsizei e, GLint f, GLenum g, GLenum h, const GLvoid *i), (a, b, c, d, e, f, g, h, i)) \
+    W(Call,  void,      TexParameteri,      (GLenum a, GLenum b, GLint c),                          (a, b, c)) \
+    W(Call,  void,      VertexPointer,      (GLint a, GLenum b, GLsizei c, const GLvoid *d),        (a, b, c, d)) \
+    W(Call,  void,      Viewport,           (GLint a, GLint b, GLsizei c, GLsizei d),               (a, b, c, d))
+
+#define GL11_WRAP(kind, ret, name, params, args) \
+    extern "C" ret __real_gl##name params; \
+    extern "C" ret __wrap_gl##name params { count##kind(); return __real_gl##name args; }
+
+GL11_FUNCTIONS(GL11_WRAP)
+
+#undef GL11_WRAP
+
+extern "C" void __real_glDrawArrays(GLenum mode, GLint first, GLsizei count);
+extern "C" void __wrap_glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    numCalls++;
+    numDraws++;
+    __real_glDrawArrays(mode, first, count);
+}
+
+// The functions of GLFunctions, without the draw calls. The signatures are
+// the ones of SPGL_FUNCTIONS, with the argument names.
+#define SPGL_COUNTED(W) \
+    W(Call,  void,   ActiveTexture,            (GLenum a),                                                   (a)) \
+    W(Call,  void,   BlendFuncSeparate,        (GLenum a, GLenum b, GLenum c, GLenum d),                     (a, b, c, d)) \
+    W(Query, void,   GenBuffers,               (GLsizei a, GLuint *b),                                       (a, b)) \
+    W(Call,  void,   DeleteBuffers,            (GLsizei a, const GLuint *b),                                 (a, b)) \
+    W(Call,  void,   BindBuffer,               (GLenum a, GLuint b),                                         (a, b)) \
+    W(Call,  void,   BufferData,               (GLenum a, GLsizeiptr b, const void *c, GLenum d),            (a, b, c, d)) \
+    W(Query, GLuint, CreateShader,             (GLenum a),                                                   (a)) \
+    W(Call,  void,   ShaderSource,             (GLuint a, GLsizei b, const GLchar *const *c, const GLint *d), (a, b, c, d)) \
+    W(Call,  void,   CompileShader,            (GLuint a),                                                   (a)) \
+    W(Query, void,   GetShaderiv,              (GLuint a, GLenum b, GLint *c),                               (a, b, c)) \
+    W(Query, void,   GetShaderInfoLog,         (GLuint a, GLsizei b, GLsizei *c, GLchar *d),                 (a, b, c, d)) \
+    W(Call,  void,   DeleteShader,             (GLuint a),                                                   (a)) \
+    W(Query, GLuint, CreateProgram,            (void),                                                       ()) \
+    W(Call,  void,   AttachShader,             (GLuint a, GLuint b),                                         (a, b)) \
+    W(Call,  void,   BindAttribLocation,       (GLuint a, GLuint b, const GLchar *c),                        (a, b, c)) \
+    W(Call,  void,   LinkProgram,              (GLuint a),                                                   (a)) \
+    W(Query, void,   GetProgramiv,             (GLuint a, GLenum b, GLint *c),                               (a, b, c)) \
+    W(Query, void,   GetProgramInfoLog,        (GLuint a, GLsizei b, GLsizei *c, GLchar *d),                 (a, b, c, d)) \
+    W(Call,  void,   DeleteProgram,            (GLuint a),                                                   (a)) \
+    W(Call,  void,   UseProgram,               (GLuint a),                                                   (a)) \
+    W(Query, GLint,  GetUniformLocation,       (GLuint a, const GLchar *b),                                  (a, b)) \
+    W(Call,  void,   Uniform1i,                (GLint a, GLint b),                                           (a, b)) \
+    W(Call,  void,   VertexAttribPointer,      (GLuint a, GLint b, GLenum c, GLboolean d, GLsizei e, const void *f), (a, b, c, d, e, f)) \
+    W(Call,  void,   EnableVertexAttribArray,  (GLuint a),                                                   (a)) \
+    W(Call,  void,   DisableVertexAttribArray, (GLuint a),                                                   (a)) \
+    W(Query, void,   GenFramebuffers,          (GLsizei a, GLuint *b),                                       (a, b)) \
+    W(Call,  void,   DeleteFramebuffers,       (GLsizei a, const GLuint *b),                                 (a, b)) \
+    W(Call,  void,   BindFramebuffer,          (GLenum a, GLuint b),                                         (a, b)) \
+    W(Call,  void,   FramebufferTexture2D,     (GLenum a, GLenum b, GLenum c, GLuint d, GLint e),            (a, b, c, d, e)) \
+    W(Query, GLenum, CheckFramebufferStatus,   (GLenum a),                                                   (a)) \
+    W(Call,  void,   VertexAttribDivisor,      (GLuint a, GLuint b),                                         (a, b)) \
+    W(Query, void,   GenQueries,               (GLsizei a, GLuint *b),                                       (a, b)) \
+    W(Call,  void,   DeleteQueries,            (GLsizei a, const GLuint *b),                                 (a, b)) \
+    W(Call,  void,   QueryCounter,             (GLuint a, GLenum b),                                         (a, b)) \
+    W(Query, void,   GetQueryObjectiv,         (GLuint a, GLenum b, GLint *c),                               (a, b, c)) \
+    W(Query, void,   GetQueryObjectui64v,      (GLuint a, GLenum b, GLuint64 *c),                            (a, b, c))
+
+#define SPGL_COUNT(kind, ret, name, params, args) \
+    static spPFNgl##name real##name = NULL; \
+    static ret SPGL_APIENTRY count##name params { count##kind(); return real##name args; }
+
+SPGL_COUNTED(SPGL_COUNT)
+
+#undef SPGL_COUNT
+
+static spPFNglDrawArraysInstanced realDrawArraysInstanced = NULL;
+static void SPGL_APIENTRY countDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instances)
+{
+    numCalls++;
+    numDraws++;
+    realDrawArraysInstanced(mode, first, count, instances);
+}
+
+void GLCalls::install()
+{
+    static bool installed = false;
+    if (installed)
+        return;
+    installed = true;
+
+#define SPGL_INSTALL(kind, ret, name, params, args) \
+    if (spgl##name) { real##name = spgl##name; spgl##name = count##name; }
+
+    SPGL_COUNTED(SPGL_INSTALL)
+    SPGL_INSTALL(Call, void, DrawArraysInstanced, (), ())
+
+#undef SPGL_INSTALL
+}
+
+void GLCalls::reset()
+{
+    numCalls = 0;
+    numDraws = 0;
+    numQueries = 0;
+}
+
+unsigned int GLCalls::calls()
+{
+    return numCalls;
+}
+
+unsigned int GLCalls::draws()
+{
+    return numDraws;
+}
+
+unsigned int GLCalls::queries()
+{
+    return numQueries;
+}
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  MString.h
+//  spReticle
+//
+
+// Stand-in for the Maya class, for the renderer tests that build without
+// Maya. Characters are Latin-1, which is enough for the test strings.
+
+#ifndef spReticle_test_MString_h
+#define spReticle_test_MString_h
+
+#include <stdio.h>
+#include <string>
+
+class MString
+{
+public:
+    MString() {}
+    MString(const char *s) : str(s ? s : "") {}
+
+    const char *asChar() const { return str.c_str(); }
+
+    const wchar_t *asWChar() const
+    {
+        wide.assign(str.begin(), str.end());
+        for (size_t i = 0; i < wide.size(); i++)
+            wide[i] = wchar_t((unsigned char)str[i]);
+        return wide.c_str();
+    }
+
+    unsigned int length() const { return (unsigned int)str.size(); }
+
+    MString &set(int value)
+    {
+        char buff[32];
+        snprintf(buff, sizeof(buff), "%d", value);
+        str = buff;
+        return *this;
+    }
+
+    MString &operator+=(const MString &other) { str += other.str; return *this; }
+    MString operator+(const MString &other) const { MString s(*this); return s += other; }
+    MString operator+(const char *other) const    { return *this + MString(other); }
+    MString operator+(int value) const            { MString s; return *this + s.set(value); }
+    bool operator==(const MString &other) const { return str == other.str; }
+    bool operator!=(const MString &other) const { return str != other.str; }
+
+private:
+    std::string          str;
+    mutable std::wstring wide;
+};
+
+#endif
@@ -0,0 +1,1327 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2013, Sony Pictures Imageworks
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+// Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the
+// distribution.  Neither the name of Sony Pictures Imageworks nor the
+// names of its contributors may be used to endorse or promote
+// products derived from this software without specific prior written
+// permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+// OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//  spReticleTest.cpp
+//  spReticle
+//
+
+/*
+ * @file  spReticleTest.cpp
+ * Draws fixed reticles with the OpenGL renderer, in an offscreen software
+ * OpenGL context, and with the software renderer, and compares them with
+ * the images in test/golden. The reticles are laid out and drawn by
+ * drawReticle, as spReticleLoc::drawBase does, from settings and camera
+ * states filled in as compute and prepForDraw do, including its redraw of
+ * unchanged frames and of frames whose text changed only. The text uses a
+ * font atlas generated by the test, so the images do not depend on font.h.
+ *
+ * Usage: spReticleTest [-gl] [-software] [-update] [-bench] [-timers]
+ *                      [-frames n] [-threads n] [-golden dir] [-out dir]
+ *                      [scene ...]
+ *
+ *  -gl, -software  the renderers to test, both by default
+ *  -update         write the golden images instead of comparing them
+ *  -bench          time the scenes instead, printing the CPU time, the
+ *                  time to glFinish and the OpenGL calls of every frame,
+ *                  of which the queries wait for the server
+ *  -timers         turn on the GPU timers of the OpenGL renderer, and
+ *                  check that their times are read back
+ *  -frames n       frames per benchmark, 200 by default
+ *  -threads n      views drawing every scene at the same time with every
+ *                  renderer, each OpenGL view in its own context, 8 by
+ *                  default, 0 to skip
+ *  -golden dir     the golden images, test/golden by default
+ *  -out dir        where the images that do not match are written,
+ *                  test_output by default
+ *
+ * The golden images of the OpenGL renderer are named after the features of
+ * the context, see GLFunctions: "gl" for contexts with shaders, "glfixed"
+ * for OpenGL 1.5 contexts, which draw with the fixed function pipeline.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(SPRETICLE_OSMESA)
+#	include <GL/osmesa.h>
+#else
+#	include <EGL/egl.h>
+#	include <EGL/eglext.h>
+#endif
+
+#include "defines.h"
+#include "GLCalls.h"
+#include "OpenGLRenderer.h"
+#include "ReticleDraw.h"
+#include "SoftwareRenderer.h"
+
+// Largest scene
+#define TEST_MAX_WIDTH          480
+#define TEST_MAX_HEIGHT         360
+
+// The viewport behind the reticle
+#define TEST_BACKGROUND         0.35f
+
+// Channels may differ by TEST_CHANNEL_TOLERANCE from the golden image, to
+// allow for other rasterizer versions, on up to TEST_PIXEL_TOLERANCE of the
+// pixels
+#define TEST_CHANNEL_TOLERANCE  16
+#define TEST_PIXEL_TOLERANCE    0.002
+
+// The masks and lines composited from the OpenGL cache are blended twice, and
+// may differ by one step of rounding from the ones drawn directly
+#define TEST_CACHE_TOLERANCE    1
+
+// First frame drawn by the tests
+#define TEST_FRAME              1001
+
+// Frames drawn by each view of the thread test
+#define TEST_THREAD_FRAMES      64
+
+/////////////////////////////////////////////////////////////////////
+// Images
+/////////////////////////////////////////////////////////////////////
+
+// RGB, top row first
+class Image
+{
+public:
+    Image() : width(0), height(0) {}
+
+    int width, height;
+    std::vector<unsigned char> rgb;
+};
+
+static bool writePPM(const std::string &path, const Image &image)
+{
+    FILE *out = fopen(path.c_str(), "wb");
+    if (!out)
+        return false;
+
+    fprintf(out, "P6\n%d %d\n255\n", image.width, image.height);
+    bool ok = fwrite(&image.rgb[0], 1, image.rgb.size(), out) == image.rgb.size();
+    return (fclose(out) == 0) && ok;
+}
+
+static bool readPPM(const std::string &path, Image &image)
+{
+    FILE *in = fopen(path.c_str(), "rb");
+    if (!in)
+        return false;
+
+    int maxValue = 0;
+    bool ok = fscanf(in, "P6 %d %d %d", &image.width, &image.height, &maxValue) == 3 &&
+              maxValue == 255 && image.width > 0 && image.height > 0 && fgetc(in) != EOF;
+    if (ok)
+    {
+        image.rgb.resize(size_t(image.width) * image.height * 3);
+        ok = fread(&image.rgb[0], 1, image.rgb.size(), in) == image.rgb.size();
+    }
+
+    fclose(in);
+    return ok;
+}
+
+// Number of pixels with a channel more than tolerance away
+static size_t compareImages(const Image &a, const Image &b, int tolerance)
+{
+    if (a.width != b.width || a.height != b.height)
+        return size_t(-1);
+
+    size_t different = 0;
+    for (size_t i = 0; i < a.rgb.size(); i += 3)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            if (abs(int(a.rgb[i+c]) - int(b.rgb[i+c])) > tolerance)
+            {
+                different++;
+                break;
+            }
+        }
+    }
+
+    return different;
+}
+
+/////////////////////////////////////////////////////////////////////
+// Font atlas
+/////////////////////////////////////////////////////////////////////
+
+#define TEST_GLYPH_WIDTH        8
+#define TEST_GLYPH_HEIGHT       12
+#define TEST_GLYPH_PADDING      4
+#define TEST_ATLAS_WIDTH        256
+#define TEST_ATLAS_HEIGHT       256
+#define TEST_SDF_SPREAD         4
+
+// Block pattern of a glyph, 4 x 6 blocks of 2 x 2 texels. The left column
+// and the bottom row are always set so that every glyph has a baseline.
+static bool glyphBlock(wchar_t c, bool bold, int bx, int by)
+{
+    if (bx == 0 || by == 5)
+        return true;
+
+    unsigned int h = (unsigned int)c * 2654435761u + (bold ? 0x9E3779B9u : 0u);
+    h ^= h >> 15;
+    return (h >> ((by * 4 + bx) % 24)) & 1;
+}
+
+static bool glyphTexel(wchar_t c, bool bold, int x, int y)
+{
+    if (c == L' ' || x < 0 || y < 0 || x >= TEST_GLYPH_WIDTH || y >= TEST_GLYPH_HEIGHT)
+        return false;
+
+    // Bold glyphs are one texel wider
+    if (glyphBlock(c, bold, x / 2, y / 2))
+        return true;
+    return bold && x > 0 && glyphBlock(c, bold, (x - 1) / 2, y / 2);
+}
+
+// Write an atlas of the printable ASCII characters, regular and bold, with
+// a few kerning pairs
+static bool writeTestAtlas(const std::string &path)
+{
+    const unsigned int numFonts = 2;
+    const unsigned int numChars = 95;
+
+    const wchar_t kerned[][2] = { { L'A', L'V' }, { L'V', L'A' }, { L'T', L'o' } };
+    const unsigned int numKerned = sizeof(kerned) / sizeof(kerned[0]);
+
+    FontFileHeader header;
+    memcpy(header.magic, FONT_FILE_MAGIC, 8);
+    header.version    = FONT_FILE_VERSION;
+    header.numFonts   = numFonts;
+    header.numGlyphs  = numFonts * numChars;
+    header.numKerning = numFonts * numKerned;
+    header.width      = TEST_ATLAS_WIDTH;
+    header.height     = TEST_ATLAS_HEIGHT;
+    header.sdfWidth   = TEST_ATLAS_WIDTH;
+    header.sdfHeight  = TEST_ATLAS_HEIGHT;
+    header.sdfSpread  = TEST_SDF_SPREAD;
+
+    std::vector<FontFileFont> fonts(numFonts);
+    std::vector<FontFileGlyph> glyphs;
+    std::vector<FontFileKerning> kerning;
+    std::vector<unsigned char> pixels(TEST_ATLAS_WIDTH * TEST_ATLAS_HEIGHT, 0);
+    std::vector<bool> inside(pixels.size(), false);
+
+    const int cellWidth = TEST_GLYPH_WIDTH + TEST_GLYPH_PADDING;
+    const int cellHeight = TEST_GLYPH_HEIGHT + TEST_GLYPH_PADDING;
+    const int cellsPerRow = TEST_ATLAS_WIDTH / cellWidth;
+
+    for (unsigned int f = 0; f < numFonts; f++)
+    {
+        bool bold = f == 1;
+        fonts[f].size = 16.0f;
+        fonts[f].bold = bold;
+        fonts[f].firstGlyph = (unsigned int)glyphs.size();
+        fonts[f].numGlyphs = numChars;
+
+        for (unsigned int i = 0; i < numChars; i++)
+        {
+            wchar_t c = wchar_t(32 + i);
+            int cell = int(glyphs.size());
+            int left = (cell % cellsPerRow) * cellWidth + TEST_GLYPH_PADDING / 2;
+            int top = (cell / cellsPerRow) * cellHeight + TEST_GLYPH_PADDING / 2;
+
+            FontFileGlyph g;
+            g.charcode = (unsigned int)c;
+            g.width = TEST_GLYPH_WIDTH;
+            g.height = TEST_GLYPH_HEIGHT;
+            g.offset_x = 1;
+            g.offset_y = TEST_GLYPH_HEIGHT;
+            g.advance_x = bold ? 11.0f : 10.0f;
+            g.advance_y = 0.0f;
+            g.u0 = float(left) / TEST_ATLAS_WIDTH;
+            g.v0 = float(top) / TEST_ATLAS_HEIGHT;
+            g.u1 = float(left + TEST_GLYPH_WIDTH) / TEST_ATLAS_WIDTH;
+            g.v1 = float(top + TEST_GLYPH_HEIGHT) / TEST_ATLAS_HEIGHT;
+            g.firstKerning = (unsigned int)kerning.size();
+            g.numKerning = 0;
+
+            for (unsigned int k = 0; k < numKerned; k++)
+            {
+                if (kerned[k][1] != c)
+                    continue;
+
+                FontFileKerning pair;
+                pair.charcode = (unsigned int)kerned[k][0];
+                pair.kerning = -2.0f;
+                kerning.push_back(pair);
+                g.numKerning++;
+            }
+            glyphs.push_back(g);
+
+            for (int y = 0; y < TEST_GLYPH_HEIGHT; y++)
+                for (int x = 0; x < TEST_GLYPH_WIDTH; x++)
+                    if (glyphTexel(c, bold, x, y))
+                    {
+                        pixels[(top + y) * TEST_ATLAS_WIDTH + left + x] = 255;
+                        inside[(top + y) * TEST_ATLAS_WIDTH + left + x] = true;
+                    }
+        }
+    }
+
+    // Distance field at the resolution of the atlas: 128 on the outlines,
+    // saturating TEST_SDF_SPREAD texels away
+    std::vector<unsigned char> sdf(pixels.size());
+    for (int y = 0; y < TEST_ATLAS_HEIGHT; y++)
+    {
+        for (int x = 0; x < TEST_ATLAS_WIDTH; x++)
+        {
+            bool in = inside[y * TEST_ATLAS_WIDTH + x];
+            float nearest = float(TEST_SDF_SPREAD);
+
+            for (int dy = -TEST_SDF_SPREAD; dy <= TEST_SDF_SPREAD; dy++)
+            {
+                for (int dx = -TEST_SDF_SPREAD; dx <= TEST_SDF_SPREAD; dx++)
+                {
+                    int sx = x + dx, sy = y + dy;
+                    if (sx < 0 || sy < 0 || sx >= TEST_ATLAS_WIDTH || sy >= TEST_ATLAS_HEIGHT ||
+                        inside[sy * TEST_ATLAS_WIDTH + sx] == in)
+                        continue;
+                    nearest = std::min(nearest, sqrtf(float(dx * dx + dy * dy)) - 0.5f);
+                }
+            }
+
+            float d = (in ? nearest : -nearest) / TEST_SDF_SPREAD;
+            sdf[y * TEST_ATLAS_WIDTH + x] = (unsigned char)std::min(std::max(128.0f + d * 127.0f, 0.0f), 255.0f);
+        }
+    }
+
+    FILE *out = fopen(path.c_str(), "wb");
+    if (!out)
+        return false;
+
+    bool ok = fwrite(&header, sizeof(header), 1, out) == 1 &&
+              fwrite(&fonts[0], sizeof(FontFileFont), fonts.size(), out) == fonts.size() &&
+              fwrite(&glyphs[0], sizeof(FontFileGlyph), glyphs.size(), out) == glyphs.size() &&
+              fwrite(&kerning[0], sizeof(FontFileKerning), kerning.size(), out) == kerning.size() &&
+              fwrite(&pixels[0], 1, pixels.size(), out) == pixels.size() &&
+              fwrite(&sdf[0], 1, sdf.size(), out) == sdf.size();
+
+    return (fclose(out) == 0) && ok;
+}
+
+/////////////////////////////////////////////////////////////////////
+// Reticles
+/////////////////////////////////////////////////////////////////////
+
+// The settings of a node and the camera state of a view, as compute and
+// prepForDraw fill them in. The frame number is appended to the burn-in text
+// items, as the frame text type does.
+class Reticle
+{
+public:
+    ReticleSettings  settings;
+    CameraState      cam;
+    std::vector<int> burnIns;
+};
+
+// The camera state of the view at frame
+static void cameraAt(const Reticle &r, int frame, CameraState &cam)
+{
+    cam = r.cam;
+    for (size_t i = 0; i < r.burnIns.size(); i++)
+    {
+        MString number;
+        cam.text[r.burnIns[i]].textStr += number.set(frame);
+    }
+}
+
+static MColor color(float r, float g, float b, float transparency = 0.0f)
+{
+    return MColor(r, g, b, transparency);
+}
+
+static Aspect_Ratio aspectRatio(double aspect, int displayMode, int safeAction, int safeTitle,
+                                const MColor &line, const MColor &mask)
+{
+    Aspect_Ratio ar = Aspect_Ratio();
+    ar.aspectRatio = aspect;
+    ar.displayMode = displayMode;
+    ar.displaySafeAction = safeAction;
+    ar.displaySafeTitle = safeTitle;
+    ar.aspectGeom.lineColor = line;
+    ar.aspectGeom.maskColor = mask;
+    return ar;
+}
+
+// A text item anchored to the filmback at one of the positions of
+// textPosRel, moved by x and y
+static TextData label(const char *text, int posRel, double x, double y, int align, int vAlign,
+                      int size, bool bold, const MColor &c)
+{
+    TextData td = TextData();
+    td.textType = 0;
+    td.textStr = text;
+    td.textAlign = align;
+    td.textVAlign = vAlign;
+    td.textPosX = x;
+    td.textPosY = y;
+    td.textPosRel = posRel;
+    td.textLevel = 2;
+    td.textARLevel = 0;
+    td.textColor = c;
+    td.textEnabled = true;
+    td.textSize = size;
+    td.textBold = bold;
+    td.textScale = false;
+    return td;
+}
+
+// A camera of the given film aperture in inches and film fit, seen through
+// 10% of overscan, and a reticle filmback following it with the default
+// gates of the node scaled to the image area
+static void setFilmback(Reticle &r, double horizontal, double vertical, int filmFit, double soundTrack)
+{
+    CameraState &cam = r.cam;
+    cam.name = "shotCam";
+    cam.focalLength = 35.0;
+    cam.horizontalFilmAperture = horizontal;
+    cam.verticalFilmAperture = vertical;
+    cam.lensSqueezeRatio = 1.0;
+    cam.filmFit = filmFit;
+    cam.panX = 0.0;
+    cam.panY = 0.0;
+    cam.zoom = 1.0;
+    cam.overscan = 1.1;
+    cam.maximumDist = 0.0;
+
+    ReticleSettings &s = r.settings;
+    s.name = "reticle";
+    s.configVersion = 1;
+
+    Filmback &f = s.filmback;
+    f.horizontalFilmAperture = -1.0;
+    f.verticalFilmAperture = -1.0;
+    f.soundTrackWidth = soundTrack;
+    f.horizontalProjectionGate = (horizontal - soundTrack) * 0.95;
+    f.verticalProjectionGate = vertical * 0.95;
+    f.horizontalSafeAction = (horizontal - soundTrack) * 0.93;
+    f.verticalSafeAction = vertical * 0.93;
+    f.horizontalSafeTitle = (horizontal - soundTrack) * 0.86;
+    f.verticalSafeTitle = vertical * 0.86;
+    f.filmbackGeom.lineColor = color(0.9f, 0.9f, 0.2f);
+    f.filmbackGeom.maskColor = color(0.05f, 0.05f, 0.05f, 0.3f);
+    f.projGeom.lineColor = color(0.3f, 0.8f, 1.0f);
+    f.projGeom.maskColor = color(0.0f, 0.0f, 0.2f, 0.5f);
+    f.safeActionGeom.lineColor = color(0.4f, 1.0f, 0.4f);
+    f.safeTitleGeom.lineColor = color(1.0f, 0.5f, 0.2f);
+
+    s.options.drawingEnabled = true;
+    s.options.lineColor = color(0.8f, 0.8f, 0.8f, 0.2f);
+    s.options.textColor = color(1.0f, 1.0f, 1.0f);
+    s.options.lineWidth = 1.0f;
+}
+
+// Gates, aspect ratios and guides, without text
+static void gatesScene(Reticle &r)
+{
+    setFilmback(r, 0.980, 0.530, kFillFilmFit, 0.04);
+
+    Filmback &f = r.settings.filmback;
+    f.displayFilmGate = 3;
+    f.displayProjGate = 2;
+    f.displaySafeAction = 1;
+
+    r.settings.ars.push_back(aspectRatio(2.39, 3, 3, 2, color(1.0f, 1.0f, 1.0f), color(0.0f, 0.0f, 0.0f, 0.25f)));
+    r.settings.ars.push_back(aspectRatio(1.78, 2, 0, 0, color(0.5f, 0.7f, 1.0f), color(0.0f, 0.0f, 0.0f, 0.5f)));
+
+    Options &o = r.settings.options;
+    o.displayLineH = true;
+    o.displayLineV = true;
+    o.displayThirdsH = true;
+    o.displayThirdsV = true;
+    o.displayCrosshair = true;
+}
+
+// Field guide lines and numbers inside a padded 4:3 gate, with wide lines
+static void fieldGuideScene(Reticle &r)
+{
+    setFilmback(r, 0.980, 0.735, kVerticalFilmFit, 0.0);
+    r.settings.filmback.displayFilmGate = 1;
+
+    PadOptions &pad = r.settings.pad;
+    pad.usePad = true;
+    pad.isPadded = true;
+    pad.padAmountX = 0.04;
+    pad.padAmountY = 0.03;
+    pad.displayMode = 3;
+    pad.padGeom.lineColor = color(1.0f, 0.3f, 0.3f);
+    pad.padGeom.maskColor = color(0.2f, 0.0f, 0.0f, 0.4f);
+
+    Options &o = r.settings.options;
+    o.displayFieldGuide = true;
+    o.lineWidth = 2.0f;
+    o.textColor = color(1.0f, 0.9f, 0.3f);
+}
+
+// Pan and scan masks and custom text, with kerning, of several sizes,
+// weights and alignments, and a burn-in that changes every frame, through a
+// panned camera
+static void textScene(Reticle &r)
+{
+    setFilmback(r, 0.980, 0.551, kOverscanFilmFit, 0.0);
+    r.cam.panX = 0.02;
+    r.cam.panY = -0.01;
+
+    Filmback &f = r.settings.filmback;
+    f.displayFilmGate = 3;
+    f.displaySafeTitle = 2;
+
+    PanScan &ps = r.settings.panScan;
+    ps.aspectRatio = -1.0;
+    ps.displayMode = 2;
+    ps.displaySafeAction = 3;
+    ps.displaySafeTitle = 3;
+    ps.panScanRatio = 1.33;
+    ps.panScanOffset = 0.0;
+    ps.aspectGeom.lineColor = color(0.9f, 0.4f, 0.9f);
+    ps.aspectGeom.maskColor = color(0.1f, 0.0f, 0.1f, 0.5f);
+
+    r.settings.options.enableTextDrawing = true;
+
+    std::vector<TextData> &text = r.cam.text;
+    text.push_back(label("aa010_0010 comp v003", 6, 6, -6, 0, 2, 12, true, color(1.0f, 1.0f, 1.0f)));
+    text.push_back(label("AVA To VAT", 8, -6, -6, 2, 2, 14, false, color(1.0f, 0.8f, 0.2f)));
+    text.push_back(label("35mm f/2.8", 0, 6, 6, 0, 0, 10, false, color(0.6f, 1.0f, 0.6f, 0.3f)));
+    text.push_back(label("frame ", 1, 0, 6, 1, 0, 20, true, color(1.0f, 1.0f, 1.0f)));
+    text.push_back(label("2.39:1", 4, 0, 0, 1, 1, 32, false, color(0.5f, 0.8f, 1.0f, 0.5f)));
+    r.burnIns.push_back(3);
+
+    // Scaled with the filmback
+    TextData scaled = label("ISO 800", 2, -6, 6, 2, 0, 16, false, color(1.0f, 0.5f, 0.5f));
+    scaled.textScale = true;
+    text.push_back(scaled);
+}
+
+// Overlapping translucent masks and dashed lines of every kind, with thick
+// lines
+static void dashedScene(Reticle &r)
+{
+    setFilmback(r, 0.980, 0.490, kHorizontalFilmFit, 0.0);
+
+    Filmback &f = r.settings.filmback;
+    f.displayFilmGate = 2;
+    f.displayProjGate = 3;
+    f.displaySafeAction = 2;
+    f.displaySafeTitle = 2;
+
+    r.settings.ars.push_back(aspectRatio(2.39, 3, 3, 3, color(1.0f, 0.2f, 0.2f), color(0.3f, 0.0f, 0.0f, 0.6f)));
+    r.settings.ars.push_back(aspectRatio(2.76, 3, 2, 2, color(0.2f, 1.0f, 0.2f), color(0.0f, 0.3f, 0.0f, 0.6f)));
+    r.settings.ars.push_back(aspectRatio(3.5, 3, 0, 0, color(0.2f, 0.2f, 1.0f), color(0.0f, 0.0f, 0.3f, 0.6f)));
+
+    r.settings.options.displayCrosshair = true;
+    r.settings.options.lineWidth = 4.0f;
+}
+
+class Scene
+{
+public:
+    const char *name;
+    int         width, height;
+    void      (*build)(Reticle &r);
+};
+
+static const Scene scenes[] = {
+    { "gates",      480, 270, gatesScene },
+    { "fieldguide", 360, 270, fieldGuideScene },
+    { "text",       480, 270, textScene },
+    { "dashed",     480, 360, dashedScene }
+};
+
+static const int numScenes = sizeof(scenes) / sizeof(scenes[0]);
+
+/////////////////////////////////////////////////////////////////////
+// Renderers
+/////////////////////////////////////////////////////////////////////
+
+// An offscreen OpenGL context with a framebuffer of the largest scene
+class TestContext
+{
+public:
+    TestContext();
+    ~TestContext();
+
+    // Create the context and make it current on the calling thread. A
+    // context created for another thread shares the EGL display of the
+    // main one.
+    bool create(const TestContext *main = NULL);
+
+    // Clear the viewport of a frame of the given size
+    void beginFrame(int width, int height);
+
+    void read(int width, int height, Image &image);
+
+    // The name of the golden images, from the features of the context
+    static const char *name();
+
+private:
+#if defined(SPRETICLE_OSMESA)
+    OSMesaContext              context;
+    std::vector<unsigned char> buffer;
+#else
+    EGLDisplay                 display;
+    EGLSurface                 surface;
+    EGLContext                 context;
+    bool                       ownsDisplay;
+#endif
+};
+
+#if defined(SPRETICLE_OSMESA)
+
+TestContext::TestContext()
+:   context(NULL)
+{
+}
+
+TestContext::~TestContext()
+{
+    if (context)
+        OSMesaDestroyContext(context);
+}
+
+bool TestContext::create(const TestContext * /*main*/)
+{
+    context = OSMesaCreateContextExt(OSMESA_RGBA, 0, 0, 0, NULL);
+    if (!context)
+    {
+        std::cerr << "unable to create an OSMesa context" << std::endl;
+        return false;
+    }
+
+    buffer.resize(TEST_MAX_WIDTH * TEST_MAX_HEIGHT * 4);
+    if (!OSMesaMakeCurrent(context, &buffer[0], GL_UNSIGNED_BYTE, TEST_MAX_WIDTH, TEST_MAX_HEIGHT))
+    {
+        std::cerr << "unable to make the OSMesa context current" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+#else
+
+TestContext::TestContext()
+:   display(EGL_NO_DISPLAY),
+    surface(EGL_NO_SURFACE),
+    context(EGL_NO_CONTEXT),
+    ownsDisplay(false)
+{
+}
+
+TestContext::~TestContext()
+{
+    if (display == EGL_NO_DISPLAY)
+        return;
+
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (context != EGL_NO_CONTEXT)
+        eglDestroyContext(display, context);
+    if (surface != EGL_NO_SURFACE)
+        eglDestroySurface(display, surface);
+    if (ownsDisplay)
+        eglTerminate(display);
+}
+
+// A pbuffer of the Mesa surfaceless platform when there is one, which needs
+// neither a display nor a GPU, else of the default display
+bool TestContext::create(const TestContext *main)
+{
+    if (main)
+        display = main->display;
+#if defined(EGL_PLATFORM_SURFACELESS_MESA)
+    const char *extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (display == EGL_NO_DISPLAY && extensions && strstr(extensions, "EGL_MESA_platform_surfaceless") &&
+        getPlatformDisplay)
+        display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+#endif
+    if (display == EGL_NO_DISPLAY)
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    EGLint major, minor;
+    if (!main && (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)))
+    {
+        std::cerr << "unable to initialize EGL" << std::endl;
+        return false;
+    }
+    ownsDisplay = !main;
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE,        8,
+        EGL_GREEN_SIZE,      8,
+        EGL_BLUE_SIZE,       8,
+        EGL_ALPHA_SIZE,      8,
+        EGL_NONE
+    };
+    const EGLint surfaceAttribs[] = {
+        EGL_WIDTH,  TEST_MAX_WIDTH,
+        EGL_HEIGHT, TEST_MAX_HEIGHT,
+        EGL_NONE
+    };
+
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    if (!eglBindAPI(EGL_OPENGL_API) ||
+        !eglChooseConfig(display, configAttribs, &config, 1, &numConfigs) || numConfigs < 1)
+    {
+        std::cerr << "no EGL configuration for OpenGL pbuffers" << std::endl;
+        return false;
+    }
+
+    surface = eglCreatePbufferSurface(display, config, surfaceAttribs);
+    context = eglCreateContext(display, config, EGL_NO_CONTEXT, NULL);
+    if (surface == EGL_NO_SURFACE || context == EGL_NO_CONTEXT ||
+        !eglMakeCurrent(display, surface, surface, context))
+    {
+        std::cerr << "unable to create an EGL context (error 0x" << std::hex << eglGetError() << ")" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+#endif
+
+void TestContext::beginFrame(int width, int height)
+{
+    glViewport(0, 0, width, height);
+    glClearColor(TEST_BACKGROUND, TEST_BACKGROUND, TEST_BACKGROUND, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void TestContext::read(int width, int height, Image &image)
+{
+    std::vector<unsigned char> rgba(size_t(width) * height * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &rgba[0]);
+
+    image.width = width;
+    image.height = height;
+    image.rgb.resize(size_t(width) * height * 3);
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *src = &rgba[size_t(height - 1 - y) * width * 4];
+        unsigned char *dst = &image.rgb[size_t(y) * width * 3];
+        for (int x = 0; x < width; x++)
+        {
+            dst[x*3+0] = src[x*4+0];
+            dst[x*3+1] = src[x*4+1];
+            dst[x*3+2] = src[x*4+2];
+        }
+    }
+}
+
+const char *TestContext::name()
+{
+    return GLFunctions::has(GLFunctions::kShaders) ? "gl" : "glfixed";
+}
+
+// The software renderer image over the background
+static void readSoftware(const SoftwareRenderer &renderer, Image &image)
+{
+    std::vector<unsigned char> rgba;
+    renderer.toRGBA8(rgba);
+
+    image.width = renderer.width();
+    image.height = renderer.height();
+    image.rgb.resize(size_t(image.width) * image.height * 3);
+
+    const float background = TEST_BACKGROUND * 255.0f;
+    for (size_t i = 0, j = 0; i < rgba.size(); i += 4, j += 3)
+    {
+        float t = 1.0f - rgba[i+3] / 255.0f;
+        for (int c = 0; c < 3; c++)
+            image.rgb[j+c] = (unsigned char)std::min(rgba[i+c] + background * t + 0.5f, 255.0f);
+    }
+}
+
+// One of the renderers under test
+class Target
+{
+public:
+    Target(TestContext *context) : context(context) {}
+
+    GPURenderer *create() const
+    {
+        if (context)
+            return new OpenGLRenderer();
+
+        SoftwareRenderer *renderer = new SoftwareRenderer();
+        renderer->setNumThreads(1);
+        return renderer;
+    }
+
+    const char *name() const { return context ? TestContext::name() : "software"; }
+
+    // Draw the reticle at frame into the layout of a view, as drawBase
+    bool draw(const Reticle &r, Layout &layout, GPURenderer *renderer,
+              int width, int height, int frame) const
+    {
+        CameraState cam;
+        cameraAt(r, frame, cam);
+
+        if (context)
+            context->beginFrame(width, height);
+        return drawReticle(r.settings, cam, width, height, layout, renderer);
+    }
+
+    void read(GPURenderer *renderer, int width, int height, Image &image) const
+    {
+        if (context)
+            context->read(width, height, image);
+        else
+            readSoftware(*static_cast<SoftwareRenderer *>(renderer), image);
+    }
+
+    // Report any OpenGL error of the frame
+    bool checkErrors(const char *scene, const char *what) const
+    {
+        if (!context)
+            return true;
+
+        bool ok = true;
+        for (GLenum error = glGetError(); error != GL_NO_ERROR; error = glGetError())
+        {
+            std::cerr << scene << "." << name() << ": OpenGL error 0x" << std::hex << error << std::dec
+                      << " drawing the " << what << " frame" << std::endl;
+            ok = false;
+        }
+        return ok;
+    }
+
+    TestContext *context;
+};
+
+/////////////////////////////////////////////////////////////////////
+// Tests
+/////////////////////////////////////////////////////////////////////
+
+class Settings
+{
+public:
+    Settings() : update(false), bench(false), timers(false), frames(200), threads(8),
+        golden("test/golden"), out("test_output") {}
+
+    bool        update;
+    bool        bench;
+    bool        timers;
+    int         frames;
+    int         threads;
+    std::string golden;
+    std::string out;
+};
+
+static bool sameImage(const char *scene, const Target &target, const char *what,
+                      const Image &image, const Image &expected, const Settings &settings)
+{
+    int tolerance = target.context ? TEST_CACHE_TOLERANCE : 0;
+    if (compareImages(image, expected, tolerance) == 0)
+        return true;
+
+    std::string path = settings.out + "/" + scene + "." + target.name() + "." + what + ".ppm";
+    writePPM(path, image);
+    std::cerr << scene << "." << target.name() << ": the " << what
+              << " frame differs from the frame drawn in full, see " << path << std::endl;
+    return false;
+}
+
+// Draw the scene in full, compare it with the golden image, then check that
+// drawing it again without changes, and with new text only, gives the same
+// images as drawing in full
+static bool testScene(const Scene &scene, const Target &target, const Settings &settings)
+{
+    Reticle r = Reticle();
+    scene.build(r);
+
+    RenderStats stats;
+    GPURenderer *renderer = target.create();
+    renderer->setStats(&stats);
+    renderer->setGPUTimers(settings.timers);
+
+    std::string name = std::string(scene.name) + "." + target.name();
+    std::string golden = settings.golden + "/" + name + ".ppm";
+
+    Layout layout;
+    Image image, expected;
+    bool ok = true;
+
+    target.draw(r, layout, renderer, scene.width, scene.height, TEST_FRAME);
+    ok &= target.checkErrors(scene.name, "first");
+    target.read(renderer, scene.width, scene.height, image);
+
+    if (settings.update)
+    {
+        if (!writePPM(golden, image))
+        {
+            std::cerr << "unable to write " << golden << std::endl;
+            ok = false;
+        }
+        else
+            std::cout << "wrote " << golden << std::endl;
+    }
+    else if (!readPPM(golden, expected))
+    {
+        std::cerr << name << ": unable to read " << golden << std::endl;
+        ok = false;
+    }
+    else
+    {
+        size_t different = compareImages(image, expected, TEST_CHANNEL_TOLERANCE);
+        if (different > size_t(TEST_PIXEL_TOLERANCE * image.width * image.height))
+        {
+            std::string path = settings.out + "/" + name + ".ppm";
+            writePPM(path, image);
+            std::cerr << name << ": " << long(different) << " pixels differ from " << golden
+                      << ", see " << path << std::endl;
+            ok = false;
+        }
+    }
+
+    // The same frame again
+    Image again;
+    target.draw(r, layout, renderer, scene.width, scene.height, TEST_FRAME);
+    ok &= target.checkErrors(scene.name, "unchanged");
+    target.read(renderer, scene.width, scene.height, again);
+    ok &= sameImage(scene.name, target, "unchanged", again, image, settings);
+
+    // The next frame, of which only the text changed, against a new view
+    Image next, full;
+    target.draw(r, layout, renderer, scene.width, scene.height, TEST_FRAME + 1);
+    ok &= target.checkErrors(scene.name, "next");
+    target.read(renderer, scene.width, scene.height, next);
+
+    GPURenderer *fresh = target.create();
+    Layout freshLayout;
+    target.draw(r, freshLayout, fresh, scene.width, scene.height, TEST_FRAME + 1);
+    ok &= target.checkErrors(scene.name, "next full");
+    target.read(fresh, scene.width, scene.height, full);
+    ok &= sameImage(scene.name, target, "next", next, full, settings);
+
+    // The GPU times of the first frames are read back by the next ones
+    if (settings.timers && target.context && GLFunctions::has(GLFunctions::kTimerQueries) &&
+        (stats.gpuFrames == 0 || stats.gpuTime <= 0.0))
+    {
+        std::cerr << name << ": no GPU time was read back" << std::endl;
+        ok = false;
+    }
+
+    delete fresh;
+    delete renderer;
+
+    if (!settings.update)
+        std::cout << (ok ? "ok      " : "FAILED  ") << name << std::endl;
+    return ok;
+}
+
+// A view drawing a scene on its own thread with its own renderer and
+// statistics, as the views of a node drawn at the same time by Viewport 2.0.
+// OpenGL views draw in their own context, current on their thread.
+class ThreadView
+{
+public:
+    ThreadView() : scene(NULL), reticle(NULL), changed(NULL), target(NULL), started(false), ok(true) {}
+
+    const Scene   *scene;
+    const Reticle *reticle;
+    const Reticle *changed;
+    const Target  *target;
+    bool           started;
+    bool           ok;
+    pthread_t      thread;
+    RenderStats    stats;
+    Image          image;
+};
+
+// Draw changed, unchanged and playback frames of the scene, which
+// drawReticle counts in the statistics of the view
+static void *drawThreadView(void *data)
+{
+    ThreadView *t = static_cast<ThreadView *>(data);
+    const Scene &scene = *t->scene;
+
+    TestContext context;
+    Target target(NULL);
+    if (t->target->context)
+    {
+        if (!context.create(t->target->context))
+        {
+            t->ok = false;
+            return NULL;
+        }
+        target.context = &context;
+    }
+
+    GPURenderer *renderer = target.create();
+    renderer->setStats(&t->stats);
+
+    Layout layout;
+    for (int i = 0; i < TEST_THREAD_FRAMES; i++)
+    {
+        const Reticle &r = ((i / 8) % 2) ? *t->changed : *t->reticle;
+        target.draw(r, layout, renderer, scene.width, scene.height, TEST_FRAME + i / 2);
+        t->ok &= target.checkErrors(scene.name, "thread");
+    }
+
+    target.read(renderer, scene.width, scene.height, t->image);
+    delete renderer;
+
+    if (target.context)
+        GLResources::releaseContext();
+    return NULL;
+}
+
+// Draw the scene from several threads at once, each view with its own
+// renderer, and its own OpenGL context, sharing the reticle, the font atlas
+// and GLResources. Every view must end with the image of a single view and
+// count its own frames, and the statistics of the views must add up.
+static bool threadScene(const Scene &scene, const Target &target, const Settings &settings)
+{
+    Reticle r = Reticle();
+    scene.build(r);
+
+    // The settings edited every 8 frames, as compute gives them a new version
+    Reticle changed = r;
+    changed.settings.configVersion++;
+
+    std::string name = std::string(scene.name) + "." + target.name() + ".threads";
+
+    // The last frame of the views, drawn by a single view
+    const int last = TEST_THREAD_FRAMES - 1;
+    GPURenderer *single = target.create();
+    Layout singleLayout;
+    target.draw(r, singleLayout, single, scene.width, scene.height, TEST_FRAME + last / 2);
+    Image expected;
+    target.read(single, scene.width, scene.height, expected);
+    delete single;
+
+    std::vector<ThreadView> views(settings.threads);
+    for (size_t i = 0; i < views.size(); i++)
+    {
+        views[i].scene = &scene;
+        views[i].reticle = &r;
+        views[i].changed = &changed;
+        views[i].target = &target;
+    }
+
+    bool ok = true;
+    for (size_t i = 0; i < views.size(); i++)
+    {
+        views[i].started = pthread_create(&views[i].thread, NULL, drawThreadView, &views[i]) == 0;
+        if (!views[i].started)
+        {
+            std::cerr << name << ": unable to start thread " << i << std::endl;
+            ok = false;
+        }
+    }
+
+    RenderStats total;
+    for (size_t i = 0; i < views.size(); i++)
+    {
+        if (!views[i].started)
+            continue;
+        pthread_join(views[i].thread, NULL);
+
+        const RenderStats &stats = views[i].stats;
+        int tolerance = target.context ? TEST_CACHE_TOLERANCE : 0;
+        if (!views[i].ok)
+        {
+            std::cerr << name << ": view " << i << " failed" << std::endl;
+            ok = false;
+        }
+        else if (compareImages(views[i].image, expected, tolerance) != 0)
+        {
+            char path[64];
+            sprintf(path, "/%s.%s.thread%d.ppm", scene.name, target.name(), int(i));
+            writePPM(settings.out + path, views[i].image);
+            std::cerr << name << ": view " << i << " differs from a single view, see "
+                      << settings.out + path << std::endl;
+            ok = false;
+        }
+        if (stats.frames != TEST_THREAD_FRAMES || stats.skippedFrames != views[0].stats.skippedFrames ||
+            stats.textFrames != views[0].stats.textFrames)
+        {
+            std::cerr << name << ": view " << i << " counted " << stats.frames << " frames, "
+                      << stats.skippedFrames << " skipped and " << stats.textFrames << " text only" << std::endl;
+            ok = false;
+        }
+        total.add(stats);
+    }
+
+    unsigned int started = 0;
+    for (size_t i = 0; i < views.size(); i++)
+        started += views[i].started ? 1 : 0;
+    if (total.frames != started * TEST_THREAD_FRAMES ||
+        total.skippedFrames != started * views[0].stats.skippedFrames ||
+        total.textFrames != started * views[0].stats.textFrames)
+    {
+        std::cerr << name << ": the views add up to " << total.frames << " frames, "
+                  << total.skippedFrames << " skipped and " << total.textFrames << " text only" << std::endl;
+        ok = false;
+    }
+
+    std::cout << (ok ? "ok      " : "FAILED  ") << name << std::endl;
+    return ok;
+}
+
+// Time frames of the scene where the geometry changes, where only the text
+// changes, as in a playback, and where nothing changes
+static void benchScene(const Scene &scene, const Target &target, const Settings &settings)
+{
+    Reticle r = Reticle();
+    scene.build(r);
+
+    const char *modes[] = { "changed", "playback", "static" };
+    const char *paths[] = { "full", "skipped", "text" };
+    for (int mode = 0; mode < 3; mode++)
+    {
+        RenderStats stats;
+        GPURenderer *renderer = target.create();
+        renderer->setStats(&stats);
+        renderer->setGPUTimers(settings.timers);
+
+        Layout layout;
+        CameraState cam;
+        double cpuTime = 0.0, finishTime = 0.0;
+        unsigned long calls = 0, draws = 0, queries = 0, drawCalls = 0, uploadBytes = 0;
+        unsigned int frames[3] = { 0, 0, 0 };
+
+        // The first frame creates the objects of the renderer, it is not
+        // timed
+        for (int i = -1; i < settings.frames; i++)
+        {
+            int frame = (mode == 0 || mode == 1) ? TEST_FRAME + i : TEST_FRAME;
+            cameraAt(r, frame, cam);
+
+            // The line color stands for any change of the settings, which
+            // compute gives a new version
+            if (mode == 0)
+            {
+                r.settings.options.lineColor.g = (i & 1) ? 0.75f : 0.8f;
+                r.settings.configVersion++;
+            }
+
+            if (target.context)
+                target.context->beginFrame(scene.width, scene.height);
+
+            unsigned int skipped = stats.skippedFrames;
+            GLCalls::reset();
+            double start = RenderStats::now();
+            bool full = drawReticle(r.settings, cam, scene.width, scene.height, layout, renderer);
+            double drawn = RenderStats::now();
+            unsigned int frameCalls = GLCalls::calls();
+            unsigned int frameDraws = GLCalls::draws();
+            unsigned int frameQueries = GLCalls::queries();
+            if (target.context)
+                glFinish();
+            double finished = RenderStats::now();
+
+            // drawReticle counted the frame
+            if (i < 0)
+            {
+                stats.reset();
+                continue;
+            }
+
+            cpuTime += drawn - start;
+            finishTime += finished - start;
+            calls += frameCalls;
+            draws += frameDraws;
+            queries += frameQueries;
+            drawCalls += stats.drawCalls;
+            uploadBytes += stats.uploadBytes;
+            frames[full ? 0 : (stats.skippedFrames != skipped) ? 1 : 2]++;
+        }
+
+        double n = settings.frames;
+        printf("%-10s %-8s %-8s %8.3f %8.3f %8.3f %8.1f %6.1f %7.1f %6.1f %9.1f %7u",
+               scene.name, target.name(), modes[mode],
+               cpuTime / n * 1e3, stats.maxTime * 1e3, finishTime / n * 1e3,
+               calls / n, draws / n, queries / n, drawCalls / n, uploadBytes / n / 1024.0, stats.cachedFrames);
+        if (settings.timers && stats.gpuFrames)
+            printf(" %8.3f", stats.gpuTime * 1e3);
+
+        const char *separator = "  ";
+        for (int p = 0; p < 3; p++)
+        {
+            if (!frames[p])
+                continue;
+            printf("%s%s %u", separator, paths[p], frames[p]);
+            separator = ", ";
+        }
+        printf("\n");
+
+        delete renderer;
+    }
+}
+
+static void printBenchHeader(const Settings &settings)
+{
+    printf("%-10s %-8s %-8s %8s %8s %8s %8s %6s %7s %6s %9s %7s%s  frames\n",
+           "scene", "renderer", "inputs", "cpu ms", "max ms", "finish", "gl calls",
+           "draws", "queries", "stats", "upload KB", "cached", settings.timers ? "   gpu ms" : "");
+}
+
+static bool runTarget(const Target &target, const std::vector<const Scene *> &selected,
+                      const Settings &settings)
+{
+    bool ok = true;
+    for (size_t i = 0; i < selected.size(); i++)
+    {
+        if (settings.bench)
+            benchScene(*selected[i], target, settings);
+        else
+            ok &= testScene(*selected[i], target, settings);
+    }
+
+    if (!settings.bench && !settings.update)
+        for (size_t i = 0; i < selected.size() && settings.threads > 0; i++)
+            ok &= threadScene(*selected[i], target, settings);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    Settings settings;
+    bool gl = false, software = false;
+    std::vector<const Scene *> selected;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "-gl")
+            gl = true;
+        else if (arg == "-software")
+            software = true;
+        else if (arg == "-update")
+            settings.update = true;
+        else if (arg == "-bench")
+            settings.bench = true;
+        else if (arg == "-timers")
+            settings.timers = true;
+        else if (arg == "-frames" && i + 1 < argc)
+            settings.frames = std::max(atoi(argv[++i]), 1);
+        else if (arg == "-threads" && i + 1 < argc)
+            settings.threads = std::max(atoi(argv[++i]), 0);
+        else if (arg == "-golden" && i + 1 < argc)
+            settings.golden = argv[++i];
+        else if (arg == "-out" && i + 1 < argc)
+            settings.out = argv[++i];
+        else if (arg[0] != '-')
+        {
+            int s = 0;
+            while (s < numScenes && arg != scenes[s].name)
+                s++;
+            if (s == numScenes)
+            {
+                std::cerr << "unknown scene " << arg << std::endl;
+                return 1;
+            }
+            selected.push_back(&scenes[s]);
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [-gl] [-software] [-update] [-bench] [-timers]"
+                      << " [-frames n] [-threads n] [-golden dir] [-out dir] [scene ...]" << std::endl;
+            return 1;
+        }
+    }
+
+    if (!gl && !software)
+        gl = software = true;
+
+    if (selected.empty())
+        for (int s = 0; s < numScenes; s++)
+            selected.push_back(&scenes[s]);
+
+    if (mkdir(settings.out.c_str(), 0777) != 0 && errno != EEXIST)
+    {
+        std::cerr << "unable to create " << settings.out << std::endl;
+        return 1;
+    }
+
+    // Every renderer uses the test atlas
+    std::string atlas = settings.out + "/test.spfont";
+    if (!writeTestAtlas(atlas))
+    {
+        std::cerr << "unable to write " << atlas << std::endl;
+        return 1;
+    }
+    setenv(FONT_ATLAS_ENV_VAR, atlas.c_str(), 1);
+    FontRegistry::initialize();
+
+    if (settings.bench)
+        printBenchHeader(settings);
+
+    bool ok = true;
+
+    if (software)
+        ok &= runTarget(Target(NULL), selected, settings);
+
+    if (gl)
+    {
+        TestContext context;
+        if (!context.create())
+            return 1;
+
+        // Look up the entry points, and count the calls to them
+        GLResources::beginDraw();
+        GLCalls::install();
+
+        if (!settings.bench)
+            std::cout << glGetString(GL_RENDERER) << ", OpenGL " << glGetString(GL_VERSION) << std::endl;
+
+        ok &= runTarget(Target(&context), selected, settings);
+
+        GLResources::releaseContext();
+    }
+
+    FontRegistry::uninitialize();
+    return ok ? 0 : 1;
+}
@@ -42,8 +42,12 @@
 #ifndef spReticle_util_h
 #define spReticle_util_h
 
+#include <vector>
+
 #include <maya/MColor.h>
 #include <maya/MString.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MMessage.h>
 
 class Geom
 {
@@ -130,8 +134,11 @@ public:
     bool   driveCameraAperture;
     bool   useOverscan;
     double maximumDistance;
+    MString shotMetadataFile;
     MColor textColor;
     MColor lineColor;
+    float  lineWidth;
+    bool   displayStats;
 };
 
 class TextData
@@ -151,6 +158,165 @@ public:
     int     textSize;
     bool    textBold;
     bool    textScale;
+    MString textSource;
+};
+
+// Result of the script of a script text item at one frame
+class ScriptResult
+{
+public:
+    ScriptResult() : frame(0) {}
+
+    double  frame;
+    MString result;
+};
+
+// Cached results of a script text item. Scripts are evaluated on the idle
+// queue and the results of the last SCRIPT_TEXT_CACHE_FRAMES frames are
+// kept. The latest result is displayed until the one of the frame is ready.
+class ScriptText
+{
+public:
+    ScriptText() : python(false), latest(-1), next(0), pending(false), warned(false) {}
+
+    MString script;
+    bool    python;
+
+    std::vector<ScriptResult> results;
+    int     latest;
+    int     next;
+    bool    pending;
+    bool    warned;
+};
+
+// Whether a reticle is drawn through a camera, cached by the node until the
+// settings, the camera or the cameras connected to the node change
+class CameraVisibility
+{
+public:
+    CameraVisibility() : callback(0), configVersion(0), visible(false), valid(false) {}
+
+    MObjectHandle camera;
+    MCallbackId   callback;
+    int           configVersion;
+    bool          visible;
+    bool          valid;
+};
+
+// Film aperture of a camera set from the idle queue by driveCameraAperture,
+// kept until the camera has it so that it is only queued again when the
+// reticle asks for another one
+class ApertureRequest
+{
+public:
+    ApertureRequest() : horizontal(0.0), vertical(0.0) {}
+
+    MObjectHandle camera;
+    double        horizontal;
+    double        vertical;
+};
+
+// The film fits of MFnCamera::FilmFit, for the code that draws without Maya
+enum FilmFit
+{
+    kFillFilmFit = 0,
+    kHorizontalFilmFit,
+    kVerticalFilmFit,
+    kOverscanFilmFit,
+    kInvalidFilmFit
+};
+
+// Camera settings a reticle is drawn with, and the text items of the reticle
+// with their dynamic text resolved for the camera. Filled in by prepForDraw
+// for each view, read only while drawing.
+class CameraState
+{
+public:
+    CameraState() : configVersion(-1) {}
+
+    MString name;
+    double  focalLength;
+    double  horizontalFilmAperture;
+    double  verticalFilmAperture;
+    double  lensSqueezeRatio;
+    int     filmFit;        // FilmFit
+    double  panX, panY, zoom;
+    double  overscan;
+    double  maximumDist;
+
+    // The settings version the text was resolved for, see
+    // spReticleLoc::prepForDraw
+    int     configVersion;
+
+    std::vector<TextData> text;
+};
+
+// 64 bit FNV-1a hash of the inputs of a frame
+class InputHash
+{
+public:
+    InputHash() : value(14695981039346656037ULL) {}
+
+    void add(const void *data, size_t size)
+    {
+        const unsigned char *p = (const unsigned char *)data;
+        for (size_t i = 0; i < size; i++)
+        {
+            value ^= p[i];
+            value *= 1099511628211ULL;
+        }
+    }
+    void add(double d)         { add(&d, sizeof(d)); }
+    void add(int i)            { add(&i, sizeof(i)); }
+    void add(const MColor &c)  { add(c.r); add(c.g); add(c.b); add(c.a); }
+    void add(const MString &s) { add(int(s.length())); add(s.asChar(), s.length()); }
+
+    unsigned long long value;
+};
+
+// Settings of a reticle, read from the attributes of the node by compute and
+// only read while drawing. The name of the node is used in the errors of the
+// settings, see drawReticle.
+class ReticleSettings
+{
+public:
+    ReticleSettings() : configVersion(0) {}
+
+    MString    name;
+    Filmback   filmback;
+    PadOptions pad;
+    PanScan    panScan;
+    Options    options;
+    int        configVersion;
+
+    std::vector<Aspect_Ratio> ars;
+};
+
+class GPURenderer;
+
+// Geometry of a reticle in one port, computed by drawReticle from the
+// settings and a CameraState. Every view draws into its own layout.
+class Layout
+{
+public:
+    Layout() : geometryHash(0), textHash(0), renderer(NULL) {}
+
+    double     portWidth;
+    double     portHeight;
+    double     lensSqueezeRatio;
+    Geom       portGeom;
+    Filmback   filmback;
+    PadOptions pad;
+    PanScan    panScan;
+
+    std::vector<Aspect_Ratio> ars;
+
+    // The hashes of the inputs of the geometry and of the text of the last
+    // frame and the renderer that drew it, to draw the same frame again
+    // without computing it, or only its text
+    unsigned long long geometryHash;
+    unsigned long long textHash;
+    const GPURenderer *renderer;
 };
 
 #endif